@@ -39,6 +39,7 @@
 
 // C++ Includes
 #include <iostream>
+#include <vector>
 
 // Qt Includes
 #include <QtCore/QCommandLineOption>
@@ -47,6 +48,9 @@
 #include <QtCore/QDebug>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QString>
 
 // DREAM3DLib includes
@@ -61,6 +65,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Messages/PipelineProfileMessage.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
@@ -68,6 +73,25 @@
 #include "SIMPLib/Python/PythonLoader.h"
 #endif
 
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteProfile(const QString& filePath, const QJsonObject& json)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    std::cout << "The profile could not be written to '" << filePath.toStdString() << "'" << std::endl;
+    return false;
+  }
+  file.write(QJsonDocument(json).toJson());
+  std::cout << "Profile written to '" << filePath.toStdString() << "'" << std::endl;
+  return true;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -121,6 +145,22 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption releaseArraysArg(QStringList() << "r"
+                                                    << "release-unused-arrays",
+                                      "Remove each array from memory once no later filter references it.");
+  parser.addOption(releaseArraysArg);
+
+  QCommandLineOption concurrentArg(QStringList() << "j"
+                                                 << "concurrent-filters",
+                                   "Run up to this many filters that do not share data at the same time. Zero uses every hardware thread.", "count");
+  parser.addOption(concurrentArg);
+
+  QCommandLineOption profileArg(QStringList() << "profile", "Write the time and resources every filter used to a JSON file.", "file");
+  parser.addOption(profileArg);
+
+  QCommandLineOption profileTraceArg(QStringList() << "profile-trace", "Write the time every filter used to a file in the Chrome trace event format.", "file");
+  parser.addOption(profileTraceArg);
+
   // Process the actual command line arguments given by the user
   parser.process(app);
 
@@ -129,9 +169,9 @@ int main(int argc, char* argv[])
   std::cout << "PipelineRunner " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
   std::cout << "Input File: " << pipelineFile.toStdString() << std::endl;
 
-  // Register all the filters including trying to load those from Plugins
+  // Register all the filters. Plugins listed in the filter manifest are only loaded once the pipeline uses one of their filters.
   FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  SIMPLibPluginLoader::LoadPluginFilters(fm, false, true);
 
 #ifdef SIMPL_EMBED_PYTHON
   if(hasPythonHome)
@@ -206,8 +246,27 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "Pipeline Count: " << pipeline->size() << std::endl;
+  pipeline->setReleaseUnusedArrays(parser.isSet(releaseArraysArg));
+  if(parser.isSet(concurrentArg))
+  {
+    pipeline->setExecuteConcurrently(true);
+    pipeline->setMaxConcurrentFilters(parser.value(concurrentArg).toInt());
+  }
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
   pipeline->addMessageReceiver(&obs);
+
+  std::vector<PipelineProfileMessage::Pointer> profiles;
+  if(parser.isSet(profileArg) || parser.isSet(profileTraceArg))
+  {
+    pipeline->setProfilingEnabled(true);
+    QObject::connect(pipeline.get(), &FilterPipeline::messageGenerated, [&profiles](const AbstractMessage::Pointer& msg) {
+      PipelineProfileMessage::Pointer profile = std::dynamic_pointer_cast<PipelineProfileMessage>(msg);
+      if(nullptr != profile)
+      {
+        profiles.push_back(profile);
+      }
+    });
+  }
   // Preflight the pipeline
   int err = -1;
   try
@@ -234,6 +293,33 @@ int main(int argc, char* argv[])
     std::cout << "Exiting now.\n";
     return EXIT_FAILURE;
   }
+
+  // The profile is written even if a filter failed, it then ends with the failing filter
+  if(parser.isSet(profileArg))
+  {
+    QJsonArray filters;
+    for(const auto& profile : profiles)
+    {
+      filters.append(profile->toJson());
+    }
+    QJsonObject json;
+    json["PipelineName"] = pipeline->getName();
+    json["Filters"] = filters;
+    WriteProfile(parser.value(profileArg), json);
+  }
+  if(parser.isSet(profileTraceArg))
+  {
+    QJsonArray events;
+    for(const auto& profile : profiles)
+    {
+      events.append(profile->toTraceEvent());
+    }
+    QJsonObject json;
+    json["traceEvents"] = events;
+    json["displayTimeUnit"] = QString("ms");
+    WriteProfile(parser.value(profileTraceArg), json);
+  }
+
   err = pipeline->getErrorCode();
   if(err < 0)
   {
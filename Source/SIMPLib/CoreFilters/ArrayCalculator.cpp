@@ -53,6 +53,7 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorProgram.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -274,7 +275,7 @@ void ArrayCalculator::dataCheck()
       ICalculatorArray::Pointer array1 = std::dynamic_pointer_cast<ICalculatorArray>(item1);
       if(item1->isArray())
       {
-        if(!cDims.empty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getArray()->getComponentDimensions())
+        if(!cDims.empty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getSourceArray()->getComponentDimensions())
         {
           QString ss = QObject::tr("Attribute Array symbols in the infix expression have mismatching component dimensions");
           setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INCONSISTENT_COMP_DIMS), ss);
@@ -282,12 +283,12 @@ void ArrayCalculator::dataCheck()
         }
 
         resultType = ICalculatorArray::ValueType::Array;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getSourceArray()->getComponentDimensions();
       }
       else if(resultType == ICalculatorArray::ValueType::Unknown)
       {
         resultType = ICalculatorArray::ValueType::Number;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getSourceArray()->getComponentDimensions();
       }
     }
   }
@@ -397,7 +398,51 @@ void ArrayCalculator::execute()
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
 
-  // Execute the RPN expression
+  // Expressions that produce a full array are compiled and evaluated in a single pass over the data
+  IDataArray::Pointer resultTypeArray;
+  CalculatorProgram::Pointer program = CalculatorProgram::Compile(rpn, m_Units == Degrees);
+  if(nullptr != program && program->getNumberOfTuples() > 1)
+  {
+    notifyStatusMessage("Computing Compiled Expression");
+    resultTypeArray = program->evaluate(m_ScalarType, m_CalculatedArray.getDataArrayName());
+  }
+  else
+  {
+    resultTypeArray = executeRPN(rpn);
+    if(getErrorCode() < 0 || getCancel())
+    {
+      return;
+    }
+  }
+
+  if(nullptr == resultTypeArray)
+  {
+    QString ss = QObject::tr("Unexpected output item from chosen infix expression; the output item must be an array\n"
+                             "Please contact the DREAM.3D developers for more information");
+    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::UNEXPECTED_OUTPUT), ss);
+    return;
+  }
+
+  DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
+  AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
+  if(nullptr != createdAM)
+  {
+    resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
+    if(!createdAM->insertOrAssign(resultTypeArray))
+    {
+      QString ss = QObject::tr("Error inserting Output Array into Attribute Matrix");
+      setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::AttributeMatrixInsertionError), ss);
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ArrayCalculator::executeRPN(const QVector<CalculatorItem::Pointer>& rpn)
+{
+  // Execute the RPN expression one operator at a time
   int totalItems = rpn.size();
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
   {
@@ -418,55 +463,31 @@ void ArrayCalculator::execute()
       rpnOperator->calculate(this, m_CalculatedArray, m_ExecutionStack);
       if(getErrorCode() < 0)
       {
-        return;
+        return nullptr;
       }
     }
 
     if(getCancel())
     {
-      return;
+      return nullptr;
     }
   }
 
   // Grab the result from the stack
-  ICalculatorArray::Pointer arrayItem = ICalculatorArray::NullPointer();
   if(m_ExecutionStack.size() != 1)
   {
     QString ss = QObject::tr("The chosen infix equation is not a valid equation.");
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INVALID_EQUATION), ss);
-    return;
-  }
-  if(!m_ExecutionStack.isEmpty())
-  {
-    arrayItem = m_ExecutionStack.pop();
+    return nullptr;
   }
 
-  if(arrayItem != ICalculatorArray::NullPointer())
+  ICalculatorArray::Pointer arrayItem = m_ExecutionStack.pop();
+  if(arrayItem == ICalculatorArray::NullPointer())
   {
-    IDataArray::Pointer resultArray = arrayItem->getArray();
-
-    IDataArray::Pointer resultTypeArray = convertArrayType(resultArray, m_ScalarType);
-
-    DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
-    AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
-    if(nullptr != createdAM)
-    {
-      resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
-      if(!createdAM->insertOrAssign(resultTypeArray))
-      {
-        QString ss = QObject::tr("Error inserting Output Array into Attribute Matrix");
-        setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::AttributeMatrixInsertionError), ss);
-        return;
-      }
-    }
-  }
-  else
-  {
-    QString ss = QObject::tr("Unexpected output item from chosen infix expression; the output item must be an array\n"
-                             "Please contact the DREAM.3D developers for more information");
-    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::UNEXPECTED_OUTPUT), ss);
-    return;
+    return nullptr;
   }
+
+  return convertArrayType(arrayItem->getArray(), m_ScalarType);
 }
 
 // -----------------------------------------------------------------------------
@@ -485,8 +506,8 @@ IDataArray::Pointer convertArray(const DoubleArrayType::Pointer& inputArray)
   typename DataArray<T>::Pointer convertedArrayPtr = DataArray<T>::CreateArray(inputArray->getNumberOfTuples(), inputArray->getComponentDimensions(), inputArray->getName(), true);
   T* rawOutputArray = convertedArrayPtr->getPointer(0);
 
-  int count = inputArray->getSize();
-  for(int i = 0; i < count; i++)
+  size_t count = inputArray->getSize();
+  for(size_t i = 0; i < count; i++)
   {
     double val = rawInputarray[i];
     rawOutputArray[i] = val;
@@ -831,9 +852,9 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
   }
 
   ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(parsedInfix.back());
-  if(nullptr != calcArray && index >= calcArray->getArray()->getNumberOfComponents())
+  if(nullptr != calcArray && index >= calcArray->getSourceArray()->getNumberOfComponents())
   {
-    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getArray()->getName());
+    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getSourceArray()->getName());
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::COMPONENT_OUT_OF_RANGE), ss);
     return false;
   }
@@ -253,6 +253,15 @@ protected:
    */
   IDataArrayShPtrType convertArrayType(const IDataArrayShPtrType& inputArray, SIMPL::ScalarTypes::Type scalarType);
 
+  /**
+   * @brief Evaluates the RPN expression by running each operator over the whole execution stack
+   * and converts the result to the output scalar type. Used for expressions that cannot be compiled
+   * into a CalculatorProgram or that produce a single value.
+   * @param rpn
+   * @return
+   */
+  IDataArrayShPtrType executeRPN(const QVector<CalculatorItemShPtrType>& rpn);
+
 private:
   DataArrayPath m_SelectedAttributeMatrix = {"", "", ""};
   QString m_InfixEquation = {QString()};
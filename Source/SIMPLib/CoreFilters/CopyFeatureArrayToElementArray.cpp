@@ -39,6 +39,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/CoreFilters/util/FeatureReduction.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -148,36 +149,13 @@ void CopyFeatureArrayToElementArray::dataCheck()
 template <typename T>
 IDataArray::Pointer copyData(IDataArray::Pointer inputData, size_t totalPoints, int32_t* featureIds)
 {
-  QString cellArrayName = inputData->getName();
-
   typename DataArray<T>::Pointer feature = std::dynamic_pointer_cast<DataArray<T>>(inputData);
   if(nullptr == feature)
   {
     return IDataArray::NullPointer();
   }
 
-  std::vector<size_t> cDims = inputData->getComponentDimensions();
-  typename DataArray<T>::Pointer cell = DataArray<T>::CreateArray(totalPoints, cDims, cellArrayName, true);
-
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
-  size_t numComp = static_cast<size_t>(feature->getNumberOfComponents());
-  int32_t featureIdx = 0;
-
-  for(size_t i = 0; i < totalPoints; ++i)
-  {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-    // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
-    T* fSourcePtr = fPtr + (numComp * featureIdx);
-    // Now get the pointer to the start of the tuple for the Cell Array at the proper index
-    T* cDestPtr = cPtr + (numComp * i);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
-  }
-  return cell;
+  return FeatureReduction::Scatter(*feature, featureIds, totalPoints, inputData->getName());
 }
 
 // -----------------------------------------------------------------------------
@@ -196,32 +174,24 @@ void CopyFeatureArrayToElementArray::execute()
   // be notified of unanticipated behavior. this cannot be done in the dataCheck since
   // we don't have access to the data yet
   int32_t numFeatures = static_cast<int32_t>(m_InArrayPtr.lock()->getNumberOfTuples());
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
   size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
-  }
-
-  if(mismatchedFeatures)
+  FeatureReduction::IdRange idRange = FeatureReduction::FindIdRange(m_FeatureIds, totalPoints);
+  if(idRange.maximum >= numFeatures)
   {
     QString ss = QObject::tr("The given FeatureIds Array %1 has a value that is larger than allowed by the given Feature Attribute Matrix %2.\n %3 >= %4")
                      .arg(m_FeatureIdsArrayPath.serialize("/"))
                      .arg(m_SelectedFeatureArrayPath.serialize("/"))
-                     .arg(largestFeature)
+                     .arg(idRange.maximum)
                      .arg(numFeatures);
     setErrorCondition(-5555, ss);
     return;
   }
+  if(totalPoints > 0 && idRange.minimum < 0)
+  {
+    QString ss = QObject::tr("The given FeatureIds Array %1 has a negative value of %2").arg(m_FeatureIdsArrayPath.serialize("/")).arg(idRange.minimum);
+    setErrorCondition(-5556, ss);
+    return;
+  }
 
   IDataArray::Pointer p = IDataArray::NullPointer();
 
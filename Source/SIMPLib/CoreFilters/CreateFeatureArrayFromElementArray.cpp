@@ -39,9 +39,11 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/CoreFilters/util/FeatureReduction.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -68,6 +70,7 @@ CreateFeatureArrayFromElementArray::~CreateFeatureArrayFromElementArray() = defa
 void CreateFeatureArrayFromElementArray::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
+  parameters.push_back(SIMPL_NEW_CHOICE_FP("Reduction", ReductionType, FilterParameter::Category::Parameter, CreateFeatureArrayFromElementArray, FeatureReduction::ReductionTypeNames(), false));
   parameters.push_back(SeparatorFilterParameter::Create("Element Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -98,6 +101,7 @@ void CreateFeatureArrayFromElementArray::readFilterParameters(AbstractFilterPara
   setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setCreatedArrayName(reader->readString("CreatedArrayName", getCreatedArrayName()));
+  setReductionType(reader->readValue("ReductionType", getReductionType()));
   reader->closeFilterGroup();
 }
 
@@ -138,72 +142,57 @@ void CreateFeatureArrayFromElementArray::dataCheck()
     return;
   }
 
+  if(getReductionType() < 0 || getReductionType() >= static_cast<int>(FeatureReduction::ReductionTypeNames().size()))
+  {
+    setErrorCondition(-11003, QObject::tr("The reduction type %1 is not valid").arg(getReductionType()));
+    return;
+  }
+
   DataArrayPath tempPath(getCellFeatureAttributeMatrixName().getDataContainerName(), getCellFeatureAttributeMatrixName().getAttributeMatrixName(), getCreatedArrayName());
-  TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, m_InArrayPtr.lock()->getComponentDimensions(), m_InArrayPtr.lock(), FeatureArrayID);
+  switch(static_cast<FeatureReduction::ReductionType>(getReductionType()))
+  {
+  case FeatureReduction::ReductionType::Sum:
+  case FeatureReduction::ReductionType::Mean:
+    getDataContainerArray()->createNonPrereqArrayFromPath<DoubleArrayType>(this, tempPath, 0.0, m_InArrayPtr.lock()->getComponentDimensions(), "", FeatureArrayID);
+    break;
+  case FeatureReduction::ReductionType::Count:
+    getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType>(this, tempPath, 0, cDims, "", FeatureArrayID);
+    break;
+  default:
+    TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, m_InArrayPtr.lock()->getComponentDimensions(), m_InArrayPtr.lock(), FeatureArrayID);
+    break;
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, int32_t* featureIds, const QString& createdArrayName)
+IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, int32_t* featureIds, const QString& createdArrayName, int reductionType)
 {
-  QString featureArrayName = inputData->getName();
-
   typename DataArray<T>::Pointer cell = std::dynamic_pointer_cast<DataArray<T>>(inputData);
   if(nullptr == cell)
   {
     return IDataArray::NullPointer();
   }
 
-  std::vector<size_t> dims = inputData->getComponentDimensions();
-  typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName, true);
-
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
-  size_t numComp = static_cast<size_t>(cell->getNumberOfComponents());
-  int32_t featureIdx = 0;
-
-  size_t cells = inputData->getNumberOfTuples();
-
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
-
-  for(size_t i = 0; i < cells; ++i)
+  auto type = static_cast<FeatureReduction::ReductionType>(reductionType);
+  if(type == FeatureReduction::ReductionType::Last || type == FeatureReduction::ReductionType::First)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
-
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
+    // Check that all the values of a feature match the value that is copied
+    std::vector<size_t> representatives = FeatureReduction::FindRepresentatives(featureIds, cell->getNumberOfTuples(), features, type == FeatureReduction::ReductionType::First);
+    int32_t featureIdx = FeatureReduction::FindInconsistentFeature(*cell, featureIds, representatives);
+    if(featureIdx >= 0)
     {
-      featureMap.insert(featureIdx, cSourcePtr);
+      // The values are inconsistent with the copied values for this feature id, so throw a warning
+      QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The %2 value copied into Feature %1 will be used")
+                       .arg(featureIdx)
+                       .arg(type == FeatureReduction::ReductionType::First ? "first" : "last");
+      filter->setWarningCondition(-1000, ss);
     }
-
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
-    {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
-      {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->setWarningCondition(-1000, ss);
-        warningThrown = true;
-      }
-    }
-
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
   }
-  return feature;
+
+  return FeatureReduction::Reduce(*cell, featureIds, features, type, createdArrayName);
 }
 
 // -----------------------------------------------------------------------------
@@ -224,79 +213,70 @@ void CreateFeatureArrayFromElementArray::execute()
   // be notified of unanticipated behavior. this cannot be done in the dataCheck since
   // we don't have access to the data yet
   int32_t numFeatures = getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->getNumberOfTuples();
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
   size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
-  }
-
-  if(mismatchedFeatures)
+  FeatureReduction::IdRange idRange = FeatureReduction::FindIdRange(m_FeatureIds, totalPoints);
+  if(idRange.maximum >= numFeatures)
   {
     QString ss = QObject::tr("Attribute Matrix %1 has %2 tuples but the input array %3 has a Feature ID value of at least %4")
                      .arg(m_CellFeatureAttributeMatrixName.serialize("/"))
                      .arg(numFeatures)
                      .arg(getFeatureIdsArrayPath().serialize("/"))
-                     .arg(largestFeature);
+                     .arg(idRange.maximum);
     setErrorCondition(-5555, ss);
     return;
   }
-
+  if(totalPoints > 0 && idRange.minimum < 0)
+  {
+    QString ss = QObject::tr("The input array %1 has a negative Feature ID value of %2").arg(getFeatureIdsArrayPath().serialize("/")).arg(idRange.minimum);
+    setErrorCondition(-5556, ss);
+    return;
+  }
 
   IDataArray::Pointer p = IDataArray::NullPointer();
 
   if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<float>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<float>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<double>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<double>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<bool>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<bool>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName(), getReductionType());
   }
   else
   {
@@ -458,3 +438,15 @@ DataArrayPath CreateFeatureArrayFromElementArray::getFeatureIdsArrayPath() const
 {
   return m_FeatureIdsArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void CreateFeatureArrayFromElementArray::setReductionType(int value)
+{
+  m_ReductionType = value;
+}
+
+// -----------------------------------------------------------------------------
+int CreateFeatureArrayFromElementArray::getReductionType() const
+{
+  return m_ReductionType;
+}
@@ -60,6 +60,7 @@ class SIMPLib_EXPORT CreateFeatureArrayFromElementArray : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
   PYB11_PROPERTY(QString CreatedArrayName READ getCreatedArrayName WRITE setCreatedArrayName)
   PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+  PYB11_PROPERTY(int ReductionType READ getReductionType WRITE setReductionType)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -132,6 +133,18 @@ public:
 
   Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
 
+  /**
+   * @brief Setter property for ReductionType
+   */
+  void setReductionType(int value);
+  /**
+   * @brief Getter property for ReductionType
+   * @return Value of ReductionType
+   */
+  int getReductionType() const;
+
+  Q_PROPERTY(int ReductionType READ getReductionType WRITE setReductionType)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -214,6 +227,7 @@ private:
   DataArrayPath m_SelectedCellArrayPath = {"", "", ""};
   QString m_CreatedArrayName = {""};
   DataArrayPath m_FeatureIdsArrayPath = {"", "", ""};
+  int m_ReductionType = {0};
 
 public:
   CreateFeatureArrayFromElementArray(const CreateFeatureArrayFromElementArray&) = delete;            // Copy Constructor Not Implemented
@@ -49,6 +49,7 @@
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -196,7 +197,7 @@ void CropVertexGeometry::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t>& croppedPoints)
+void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, const std::vector<size_t>& croppedPoints)
 {
   typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
   T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
@@ -204,18 +205,15 @@ void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointe
   T* croppedData = static_cast<T*>(croppedDataPtr->getPointer(0));
 
   size_t nComps = inDataPtr->getNumberOfComponents();
-  size_t tmpIndex = 0;
-  size_t ptrIndex = 0;
 
-  for(std::vector<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    for(size_t d = 0; d < nComps; d++)
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, croppedPoints.size());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
     {
-      tmpIndex = nComps * i + d;
-      ptrIndex = nComps * croppedPoints[i] + d;
-      croppedData[tmpIndex] = inputData[ptrIndex];
+      std::copy(inputData + nComps * croppedPoints[i], inputData + nComps * (croppedPoints[i] + 1), croppedData + nComps * i);
     }
-  }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -232,39 +230,21 @@ void CropVertexGeometry::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getCroppedDataContainerName());
   VertexGeom::Pointer vertices = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<VertexGeom>();
-  int64_t numVerts = vertices->getNumberOfVertices();
-  float* allVerts = vertices->getVertexPointer(0);
-  std::vector<int64_t> croppedPoints;
-  croppedPoints.reserve(numVerts);
+  const float minCoords[3] = {m_XMin, m_YMin, m_ZMin};
+  const float maxCoords[3] = {m_XMax, m_YMax, m_ZMax};
 
-  for(int64_t i = 0; i < numVerts; i++)
+  // Building a spatial index costs more than one scan, and a cached one cannot tell whether the vertices
+  // were moved since it was built, so scan the vertices directly
+  std::vector<size_t> croppedPoints = VertexSpatialIndex::FindPointsInBox(*vertices->getVertices(), minCoords, maxCoords);
+
+  if(getCancel())
   {
-    if(getCancel())
-    {
-      return;
-    }
-    if(allVerts[3 * i + 0] >= m_XMin && allVerts[3 * i + 0] <= m_XMax && allVerts[3 * i + 1] >= m_YMin && allVerts[3 * i + 1] <= m_YMax && allVerts[3 * i + 2] >= m_ZMin &&
-       allVerts[3 * i + 2] <= m_ZMax)
-    {
-      croppedPoints.push_back(i);
-    }
+    return;
   }
 
-  croppedPoints.shrink_to_fit();
-
   VertexGeom::Pointer crop = dc->getGeometryAs<VertexGeom>();
   crop->resizeVertexList(croppedPoints.size());
-  float coords[3] = {0.0f, 0.0f, 0.0f};
-
-  for(std::list<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    if(getCancel())
-    {
-      return;
-    }
-    vertices->getCoords(croppedPoints[i], coords);
-    crop->setCoords(i, coords);
-  }
+  copyDataToCroppedGeometry<float>(vertices->getVertices(), crop->getVertices(), croppedPoints);
 
   std::vector<size_t> tDims(1, croppedPoints.size());
 
@@ -53,7 +53,9 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/HDF5/H5GlobalLock.h"
 #include "SIMPLib/Montages/MontageSupport.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
@@ -89,6 +91,11 @@ void DataContainerReader::setupFilterParameters()
     parameter->setFilter(this);
     parameters.push_back(parameter);
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Load Arrays When First Used", LoadArraysOnDemand, FilterParameter::Category::Parameter, DataContainerReader));
+  std::vector<QString> linkedProps = {"MinRegionOfInterest", "MaxRegionOfInterest"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Read Image Region of Interest", UseRegionOfInterest, FilterParameter::Category::Parameter, DataContainerReader, linkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Minimum Voxel Index", MinRegionOfInterest, FilterParameter::Category::Parameter, DataContainerReader));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Maximum Voxel Index (Inclusive)", MaxRegionOfInterest, FilterParameter::Category::Parameter, DataContainerReader));
 
   setFilterParameters(parameters);
 }
@@ -103,6 +110,10 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setLoadArraysOnDemand(reader->readValue("LoadArraysOnDemand", getLoadArraysOnDemand()));
+  setUseRegionOfInterest(reader->readValue("UseRegionOfInterest", getUseRegionOfInterest()));
+  setMinRegionOfInterest(reader->readIntVec3("MinRegionOfInterest", getMinRegionOfInterest()));
+  setMaxRegionOfInterest(reader->readIntVec3("MaxRegionOfInterest", getMaxRegionOfInterest()));
   reader->closeFilterGroup();
 }
 
@@ -168,6 +179,19 @@ void DataContainerReader::dataCheck()
     setErrorCondition(-388, ss);
   }
 
+  if(m_UseRegionOfInterest)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(m_MinRegionOfInterest[i] < 0 || m_MaxRegionOfInterest[i] < m_MinRegionOfInterest[i])
+      {
+        ss = QObject::tr("The region of interest must satisfy 0 <= Minimum <= Maximum along every axis");
+        setErrorCondition(-389, ss);
+        break;
+      }
+    }
+  }
+
   if(getErrorCode() != 0)
   {
     // something has gone wrong and errors were logged already so just return
@@ -249,6 +273,13 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
 
   SIMPLH5DataReader::Pointer simplReader = SIMPLH5DataReader::New();
   connect(simplReader.get(), &SIMPLH5DataReader::errorGenerated, [=](const QString& title, const QString& msg, int code) { setErrorCondition(code, msg); });
+  connect(simplReader.get(), &SIMPLH5DataReader::progressGenerated, [=](int progress, const QString& msg) { notifyProgressMessage(progress, msg); });
+  simplReader->setLoadArraysOnDemand(m_LoadArraysOnDemand);
+  if(m_UseRegionOfInterest)
+  {
+    simplReader->setImageRegionOfInterest({static_cast<size_t>(m_MinRegionOfInterest[0]), static_cast<size_t>(m_MinRegionOfInterest[1]), static_cast<size_t>(m_MinRegionOfInterest[2])},
+                                          {static_cast<size_t>(m_MaxRegionOfInterest[0]), static_cast<size_t>(m_MaxRegionOfInterest[1]), static_cast<size_t>(m_MaxRegionOfInterest[2])});
+  }
 
   if(!simplReader->openFile(getInputFile()))
   {
@@ -261,6 +292,7 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::New();
   }
 
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
   if(fileId < 0)
   {
@@ -289,6 +321,7 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
 // -----------------------------------------------------------------------------
 DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(const DataContainerArray::Pointer& dca)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
   if(fileId < 0)
   {
@@ -611,6 +644,54 @@ bool DataContainerReader::getOverwriteExistingDataContainers() const
   return m_OverwriteExistingDataContainers;
 }
 
+// -----------------------------------------------------------------------------
+void DataContainerReader::setLoadArraysOnDemand(bool value)
+{
+  m_LoadArraysOnDemand = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerReader::getLoadArraysOnDemand() const
+{
+  return m_LoadArraysOnDemand;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setUseRegionOfInterest(bool value)
+{
+  m_UseRegionOfInterest = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerReader::getUseRegionOfInterest() const
+{
+  return m_UseRegionOfInterest;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setMinRegionOfInterest(const IntVec3Type& value)
+{
+  m_MinRegionOfInterest = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type DataContainerReader::getMinRegionOfInterest() const
+{
+  return m_MinRegionOfInterest;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setMaxRegionOfInterest(const IntVec3Type& value)
+{
+  m_MaxRegionOfInterest = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type DataContainerReader::getMaxRegionOfInterest() const
+{
+  return m_MaxRegionOfInterest;
+}
+
 // -----------------------------------------------------------------------------
 void DataContainerReader::setLastFileRead(const QString& value)
 {
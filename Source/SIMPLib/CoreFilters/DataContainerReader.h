@@ -42,6 +42,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
@@ -67,6 +68,10 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
   PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
   PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
+  PYB11_PROPERTY(bool LoadArraysOnDemand READ getLoadArraysOnDemand WRITE setLoadArraysOnDemand)
+  PYB11_PROPERTY(bool UseRegionOfInterest READ getUseRegionOfInterest WRITE setUseRegionOfInterest)
+  PYB11_PROPERTY(IntVec3Type MinRegionOfInterest READ getMinRegionOfInterest WRITE setMinRegionOfInterest)
+  PYB11_PROPERTY(IntVec3Type MaxRegionOfInterest READ getMaxRegionOfInterest WRITE setMaxRegionOfInterest)
   PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -152,6 +157,54 @@ public:
 
   Q_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
 
+  /**
+   * @brief Setter property for LoadArraysOnDemand
+   */
+  void setLoadArraysOnDemand(bool value);
+  /**
+   * @brief Getter property for LoadArraysOnDemand
+   * @return Value of LoadArraysOnDemand
+   */
+  bool getLoadArraysOnDemand() const;
+
+  Q_PROPERTY(bool LoadArraysOnDemand READ getLoadArraysOnDemand WRITE setLoadArraysOnDemand)
+
+  /**
+   * @brief Setter property for UseRegionOfInterest
+   */
+  void setUseRegionOfInterest(bool value);
+  /**
+   * @brief Getter property for UseRegionOfInterest
+   * @return Value of UseRegionOfInterest
+   */
+  bool getUseRegionOfInterest() const;
+
+  Q_PROPERTY(bool UseRegionOfInterest READ getUseRegionOfInterest WRITE setUseRegionOfInterest)
+
+  /**
+   * @brief Setter property for MinRegionOfInterest
+   */
+  void setMinRegionOfInterest(const IntVec3Type& value);
+  /**
+   * @brief Getter property for MinRegionOfInterest
+   * @return Value of MinRegionOfInterest
+   */
+  IntVec3Type getMinRegionOfInterest() const;
+
+  Q_PROPERTY(IntVec3Type MinRegionOfInterest READ getMinRegionOfInterest WRITE setMinRegionOfInterest)
+
+  /**
+   * @brief Setter property for MaxRegionOfInterest
+   */
+  void setMaxRegionOfInterest(const IntVec3Type& value);
+  /**
+   * @brief Getter property for MaxRegionOfInterest
+   * @return Value of MaxRegionOfInterest
+   */
+  IntVec3Type getMaxRegionOfInterest() const;
+
+  Q_PROPERTY(IntVec3Type MaxRegionOfInterest READ getMaxRegionOfInterest WRITE setMaxRegionOfInterest)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -298,6 +351,10 @@ private:
   QString m_LastFileRead = {""};
   QDateTime m_LastRead = {QDateTime::currentDateTime()};
   DataContainerArrayProxy m_InputFileDataContainerArrayProxy = {};
+  bool m_LoadArraysOnDemand = {false};
+  bool m_UseRegionOfInterest = {false};
+  IntVec3Type m_MinRegionOfInterest = {0, 0, 0};
+  IntVec3Type m_MaxRegionOfInterest = {0, 0, 0};
 
   FilterPipeline::Pointer m_PipelineFromFile;
 
@@ -52,7 +52,10 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/HDF5/H5DataArrayWriteOptions.h"
+#include "SIMPLib/HDF5/H5GlobalLock.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
 #ifdef _WIN32
@@ -79,6 +82,9 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Category::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Category::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (0-9)", CompressionLevel, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Shuffle Bytes Before Compressing", UseShuffleFilter, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Chunk Dimensions (0 = Automatic)", ChunkDimensions, FilterParameter::Category::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -91,6 +97,9 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setUseShuffleFilter(reader->readValue("UseShuffleFilter", getUseShuffleFilter()));
+  setChunkDimensions(reader->readIntVec3("ChunkDimensions", getChunkDimensions()));
   reader->closeFilterGroup();
 }
 
@@ -116,6 +125,17 @@ void DataContainerWriter::dataCheck()
     m_OutputFile.append(".dream3d");
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
+
+  if(m_CompressionLevel < 0 || m_CompressionLevel > 9)
+  {
+    ss = QObject::tr("The compression level must be between 0 (no compression) and 9. The given value was %1").arg(m_CompressionLevel);
+    setErrorCondition(-11120, ss);
+  }
+  if(m_ChunkDimensions[0] < 0 || m_ChunkDimensions[1] < 0 || m_ChunkDimensions[2] < 0)
+  {
+    ss = QObject::tr("The chunk dimensions must be zero or positive");
+    setErrorCondition(-11121, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -141,6 +161,27 @@ void DataContainerWriter::execute()
     return;
   }
 
+  // Arrays that are still waiting to be loaded on demand may be backed by the file that is about to be replaced
+  for(const auto& dc : getDataContainerArray()->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : *am)
+      {
+        int32_t loadErr = array->loadDeferredValues();
+        if(loadErr < 0)
+        {
+          QString ss = QObject::tr("The values of the array '%1' could not be loaded from the file they were read from").arg(array->getName());
+          setErrorCondition(loadErr, ss);
+          return;
+        }
+      }
+    }
+  }
+
+  // Taken after the pending arrays were loaded and held until the file is closed
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
+
   hid_t fileId = -1;
 
   // Try to open a file to append data into
@@ -202,6 +243,14 @@ void DataContainerWriter::execute()
   hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(dcaGid);
 
+  H5DataArrayWriteOptions writeOptions;
+  writeOptions.compressionLevel = m_CompressionLevel;
+  writeOptions.shuffle = m_UseShuffleFilter;
+  if(m_ChunkDimensions[0] > 0 || m_ChunkDimensions[1] > 0 || m_ChunkDimensions[2] > 0)
+  {
+    writeOptions.chunkDims = {static_cast<size_t>(m_ChunkDimensions[0]), static_cast<size_t>(m_ChunkDimensions[1]), static_cast<size_t>(m_ChunkDimensions[2])};
+  }
+
   QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
   for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
   {
@@ -220,7 +269,7 @@ void DataContainerWriter::execute()
     // QString ss = QObject::tr("Writing %2 DataContainer").arg(dcNames[iter]);
 
     // Have the DataContainer write all of its Attribute Matrices and its Mesh
-    err = dc->writeAttributeMatricesToHDF5(dcGid);
+    err = dc->writeAttributeMatricesToHDF5(dcGid, writeOptions);
     if(err < 0)
     {
       setErrorCondition(err, "Error writing DataContainer AttributeMatrices");
@@ -559,6 +608,42 @@ bool DataContainerWriter::getWriteTimeSeries() const
   return m_WriteTimeSeries;
 }
 
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setCompressionLevel(int value)
+{
+  m_CompressionLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int DataContainerWriter::getCompressionLevel() const
+{
+  return m_CompressionLevel;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setUseShuffleFilter(bool value)
+{
+  m_UseShuffleFilter = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getUseShuffleFilter() const
+{
+  return m_UseShuffleFilter;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setChunkDimensions(const IntVec3Type& value)
+{
+  m_ChunkDimensions = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type DataContainerWriter::getChunkDimensions() const
+{
+  return m_ChunkDimensions;
+}
+
 // -----------------------------------------------------------------------------
 void DataContainerWriter::setAppendToExisting(bool value)
 {
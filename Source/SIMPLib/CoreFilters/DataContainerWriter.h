@@ -42,6 +42,7 @@
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 /**
@@ -61,6 +62,9 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
   PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
   PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
   PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+  PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+  PYB11_PROPERTY(bool UseShuffleFilter READ getUseShuffleFilter WRITE setUseShuffleFilter)
+  PYB11_PROPERTY(IntVec3Type ChunkDimensions READ getChunkDimensions WRITE setChunkDimensions)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -131,6 +135,42 @@ public:
 
   Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+  /**
+   * @brief Setter property for CompressionLevel
+   */
+  void setCompressionLevel(int value);
+  /**
+   * @brief Getter property for CompressionLevel
+   * @return Value of CompressionLevel
+   */
+  int getCompressionLevel() const;
+
+  Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+  /**
+   * @brief Setter property for UseShuffleFilter
+   */
+  void setUseShuffleFilter(bool value);
+  /**
+   * @brief Getter property for UseShuffleFilter
+   * @return Value of UseShuffleFilter
+   */
+  bool getUseShuffleFilter() const;
+
+  Q_PROPERTY(bool UseShuffleFilter READ getUseShuffleFilter WRITE setUseShuffleFilter)
+
+  /**
+   * @brief Setter property for ChunkDimensions
+   */
+  void setChunkDimensions(const IntVec3Type& value);
+  /**
+   * @brief Getter property for ChunkDimensions
+   * @return Value of ChunkDimensions
+   */
+  IntVec3Type getChunkDimensions() const;
+
+  Q_PROPERTY(IntVec3Type ChunkDimensions READ getChunkDimensions WRITE setChunkDimensions)
+
   /**
    * @brief Setter property for AppendToExisting
    */
@@ -251,6 +291,9 @@ private:
   bool m_WriteXdmfFile = {true};
   bool m_WriteTimeSeries = {false};
   bool m_AppendToExisting = {false};
+  int m_CompressionLevel = {0};
+  bool m_UseShuffleFilter = {false};
+  IntVec3Type m_ChunkDimensions = {0, 0, 0};
 
 public:
   DataContainerWriter(const DataContainerWriter&) = delete;            // Copy Constructor Not Implemented
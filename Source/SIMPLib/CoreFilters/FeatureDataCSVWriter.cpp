@@ -34,11 +34,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FeatureDataCSVWriter.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/util/DelimitedTextWriter.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -170,15 +173,16 @@ void FeatureDataCSVWriter::execute()
     return;
   }
 
-  QFile file(getFeatureDataFile());
-  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  DelimitedTextWriter::Pointer writer = DelimitedTextWriter::New(getFeatureDataFile());
+  if(!writer->isOpen())
   {
     QString ss = QObject::tr("Output file could not be opened: %1").arg(getFeatureDataFile());
     setErrorCondition(-100, ss);
     return;
   }
 
-  QTextStream outFile(&file);
+  QString header;
+  QTextStream outFile(&header);
 
   AttributeMatrix::Pointer cellFeatureAttrMat = getDataContainerArray()->getAttributeMatrix(getCellFeatureAttributeMatrixPath());
 
@@ -192,6 +196,7 @@ void FeatureDataCSVWriter::execute()
   headers.sort();
 
   std::vector<IDataArray::Pointer> data;
+  std::vector<DelimitedTextWriter::RowFormatter> formatters;
 
   // For checking if an array is a neighborlist
   NeighborList<int32_t>::Pointer neighborlistPtr = NeighborList<int32_t>::CreateArray(0, std::string("_INTERNAL_USE_ONLY_JunkNeighborList"), false);
@@ -218,9 +223,17 @@ void FeatureDataCSVWriter::execute()
       }
       // Get the IDataArray from the DataContainer
       data.push_back(p);
+      formatters.push_back(DelimitedTextWriter::CreateTupleFormatter(p, m_Delimiter));
     }
   }
   outFile << "\n";
+  outFile.flush();
+  if(!writer->write(header))
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getFeatureDataFile());
+    setErrorCondition(-101, ss);
+    return;
+  }
 
   // Get the number of tuples in the arrays
   size_t numTuples = 0;
@@ -229,32 +242,37 @@ void FeatureDataCSVWriter::execute()
     numTuples = data[0]->getNumberOfTuples();
   }
 
-  float threshold = 0.0f;
+  char delimiter = m_Delimiter;
+  auto formatRow = [&formatters, delimiter](std::string& buffer, size_t i) {
+    // Print the feature id
+    DelimitedTextWriter::AppendValue(buffer, i);
+    // Print a row of data
+    for(const auto& formatter : formatters)
+    {
+      buffer.push_back(delimiter);
+      formatter(buffer, i);
+    }
+    buffer.push_back('\n');
+  };
 
-  // Skip feature 0
-  for(size_t i = 1; i < numTuples; ++i)
+  // Skip feature 0. The rows are written in blocks so progress can be reported in between
+  size_t blockSize = std::max(numTuples / 20, static_cast<size_t>(65536));
+  for(size_t startRow = 1; startRow < numTuples; startRow += blockSize)
   {
-    float percentIncrement = static_cast<float>(i) / static_cast<float>(numTuples) * 100.0f;
-    if(percentIncrement > threshold)
+    float percentIncrement = static_cast<float>(startRow) / static_cast<float>(numTuples) * 100.0f;
+    QString ss = QObject::tr("Writing Feature Data || %1% Complete").arg(static_cast<double>(percentIncrement));
+    notifyStatusMessage(ss);
+    if(getCancel())
     {
-      QString ss = QObject::tr("Writing Feature Data || %1% Complete").arg(static_cast<double>(percentIncrement));
-      notifyStatusMessage(ss);
-      threshold = threshold + 5.0f;
-      if(threshold < percentIncrement)
-      {
-        threshold = percentIncrement;
-      }
+      return;
     }
 
-    // Print the feature id
-    outFile << i;
-    // Print a row of data
-    for(std::vector<IDataArray::Pointer>::iterator p = data.begin(); p != data.end(); ++p)
+    if(!writer->writeRows(startRow, std::min(startRow + blockSize, numTuples), formatRow))
     {
-      outFile << m_Delimiter;
-      (*p)->printTuple(outFile, i, m_Delimiter);
+      ss = QObject::tr("Error writing to the output file: %1").arg(getFeatureDataFile());
+      setErrorCondition(-101, ss);
+      return;
     }
-    outFile << "\n";
   }
 
   if(m_WriteNeighborListData)
@@ -267,23 +285,32 @@ void FeatureDataCSVWriter::execute()
       IDataArray::Pointer p = cellFeatureAttrMat->getAttributeArray(*iter);
       if(p->getNameOfClass().compare(neighborlistPtr->getNameOfClass()) == 0)
       {
-        outFile << SIMPL::FeatureData::FeatureID << m_Delimiter << SIMPL::FeatureData::NumNeighbors << m_Delimiter << (*iter) << "\n";
-        numTuples = p->getNumberOfTuples();
+        QString neighborHeader;
+        QTextStream neighborOut(&neighborHeader);
+        neighborOut << SIMPL::FeatureData::FeatureID << m_Delimiter << SIMPL::FeatureData::NumNeighbors << m_Delimiter << (*iter) << "\n";
+        neighborOut.flush();
+        DelimitedTextWriter::RowFormatter formatter = DelimitedTextWriter::CreateTupleFormatter(p, m_Delimiter);
+        auto formatNeighbors = [&formatter, delimiter](std::string& buffer, size_t i) {
+          // Print the feature id
+          DelimitedTextWriter::AppendValue(buffer, i);
+          // Print a row of data
+          buffer.push_back(delimiter);
+          formatter(buffer, i);
+          buffer.push_back('\n');
+        };
 
         // Skip feature 0
-        for(size_t i = 1; i < numTuples; ++i)
+        numTuples = p->getNumberOfTuples();
+        if(!writer->write(neighborHeader) || !writer->writeRows(1, numTuples, formatNeighbors))
         {
-          // Print the feature id
-          outFile << i;
-          // Print a row of data
-          outFile << m_Delimiter;
-          p->printTuple(outFile, i, m_Delimiter);
-          outFile << "\n";
+          QString ss = QObject::tr("Error writing to the output file: %1").arg(getFeatureDataFile());
+          setErrorCondition(-101, ss);
+          return;
         }
       }
     }
   }
-  file.close();
+  notifyStatusMessage(writer->getThroughputMessage());
 }
 
 // -----------------------------------------------------------------------------
@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ImportAsciDataArray.h"
 
+#include <cstring>
 #include <fstream>
 #include <locale>
 
@@ -44,6 +45,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/ScopedFileMonitor.hpp"
+#include "SIMPLib/CoreFilters/util/DelimitedTextParser.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -107,115 +109,56 @@ public:
 
 } // namespace Detail
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int check_error_bits(std::ifstream* f)
-{
-  int stop = RBR_NO_ERROR;
-  if(f->eof())
-  {
-    // std::perror("stream eofbit. error state");
-    stop = RBR_READ_EOF;
-  }
-  else if(f->fail())
-  {
-    // std::perror("stream failbit (or badbit). error state");
-    stop = RBR_READ_ERROR;
-  }
-  else if(f->bad())
-  {
-    // std::perror("stream badbit. error state");
-    stop = RBR_READ_ERROR;
-  }
-  return stop;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T, typename K>
 int32_t readAsciFile(typename DataArray<T>::Pointer data, const QString& filename, int32_t skipHeaderLines, char delimiter, bool inputIsBool = false)
 {
-  int32_t err = 0;
-  QFileInfo fi(filename);
-  if(err < 0)
-  {
-    return RBR_FILE_TOO_SMALL;
-  }
-
-  std::ifstream in(filename.toLatin1().constData(), std::ios_base::in | std::ios_base::binary);
-  if(!in.is_open())
+  DelimitedTextParser::Pointer parser = DelimitedTextParser::New(filename);
+  if(!parser->isOpen())
   {
     return RBR_FILE_NOT_OPEN;
   }
 
-  in.imbue(std::locale(std::locale(), new Detail::DelimiterType(delimiter)));
-
-  QByteArray buf(kBufferSize, '\0');
-  char* buffer = buf.data();
-
-  // Skip some header bytes by just reading those bytes into the pointer knowing that the next
-  // thing we are going to do it over write those bytes with the real data that we are after.
-  for(int i = 0; i < skipHeaderLines; i++)
-  {
-    buf.fill(0x00);                                  // Splat Null Chars across the line
-    err = Detail::readLine(in, buffer, kBufferSize); // Read Line 1 - VTK Version Info
-    if(err < 0)
-    {
-      return RBR_READ_ERROR;
-    }
-  }
-
-  size_t numTuples = data->getNumberOfTuples();
-  int scalarNumComp = data->getNumberOfComponents();
-
-  size_t totalSize = numTuples * static_cast<size_t>(scalarNumComp);
-  err = RBR_NO_ERROR;
+  size_t totalSize = data->getNumberOfTuples() * static_cast<size_t>(data->getNumberOfComponents());
+  T* ptr = data->getPointer(0);
+  DelimitedTextParser::ReadStatus status = DelimitedTextParser::ReadStatus::Ok;
   if(inputIsBool)
   {
-    double value = 0.0;
-    int64_t* si64Ptr = reinterpret_cast<int64_t*>(&value);
-
-    for(size_t i = 0; i < totalSize; ++i)
-    {
-      in >> value;
-      if(*si64Ptr == 0)
-      {
-        data->setValue(i, false);
-      }
-      else
-      {
-        data->setValue(i, true);
-      }
-      err = check_error_bits(&in);
-      if(err == RBR_READ_EOF && i < totalSize - 1)
-      {
-        return err;
-      }
-      if(err == RBR_READ_ERROR)
+    status = parser->parseValues(static_cast<size_t>(skipHeaderLines), delimiter, totalSize, [ptr](const char* first, const char* last, size_t index) {
+      double value = 0.0;
+      if(!DelimitedTextParser::ConvertValue(first, last, value))
       {
-        return err;
+        return false;
       }
-    }
+      // Any bit pattern other than +0.0 is true
+      int64_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      ptr[index] = (bits != 0);
+      return true;
+    });
   }
   else
   {
-    K value = static_cast<T>(0.0);
-    for(size_t i = 0; i < totalSize; ++i)
-    {
-      in >> value;
-      data->setValue(i, static_cast<T>(value));
-      err = check_error_bits(&in);
-      if(err == RBR_READ_EOF && i < totalSize - 1)
+    status = parser->parseValues(static_cast<size_t>(skipHeaderLines), delimiter, totalSize, [ptr](const char* first, const char* last, size_t index) {
+      K value = static_cast<K>(0);
+      if(!DelimitedTextParser::ConvertValue(first, last, value))
       {
-        return err;
+        return false;
       }
-      if(err == RBR_READ_ERROR)
-      {
-        return err;
-      }
-    }
+      ptr[index] = static_cast<T>(value);
+      return true;
+    });
+  }
+
+  if(status == DelimitedTextParser::ReadStatus::ConversionFailure)
+  {
+    return RBR_READ_ERROR;
+  }
+  if(status == DelimitedTextParser::ReadStatus::EndOfFile)
+  {
+    return RBR_READ_EOF;
   }
   return RBR_NO_ERROR;
 }
@@ -632,7 +575,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Bool)
   {
     BoolArrayType::Pointer p = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType>(this, getCreatedAttributeArrayPath(), cDims);
-    err = readAsciFile<bool, bool>(p, m_InputFile, m_SkipHeaderLines, delimiter, true);
+    err = readAsciFile<bool, double>(p, m_InputFile, m_SkipHeaderLines, delimiter, true);
     if(err >= 0)
     {
       m_Array = p;
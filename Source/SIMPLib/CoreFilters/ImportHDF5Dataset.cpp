@@ -50,6 +50,7 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/HDF5/H5GlobalLock.h"
 
 namespace Detail
 {
@@ -166,6 +167,7 @@ void ImportHDF5Dataset::dataCheck()
     return;
   }
 
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   hid_t fileId = H5Utilities::openFile(m_HDF5FilePath.toStdString(), true);
   if(fileId < 0)
   {
@@ -46,41 +46,13 @@
 #include "SIMPLib/FilterParameters/ScalarTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdProgram.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
   ThresholdArrayID = 1
 };
 
-namespace Detail
-{
-template <typename T>
-void updateDestinationArray(const BoolArrayType& thresholdArray, IDataArray::Pointer iDestinationArray)
-{
-  typename DataArray<T>::Pointer destinationArray = std::dynamic_pointer_cast<DataArray<T>>(iDestinationArray);
-  size_t thresholdSize = thresholdArray.getNumberOfTuples();
-  T* dest = destinationArray->getPointer(0);
-
-  for(int64_t p = 0; p < thresholdSize; p++)
-  {
-    if constexpr(std::is_same<T, bool>::value)
-    {
-      // Boolean case
-      if(!dest[p] || !thresholdArray[p])
-      {
-        dest[p] = false;
-      }
-    }
-    else if(dest[p] == static_cast<T>(0) || !thresholdArray[p])
-    {
-      // Non-boolean case
-      dest[p] = static_cast<T>(0);
-    }
-  }
-}
-} // namespace Detail
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -224,9 +196,6 @@ void MultiThresholdObjects::execute()
   DataContainer::Pointer m = dca->getDataContainer(dcName);
   AttributeMatrix::Pointer am = m->getAttributeMatrix(amName);
 
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(am->getNumberOfTuples());
-
   // At least one threshold value is required
   if(m_SelectedThresholds.size() == 0)
   {
@@ -235,66 +204,22 @@ void MultiThresholdObjects::execute()
     return;
   }
 
-  // Loop on the Comparison objects updating our final result array as we go
-  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
+  // Compile all of the comparisons into a single predicate that is evaluated in one pass over the data
+  QString invalidArrayName;
+  ThresholdProgram::Pointer program = ThresholdProgram::Compile(m_SelectedThresholds, am, invalidArrayName);
+  if(nullptr == program)
   {
-    // Create and initialize an array to use for these results
-    BoolArrayType::Pointer thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-    // Initialize with False
-    thresholdArrayPtr->initializeWithZeros();
-
-    ComparisonInput_t& compRef = m_SelectedThresholds[i];
-
-    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, thresholdArrayPtr.get());
-
-    int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName), thresholdArrayPtr.get());
-    if(err < 0)
-    {
-      DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
-      QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-      setErrorCondition(-13002, ss);
-      return;
-    }
+    DataArrayPath tempPath(dcName, amName, invalidArrayName);
+    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+    setErrorCondition(-13002, ss);
+    return;
+  }
 
-    switch(m_ScalarType)
-    {
-    case SIMPL::ScalarTypes::Type::Int8:
-      Detail::updateDestinationArray<int8_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::Int16:
-      Detail::updateDestinationArray<int16_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::Int32:
-      Detail::updateDestinationArray<int32_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::Int64:
-      Detail::updateDestinationArray<int64_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::UInt8:
-      Detail::updateDestinationArray<uint8_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::UInt16:
-      Detail::updateDestinationArray<uint16_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::UInt32:
-      Detail::updateDestinationArray<uint32_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::UInt64:
-      Detail::updateDestinationArray<uint64_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::Float:
-      Detail::updateDestinationArray<float>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::Double:
-      Detail::updateDestinationArray<double>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::Bool:
-      Detail::updateDestinationArray<bool>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    case SIMPL::ScalarTypes::Type::SizeT:
-      Detail::updateDestinationArray<size_t>(*thresholdArrayPtr, m_DestinationPtr.lock());
-      break;
-    }
+  if(program->evaluate(m_DestinationPtr.lock()) < 0)
+  {
+    QString ss = QObject::tr("Error writing the threshold results into the destination array '%1'").arg(getDestinationArrayName());
+    setErrorCondition(-13003, ss);
+    return;
   }
 }
 
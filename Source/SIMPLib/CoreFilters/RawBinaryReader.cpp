@@ -38,15 +38,19 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 
+#include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/ScopedFileMonitor.hpp"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
@@ -56,6 +60,8 @@
 #include "SIMPLib/FilterParameters/NumericTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/UInt64FilterParameter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
 
 #if defined(_MSC_VER)
 #define FSEEK _fseeki64
@@ -101,7 +107,7 @@ int32_t SanityCheckFileSizeVersusAllocatedSize(size_t allocatedBytes, size_t fil
 
 // -----------------------------------------------------------------------------
 template <typename T>
-int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, uint64_t skipHeaderBytes, int32_t endian)
+int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, uint64_t skipHeaderBytes, int32_t endian, bool memoryMapFile, IDataArray::Pointer& mappedArray)
 {
   auto dataArray = dynamic_cast<DataArray<T>*>(dataArrayPtr);
 
@@ -119,6 +125,57 @@ int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, ui
     return RBR_FILE_TOO_SMALL;
   }
 
+  const bool swapBytes = (endian == k_EndianCheck);
+
+  // Values that need no byte swap and start on an element boundary are used straight from the file
+  if(memoryMapFile && !swapBytes && skipHeaderBytes % sizeof(T) == 0)
+  {
+    T* ptr = static_cast<T*>(DataArrayStorageSettings::MapFile(QString::fromStdString(filename), skipHeaderBytes, numBytesToRead));
+    if(ptr != nullptr)
+    {
+      mappedArray = DataArray<T>::WrapPointer(ptr, dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), true);
+      return RBR_NO_ERROR;
+    }
+  }
+
+  if(!dataArray->isAllocated() && dataArray->allocate() < 0)
+  {
+    return RBR_DA_ERROR;
+  }
+
+  // Copy the values out of a read only mapping in parallel chunks and swap each chunk while it is still in the cache
+  QFile file(QString::fromStdString(filename));
+  const uchar* source = nullptr;
+  if(numBytesToRead > 0 && file.open(QIODevice::ReadOnly))
+  {
+    source = file.map(static_cast<qint64>(skipHeaderBytes), static_cast<qint64>(numBytesToRead));
+  }
+  if(source != nullptr)
+  {
+    T* destination = dataArray->getPointer(0);
+    const size_t numElements = dataArray->getSize();
+    const size_t chunkSize = SIMPL::DEFAULT_BLOCKSIZE / sizeof(T);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, (numElements + chunkSize - 1) / chunkSize);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        const size_t start = chunk * chunkSize;
+        const size_t end = std::min(start + chunkSize, numElements);
+        std::memcpy(destination + start, source + start * sizeof(T), (end - start) * sizeof(T));
+        if(swapBytes)
+        {
+          for(size_t i = start; i < end; i++)
+          {
+            SIMPLib::Endian::ByteSwapper::convert(destination[i]);
+          }
+        }
+      }
+    });
+    return RBR_NO_ERROR;
+  }
+
   FILE* f = std::fopen(filename.c_str(), "rb");
   if(f == nullptr)
   {
@@ -153,13 +210,29 @@ int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, ui
     }
   }
 
-  if(endian == k_EndianCheck)
+  if(swapBytes)
   {
     dataArray->byteSwapElements();
   }
 
   return RBR_NO_ERROR;
 }
+
+// -----------------------------------------------------------------------------
+template <typename ArrayType>
+void createCreatedArray(RawBinaryReader* filter, const std::vector<size_t>& cDims, bool allocate)
+{
+  const DataArrayPath path = filter->getCreatedAttributeArrayPath();
+  if(allocate)
+  {
+    filter->getDataContainerArray()->createNonPrereqArrayFromPath<ArrayType>(filter, path, 0, cDims, "CreatedAttributeArrayPath");
+    return;
+  }
+
+  // Preflight already validated the path, so only an unallocated placeholder is needed here
+  AttributeMatrix::Pointer attrMat = filter->getDataContainerArray()->getAttributeMatrix(path);
+  attrMat->addOrReplaceAttributeArray(ArrayType::CreateArray(attrMat->getNumberOfTuples(), cDims, path.getDataArrayName(), false));
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -191,6 +264,7 @@ void RawBinaryReader::setupFilterParameters()
     parameters.push_back(parameter);
   }
   parameters.push_back(SIMPL_NEW_UINT64_FP("Skip Header Bytes", SkipHeaderBytes, FilterParameter::Category::Parameter, RawBinaryReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Memory Map File", MemoryMapFile, FilterParameter::Category::Parameter, RawBinaryReader));
   {
     DataArrayCreationFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Output Attribute Array", CreatedAttributeArrayPath, FilterParameter::Category::CreatedArray, RawBinaryReader, req));
@@ -208,12 +282,19 @@ void RawBinaryReader::readFilterParameters(AbstractFilterParametersReader* reade
   setNumberOfComponents(reader->readValue("NumberOfComponents", getNumberOfComponents()));
   setEndian(reader->readValue("Endian", getEndian()));
   setSkipHeaderBytes(reader->readValue("SkipHeaderBytes", getSkipHeaderBytes()));
+  setMemoryMapFile(reader->readValue("MemoryMapFile", getMemoryMapFile()));
 
   reader->closeFilterGroup();
 }
 
 // -----------------------------------------------------------------------------
 void RawBinaryReader::dataCheck()
+{
+  dataCheck(!getInPreflight());
+}
+
+// -----------------------------------------------------------------------------
+void RawBinaryReader::dataCheck(bool allocate)
 {
   clearErrorCode();
   clearWarningCode();
@@ -253,52 +334,52 @@ void RawBinaryReader::dataCheck()
   std::vector<size_t> cDims = {static_cast<size_t>(m_NumberOfComponents)};
   if(m_ScalarType == SIMPL::NumericTypes::Type::Int8)
   {
-    dca->createNonPrereqArrayFromPath<Int8ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<Int8ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(int8_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt8)
   {
-    dca->createNonPrereqArrayFromPath<UInt8ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<UInt8ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(uint8_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int16)
   {
-    dca->createNonPrereqArrayFromPath<Int16ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<Int16ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(int16_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt16)
   {
-    dca->createNonPrereqArrayFromPath<UInt16ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<UInt16ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(uint16_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int32)
   {
-    dca->createNonPrereqArrayFromPath<Int32ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<Int32ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(int32_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt32)
   {
-    dca->createNonPrereqArrayFromPath<UInt32ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<UInt32ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(uint32_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int64)
   {
-    dca->createNonPrereqArrayFromPath<Int64ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<Int64ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(int64_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt64)
   {
-    dca->createNonPrereqArrayFromPath<UInt64ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<UInt64ArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(uint64_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Float)
   {
-    dca->createNonPrereqArrayFromPath<FloatArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<FloatArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(float) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Double)
   {
-    dca->createNonPrereqArrayFromPath<DoubleArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createCreatedArray<DoubleArrayType>(this, cDims, allocate);
     allocatedBytes = sizeof(double) * totalSize;
   }
 
@@ -328,7 +409,9 @@ void RawBinaryReader::dataCheck()
 // -----------------------------------------------------------------------------
 void RawBinaryReader::execute()
 {
-  dataCheck();
+  // An array that is backed by the file itself is created without storage and replaced by the mapped array
+  const bool memoryMapFile = m_MemoryMapFile && m_Endian != k_EndianCheck;
+  dataCheck(!memoryMapFile);
   if(getErrorCode() < 0)
   {
     return;
@@ -360,49 +443,55 @@ void RawBinaryReader::execute()
 
   const std::string inputFile = m_InputFile.toStdString();
 
+  IDataArray::Pointer mappedArray;
   int32_t err = 0;
   switch(m_ScalarType)
   {
   case SIMPL::NumericTypes::Type::Int8:
-    err = readBinaryFile<int8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::UInt8:
-    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::Int16:
-    err = readBinaryFile<int16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::UInt16:
-    err = readBinaryFile<uint16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::Int32:
-    err = readBinaryFile<int32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::UInt32:
-    err = readBinaryFile<uint32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::Int64:
-    err = readBinaryFile<int64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::UInt64:
-    err = readBinaryFile<uint64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::Float:
-    err = readBinaryFile<float>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<float>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::Double:
-    err = readBinaryFile<double>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<double>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::Bool:
-    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::SizeT:
-    err = readBinaryFile<size_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<size_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, memoryMapFile, mappedArray);
     break;
   case SIMPL::NumericTypes::Type::UnknownNumType:
     break;
   }
 
+  if(mappedArray != nullptr)
+  {
+    dca->getAttributeMatrix(getCreatedAttributeArrayPath())->addOrReplaceAttributeArray(mappedArray);
+  }
+
   if(err == RBR_FILE_NOT_OPEN)
   {
     setErrorCondition(RBR_FILE_NOT_OPEN, "Unable to open the specified file");
@@ -423,6 +512,10 @@ void RawBinaryReader::execute()
   {
     setErrorCondition(RBR_DA_NULL, "Failed DataArray cast");
   }
+  else if(err == RBR_DA_ERROR)
+  {
+    setErrorCondition(RBR_DA_ERROR, "Failed to allocate the DataArray");
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -570,6 +663,18 @@ uint64_t RawBinaryReader::getSkipHeaderBytes() const
   return m_SkipHeaderBytes;
 }
 
+// -----------------------------------------------------------------------------
+void RawBinaryReader::setMemoryMapFile(bool value)
+{
+  m_MemoryMapFile = value;
+}
+
+// -----------------------------------------------------------------------------
+bool RawBinaryReader::getMemoryMapFile() const
+{
+  return m_MemoryMapFile;
+}
+
 // -----------------------------------------------------------------------------
 void RawBinaryReader::setInputFile(const QString& value)
 {
@@ -4,6 +4,8 @@
 
 #include "ReadASCIIData.h"
 
+#include <algorithm>
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
@@ -14,9 +16,9 @@
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
 #include "SIMPLib/Utilities/SIMPLDataPathValidator.h"
-#include "SIMPLib/Utilities/StringOperations.h"
 
 #include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
+#include "SIMPLib/CoreFilters/util/DelimitedTextParser.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 
@@ -433,7 +435,6 @@ void ReadASCIIData::execute()
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
   QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
   int numLines = wizardData.numberOfLines;
   int beginIndex = wizardData.beginIndex;
 
@@ -511,74 +512,46 @@ void ReadASCIIData::execute()
     }
   }
 
-  int insertIndex = 0;
-
-  QFile inputFile(inputFilePath);
-  if(inputFile.open(QIODevice::ReadOnly))
+  DelimitedTextParser::Pointer textParser = DelimitedTextParser::New(inputFilePath);
+  if(!textParser->isOpen())
   {
-    QTextStream in(&inputFile);
+    return;
+  }
 
-    for(int i = 1; i < beginIndex; i++)
+  size_t numTuples = numLines - beginIndex + 1;
+  textParser->indexRows(static_cast<size_t>(beginIndex - 1), numTuples);
+
+  // The rows are parsed in parallel in blocks so progress can be reported and the filter canceled in between
+  const size_t blockSize = std::max(numTuples / 20, static_cast<size_t>(65536));
+  for(size_t startRow = 0; startRow < numTuples; startRow += blockSize)
+  {
+    size_t endRow = std::min(startRow + blockSize, numTuples);
+    DelimitedTextParser::Error error = textParser->parseRows(dataParsers, dataTypes.size(), delimiters, startRow, endRow);
+    if(error.type == DelimitedTextParser::ErrorType::InconsistentColumns)
+    {
+      QString ss = "Line " + QString::number(beginIndex + error.row) + " has an inconsistent number of columns.\n";
+      QTextStream out(&ss);
+      out << "Expecting " << dataTypes.size() << " but found " << error.numberOfTokens << "\n";
+      out << "Input line was:\n";
+      out << textParser->getRow(error.row);
+      setErrorCondition(INCONSISTENT_COLS, ss);
+      return;
+    }
+    if(error.type == DelimitedTextParser::ErrorType::ConversionFailure)
     {
-      // Skip to the first data line
-      in.readLine();
+      QString ss = error.message + "(line " + QString::number(beginIndex + error.row) + ", column " + QString::number(error.column) + ").";
+      setErrorCondition(CONVERSION_FAILURE, ss);
+      return;
     }
 
-    float threshold = 0.0f;
-    size_t numTuples = numLines - beginIndex + 1;
+    const float percentCompleted = (static_cast<float>(endRow) / numTuples) * 100.0f;
+    QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(static_cast<double>(percentCompleted), 0, 'f', 0);
+    notifyStatusMessage(ss);
 
-    for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
+    if(getCancel())
     {
-      QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
-
-      if(dataTypes.size() != tokens.size())
-      {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
-        setErrorCondition(INCONSISTENT_COLS, ss);
-        return;
-      }
-
-      for(int i = 0; i < dataParsers.size(); i++)
-      {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
-
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
-        {
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE, ss);
-          return;
-        }
-      }
-
-      const float percentCompleted = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-      if(percentCompleted > threshold)
-      {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(static_cast<double>(percentCompleted), 0, 'f', 0);
-        notifyStatusMessage(ss);
-        threshold = threshold + 5.0f;
-        if(threshold < percentCompleted)
-        {
-          threshold = percentCompleted;
-        }
-      }
-
-      if(getCancel())
-      {
-        return;
-      }
-
-      insertIndex++;
+      return;
     }
-    inputFile.close();
   }
 }
 
@@ -933,6 +933,67 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CompiledArrayCalculatorTest()
+  {
+    // Enough values that the compiled expression is split into several tiles
+    const size_t numTuples = 5000;
+    const size_t numComps = 3;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, numComps), "FloatArray", true);
+    Int16ArrayType::Pointer intArray = Int16ArrayType::CreateArray(numTuples, std::vector<size_t>(1, numComps), "IntArray", true);
+    for(size_t i = 0; i < numTuples * numComps; i++)
+    {
+      floatArray->setValue(i, static_cast<float>(i % 360) * 0.5f);
+      intArray->setValue(i, static_cast<int16_t>(i % 17) - 8);
+    }
+    am->insertOrAssign(floatArray);
+    am->insertOrAssign(intArray);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    DataArrayPath arrayPath("DataContainer", "AttributeMatrix", "NewArray");
+    ArrayCalculator::Pointer filter = ArrayCalculator::New();
+    filter->setDataContainerArray(dca);
+    filter->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    filter->setCalculatedArray(arrayPath);
+    filter->setUnits(ArrayCalculator::Degrees);
+    filter->setInfixEquation("sin(FloatArray) * (IntArray - 2 ^ 3) / abs(-4) + root(IntArray * IntArray, 2)");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    DoubleArrayType::Pointer result = dca->getPrereqArrayFromPath<DoubleArrayType>(filter.get(), arrayPath);
+    DREAM3D_REQUIRE(nullptr != result);
+    DREAM3D_REQUIRE_EQUAL(result->getNumberOfTuples(), numTuples);
+    DREAM3D_REQUIRE_EQUAL(result->getNumberOfComponents(), numComps);
+    for(size_t i = 0; i < numTuples * numComps; i++)
+    {
+      double f = static_cast<double>(floatArray->getValue(i));
+      double n = static_cast<double>(intArray->getValue(i));
+      double expected = sin(CalculatorOperator::toRadians(f)) * (n - 8.0) / 4.0 + CalculatorOperator::root(n * n, 2);
+      DREAM3D_REQUIRED(SIMPLibMath::closeEnough<double>(result->getValue(i), expected, 0.0001), ==, true);
+    }
+
+    // The result is converted to the output scalar type the same way as the per operator evaluation
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+    filter->setInfixEquation("IntArray[1] * 3 - 1");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    Int32ArrayType::Pointer intResult = dca->getPrereqArrayFromPath<Int32ArrayType>(filter.get(), arrayPath);
+    DREAM3D_REQUIRE(nullptr != intResult);
+    DREAM3D_REQUIRE_EQUAL(intResult->getNumberOfComponents(), 1);
+    for(size_t t = 0; t < numTuples; t++)
+    {
+      DREAM3D_REQUIRE_EQUAL(intResult->getValue(t), intArray->getComponent(t, 1) * 3 - 1);
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -942,6 +1003,7 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(SingleComponentArrayCalculatorTest())
     DREAM3D_REGISTER_TEST(MultiComponentArrayCalculatorTest())
+    DREAM3D_REGISTER_TEST(CompiledArrayCalculatorTest())
   }
 
 private:
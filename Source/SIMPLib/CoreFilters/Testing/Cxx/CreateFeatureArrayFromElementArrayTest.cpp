@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/util/FeatureReduction.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -338,6 +339,83 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  IDataArray::Pointer RunReduction(FeatureReduction::ReductionType type, int& err)
+  {
+    AbstractFilter::Pointer filter = FilterManager::Instance()->getFactoryFromClassName("CreateFeatureArrayFromElementArray")->create();
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer cellAttr = AttributeMatrix::New(std::vector<size_t>(1, 16), "Cell Attribute Matrix", AttributeMatrix::Type::Cell);
+    AttributeMatrix::Pointer featureAttr = AttributeMatrix::New(std::vector<size_t>(1, 5), "Feature Attribute Matrix", AttributeMatrix::Type::CellFeature);
+
+    // Feature 1 holds the values {1, 2, 5, 6}, feature 3 holds {9, 10, 9, 9} and feature 0 has no elements
+    std::vector<int32_t> ids = {1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4};
+    std::vector<float> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 9, 9, 15, 16};
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(16, std::string("FeatureIds"), true);
+    std::copy(ids.begin(), ids.end(), featureIds->begin());
+    FloatArrayType::Pointer cellData = FloatArrayType::CreateArray(16, std::string("CellData"), true);
+    std::copy(values.begin(), values.end(), cellData->begin());
+    cellAttr->insertOrAssign(featureIds);
+    cellAttr->insertOrAssign(cellData);
+    dc->addOrReplaceAttributeMatrix(cellAttr);
+    dc->addOrReplaceAttributeMatrix(featureAttr);
+    dca->addOrReplaceDataContainer(dc);
+
+    QVariant var;
+    var.setValue(DataArrayPath("DataContainer", "Cell Attribute Matrix", "CellData"));
+    DREAM3D_REQUIRE(filter->setProperty("SelectedCellArrayPath", var))
+    var.setValue(DataArrayPath("DataContainer", "Cell Attribute Matrix", "FeatureIds"));
+    DREAM3D_REQUIRE(filter->setProperty("FeatureIdsArrayPath", var))
+    var.setValue(DataArrayPath("DataContainer", "Feature Attribute Matrix", ""));
+    DREAM3D_REQUIRE(filter->setProperty("CellFeatureAttributeMatrixName", var))
+    DREAM3D_REQUIRE(filter->setProperty("CreatedArrayName", QString("CreatedArray")))
+    DREAM3D_REQUIRE(filter->setProperty("ReductionType", static_cast<int>(type)))
+
+    filter->execute();
+    err = filter->getErrorCode();
+    return featureAttr->getAttributeArray("CreatedArray");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename ArrayType>
+  void RequireFeatureValues(FeatureReduction::ReductionType type, const std::vector<typename ArrayType::value_type>& expected)
+  {
+    int err = 0;
+    IDataArray::Pointer created = RunReduction(type, err);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    typename ArrayType::Pointer array = std::dynamic_pointer_cast<ArrayType>(created);
+    DREAM3D_REQUIRE_VALID_POINTER(array.get())
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(array->getValue(i), expected[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReductionTypes()
+  {
+    RequireFeatureValues<FloatArrayType>(FeatureReduction::ReductionType::Last, {0, 6, 8, 9, 16});
+    RequireFeatureValues<FloatArrayType>(FeatureReduction::ReductionType::First, {0, 1, 3, 9, 11});
+    RequireFeatureValues<FloatArrayType>(FeatureReduction::ReductionType::Minimum, {0, 1, 3, 9, 11});
+    RequireFeatureValues<FloatArrayType>(FeatureReduction::ReductionType::Maximum, {0, 6, 8, 10, 16});
+    RequireFeatureValues<DoubleArrayType>(FeatureReduction::ReductionType::Sum, {0, 14, 22, 37, 54});
+    RequireFeatureValues<DoubleArrayType>(FeatureReduction::ReductionType::Mean, {0, 3.5, 5.5, 9.25, 13.5});
+    RequireFeatureValues<Int32ArrayType>(FeatureReduction::ReductionType::Count, {0, 4, 4, 4, 4});
+    RequireFeatureValues<FloatArrayType>(FeatureReduction::ReductionType::Mode, {0, 1, 3, 9, 11});
+
+    int err = 0;
+    RunReduction(static_cast<FeatureReduction::ReductionType>(8), err);
+    DREAM3D_REQUIRE_EQUAL(err, -11003)
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -349,6 +427,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestReductionTypes())
   }
 
 private:
@@ -35,7 +35,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -112,7 +114,8 @@ public:
     }
   }
 
-  void testCase(std::vector<std::vector<float>> vertices, std::vector<std::vector<float>> postCropVertices, float xMin, float yMin, float zMin, float xMax, float yMax, float zMax)
+  void testCase(std::vector<std::vector<float>> vertices, std::vector<std::vector<float>> postCropVertices, float xMin, float yMin, float zMin, float xMax, float yMax, float zMax,
+                bool useSpatialIndex = false)
   {
     static const QString k_DataContainerName("DataContainer");
     static const QString k_CroppedDataContainerName("CroppedDataContainer");
@@ -164,6 +167,15 @@ public:
     // Create Geometry
 
     VertexGeom::Pointer geom = VertexGeom::CreateGeometry(daVert, SIMPL::Geometry::VertexGeometry);
+    if(useSpatialIndex)
+    {
+      // Cache an index for vertices that are then moved in place, which the crop must not be misled by
+      std::vector<float> coords(daVert->begin(), daVert->end());
+      daVert->initializeWithValue(100.0f);
+      DREAM3D_REQUIRE_EQUAL(geom->findSpatialIndex(), 1)
+      std::copy(coords.begin(), coords.end(), daVert->begin());
+      DREAM3D_REQUIRE_VALID_POINTER(geom->getSpatialIndex().get())
+    }
 
     dc->setGeometry(geom);
 
@@ -266,6 +278,7 @@ public:
     std::vector<std::vector<float>> croppedVertices = {{1.0f, 1.0f, 0.0f}, {3.0f, 1.0f, 0.0f}};
 
     testCase(vertices, croppedVertices, 0.0f, 0.0f, 0.0f, 3.0f, 10.0f, 10.0f);
+    testCase(vertices, croppedVertices, 0.0f, 0.0f, 0.0f, 3.0f, 10.0f, 10.0f, true);
 
     // -1.0f <= x <=  2.0f
     //  0.0f <= y <= 10.0f
@@ -276,6 +289,7 @@ public:
     croppedVertices = {{1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 2.0f}};
 
     testCase(vertices, croppedVertices, -1.0f, 0.0f, 0.0f, 2.0f, 10.0f, 10.0f);
+    testCase(vertices, croppedVertices, -1.0f, 0.0f, 0.0f, 2.0f, 10.0f, 10.0f, true);
 
     // -1.0f <= x <=  2.0f
     //  2.3f <= y <= 10.0f
@@ -286,6 +300,7 @@ public:
     croppedVertices = {{-0.5f, 7.91f, 1.15f}, {1.0f, 9.99f, -4.399f}, {0.0214f, 2.300001f, 3.19999f}};
 
     testCase(vertices, croppedVertices, -1.0f, 2.3f, -4.4f, 2.0f, 10.0f, 3.2f);
+    testCase(vertices, croppedVertices, -1.0f, 2.3f, -4.4f, 2.0f, 10.0f, 3.2f, true);
   }
 
   // -----------------------------------------------------------------------------
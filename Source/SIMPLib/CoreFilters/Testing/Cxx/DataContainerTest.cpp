@@ -33,7 +33,9 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <tuple>
 
 #include <QtCore/QDir>
@@ -43,6 +45,9 @@
 #include <QtCore/QString>
 #include <QtCore/QVector>
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/CoreFilters/DataContainerWriter.h"
@@ -60,6 +65,8 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
@@ -109,6 +116,26 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString CompressedFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Compressed.dream3d");
+}
+
+QString ParallelCompressedFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_ParallelCompressed.dream3d");
+}
+
+QString RegionOfInterestFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_RegionOfInterest.dream3d");
+}
+
+QString FilterMaskFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_FilterMask.dream3d");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -143,6 +170,10 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::CompressedFile());
+    QFile::remove(DataContainerIOTest::ParallelCompressedFile());
+    QFile::remove(DataContainerIOTest::RegionOfInterestFile());
+    QFile::remove(DataContainerIOTest::FilterMaskFile());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -376,6 +407,460 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  // Checks the layout and filters of a dataset written by the DataContainerWriter
+  // -----------------------------------------------------------------------------
+  void CheckChunkedDataset(hid_t fileId, const QString& arrayName, const std::vector<hsize_t>& expectedChunkDims, int compressionLevel)
+  {
+    QString datasetPath = QString("/%1/Compressed/CellData/%2").arg(SIMPL::StringConstants::DataContainerGroupName, arrayName);
+    hid_t datasetId = H5Dopen2(fileId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(datasetId >= 0)
+    hid_t propertiesId = H5Dget_create_plist(datasetId);
+    DREAM3D_REQUIRE(propertiesId >= 0)
+
+    DREAM3D_REQUIRE(H5Pget_layout(propertiesId) == H5D_CHUNKED)
+    std::vector<hsize_t> chunkDims(expectedChunkDims.size(), 0);
+    int rank = H5Pget_chunk(propertiesId, static_cast<int>(chunkDims.size()), chunkDims.data());
+    DREAM3D_REQUIRE_EQUAL(rank, static_cast<int>(expectedChunkDims.size()))
+    DREAM3D_REQUIRE(chunkDims == expectedChunkDims)
+
+    // Shuffle is applied first, followed by deflate if the library provides it
+    bool hasDeflate = H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+    int numFilters = H5Pget_nfilters(propertiesId);
+    DREAM3D_REQUIRE_EQUAL(numFilters, hasDeflate ? 2 : 1)
+    unsigned int flags = 0;
+    size_t numValues = 1;
+    unsigned int values[1] = {0};
+    unsigned int filterConfig = 0;
+    H5Z_filter_t filter = H5Pget_filter2(propertiesId, 0, &flags, &numValues, values, 0, nullptr, &filterConfig);
+    DREAM3D_REQUIRE(filter == H5Z_FILTER_SHUFFLE)
+    if(hasDeflate)
+    {
+      numValues = 1;
+      filter = H5Pget_filter2(propertiesId, 1, &flags, &numValues, values, 0, nullptr, &filterConfig);
+      DREAM3D_REQUIRE(filter == H5Z_FILTER_DEFLATE)
+      DREAM3D_REQUIRE_EQUAL(values[0], static_cast<unsigned int>(compressionLevel))
+    }
+
+    H5Pclose(propertiesId);
+    H5Dclose(datasetId);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompressedDataContainerWriter()
+  {
+    const std::vector<size_t> tupleDims = {20, 30, 4};
+    const size_t numTuples = tupleDims[0] * tupleDims[1] * tupleDims[2];
+    const int compressionLevel = 6;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Compressed");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tupleDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(attrMat);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), SIMPL::CellData::FeatureIds, true);
+    FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 3), SIMPL::CellData::EulerAngles, true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i / 7));
+      eulers->setComponent(i, 0, i * 0.5f);
+      eulers->setComponent(i, 1, i * 0.25f);
+      eulers->setComponent(i, 2, i * 0.125f);
+    }
+    attrMat->insertOrAssign(featureIds);
+    attrMat->insertOrAssign(eulers);
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::CompressedFile());
+    writer->setWriteXdmfFile(false);
+    writer->setCompressionLevel(compressionLevel);
+    writer->setUseShuffleFilter(true);
+    writer->setChunkDimensions(IntVec3Type(10, 15, 2));
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    // The chunk shape is given in XYZ order and stored in HDF5 (ZYX) order with the components kept whole
+    {
+      hid_t fileId = QH5Utilities::openFile(DataContainerIOTest::CompressedFile(), true);
+      DREAM3D_REQUIRE(fileId >= 0)
+      H5ScopedFileSentinel sentinel(fileId, true);
+      CheckChunkedDataset(fileId, SIMPL::CellData::FeatureIds, {2, 15, 10, 1}, compressionLevel);
+      CheckChunkedDataset(fileId, SIMPL::CellData::EulerAngles, {2, 15, 10, 3}, compressionLevel);
+    }
+
+    DataContainerArray::Pointer readDca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::CompressedFile());
+    reader->setDataContainerArray(readDca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::CompressedFile()));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+
+    Int32ArrayType::Pointer readFeatureIds = readDca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, DataArrayPath("Compressed", "CellData", SIMPL::CellData::FeatureIds));
+    FloatArrayType::Pointer readEulers = readDca->getPrereqArrayFromPath<FloatArrayType>(nullptr, DataArrayPath("Compressed", "CellData", SIMPL::CellData::EulerAngles));
+    DREAM3D_REQUIRE_VALID_POINTER(readFeatureIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(readEulers.get())
+    DREAM3D_REQUIRE_EQUAL(readFeatureIds->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(readEulers->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE(std::equal(featureIds->begin(), featureIds->end(), readFeatureIds->begin()))
+    DREAM3D_REQUIRE(std::equal(eulers->begin(), eulers->end(), readEulers->begin()))
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reads several compressed arrays through the parallel reader, which reads them one layer of chunks
+  // at a time, and compares them with the arrays read serially in one H5Dread
+  // -----------------------------------------------------------------------------
+  void TestParallelCompressedRead()
+  {
+    // The chunk shape does not divide the dimensions so the edge chunks are partial
+    const std::vector<size_t> tupleDims = {21, 13, 5};
+    const size_t numTuples = tupleDims[0] * tupleDims[1] * tupleDims[2];
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Compressed");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tupleDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(attrMat);
+
+    Int8ArrayType::Pointer int8Array = Int8ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), "Int8", true);
+    UInt16ArrayType::Pointer uint16Array = UInt16ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 2), "UInt16", true);
+    Int32ArrayType::Pointer int32Array = Int32ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), "Int32", true);
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 3), "Float", true);
+    DoubleArrayType::Pointer doubleArray = DoubleArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), "Double", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int8Array->setValue(i, static_cast<int8_t>(i % 11));
+      uint16Array->setComponent(i, 0, static_cast<uint16_t>(i));
+      uint16Array->setComponent(i, 1, static_cast<uint16_t>(i / 3));
+      int32Array->setValue(i, static_cast<int32_t>(i / 7) - 50);
+      floatArray->setComponent(i, 0, i * 0.5f);
+      floatArray->setComponent(i, 1, i * -0.25f);
+      floatArray->setComponent(i, 2, 1.0f);
+      doubleArray->setValue(i, i * 0.001);
+    }
+    std::vector<IDataArray::Pointer> arrays = {int8Array, uint16Array, int32Array, floatArray, doubleArray};
+    for(const auto& array : arrays)
+    {
+      attrMat->insertOrAssign(array);
+    }
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::ParallelCompressedFile());
+    writer->setWriteXdmfFile(false);
+    writer->setCompressionLevel(6);
+    writer->setUseShuffleFilter(true);
+    writer->setChunkDimensions(IntVec3Type(8, 5, 2));
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    DataContainerArray::Pointer readDca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::ParallelCompressedFile());
+    reader->setDataContainerArray(readDca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::ParallelCompressedFile()));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+
+    hid_t fileId = QH5Utilities::openFile(DataContainerIOTest::ParallelCompressedFile(), true);
+    DREAM3D_REQUIRE(fileId >= 0)
+    H5ScopedFileSentinel sentinel(fileId, true);
+    QString amPath = QString("/%1/Compressed/CellData").arg(SIMPL::StringConstants::DataContainerGroupName);
+    hid_t amGid = H5Gopen(fileId, amPath.toLatin1().constData(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(amGid >= 0)
+    sentinel.addGroupId(amGid);
+
+    for(const auto& array : arrays)
+    {
+      IDataArray::Pointer parallelArray = readDca->getAttributeMatrix(DataArrayPath("Compressed", "CellData", ""))->getAttributeArray(array->getName());
+      IDataArray::Pointer serialArray = H5DataArrayReader::ReadIDataArray(amGid, array->getName(), false);
+      DREAM3D_REQUIRE_VALID_POINTER(parallelArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(serialArray.get())
+      DREAM3D_REQUIRE_EQUAL(parallelArray->getNumberOfTuples(), numTuples)
+      DREAM3D_REQUIRE_EQUAL(parallelArray->getSize(), serialArray->getSize())
+      DREAM3D_REQUIRE_EQUAL(parallelArray->getTypeSize(), serialArray->getTypeSize())
+      size_t numBytes = serialArray->getSize() * serialArray->getTypeSize();
+      DREAM3D_REQUIRE_EQUAL(::memcmp(parallelArray->getVoidPointer(0), serialArray->getVoidPointer(0), numBytes), 0)
+      DREAM3D_REQUIRE_EQUAL(::memcmp(array->getVoidPointer(0), serialArray->getVoidPointer(0), numBytes), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes the cell data of an image with one array stored in the opposite byte order, then compares
+  // the region of interest read through the hyperslab selection with the full read cropped in memory
+  // -----------------------------------------------------------------------------
+  void TestRegionOfInterestRead(bool compressed, bool loadArraysOnDemand)
+  {
+    const std::vector<size_t> tupleDims = {11, 7, 5};
+    const size_t numTuples = tupleDims[0] * tupleDims[1] * tupleDims[2];
+    const QString filePath = DataContainerIOTest::RegionOfInterestFile();
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Image");
+    dca->addOrReplaceDataContainer(dc);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(std::make_tuple(tupleDims[0], tupleDims[1], tupleDims[2]));
+    dc->setGeometry(image);
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tupleDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(attrMat);
+
+    Int32ArrayType::Pointer idsArray = Int32ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), "Ids", true);
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 3), "Float", true);
+    Int32ArrayType::Pointer swappedArray = Int32ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 2), "Swapped", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      idsArray->setValue(i, static_cast<int32_t>(i));
+      floatArray->setComponent(i, 0, i * 0.5f);
+      floatArray->setComponent(i, 1, i * -0.25f);
+      floatArray->setComponent(i, 2, static_cast<float>(i % 3));
+      swappedArray->setComponent(i, 0, static_cast<int32_t>(i * 1000 + 7));
+      swappedArray->setComponent(i, 1, -static_cast<int32_t>(i));
+    }
+    std::vector<IDataArray::Pointer> arrays = {idsArray, floatArray, swappedArray};
+    for(const auto& array : arrays)
+    {
+      attrMat->insertOrAssign(array);
+    }
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(filePath);
+    writer->setWriteXdmfFile(false);
+    if(compressed)
+    {
+      writer->setCompressionLevel(6);
+      writer->setUseShuffleFilter(true);
+      writer->setChunkDimensions(IntVec3Type(4, 3, 2));
+    }
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    // Rewrite one dataset in the opposite byte order, keeping its layout, filters and attributes
+    {
+      hid_t fileId = QH5Utilities::openFile(filePath, false);
+      DREAM3D_REQUIRE(fileId >= 0)
+      H5ScopedFileSentinel sentinel(fileId, true);
+      QString amPath = QString("/%1/Image/CellData").arg(SIMPL::StringConstants::DataContainerGroupName);
+      hid_t amGid = H5Gopen(fileId, amPath.toLatin1().constData(), H5P_DEFAULT);
+      DREAM3D_REQUIRE(amGid >= 0)
+      sentinel.addGroupId(amGid);
+
+      hid_t did = H5Dopen(amGid, "Swapped", H5P_DEFAULT);
+      DREAM3D_REQUIRE(did >= 0)
+      hid_t dataSpace = H5Dget_space(did);
+      hid_t createPlist = H5Dget_create_plist(did);
+      H5Dclose(did);
+      DREAM3D_REQUIRE(H5Ldelete(amGid, "Swapped", H5P_DEFAULT) >= 0)
+
+      hid_t swappedType = (H5Tget_order(H5T_NATIVE_INT32) == H5T_ORDER_LE) ? H5T_STD_I32BE : H5T_STD_I32LE;
+      did = H5Dcreate2(amGid, "Swapped", swappedType, dataSpace, H5P_DEFAULT, createPlist, H5P_DEFAULT);
+      herr_t err = (did >= 0) ? H5Dwrite(did, H5T_NATIVE_INT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, swappedArray->getPointer(0)) : -1;
+      if(did >= 0)
+      {
+        H5Dclose(did);
+      }
+      H5Pclose(createPlist);
+      H5Sclose(dataSpace);
+      DREAM3D_REQUIRE(err >= 0)
+      DREAM3D_REQUIRE(H5DataArrayWriter::writeDataArrayAttributes(amGid, swappedArray.get(), tupleDims, swappedArray->getComponentDimensions()) >= 0)
+    }
+
+    // The maximum z index is past the volume and is clamped to it
+    const std::vector<size_t> start = {2, 1, 1};
+    const std::vector<size_t> count = {7, 5, 4};
+    std::vector<AttributeMatrix::Pointer> readAttrMats;
+    for(bool useRegionOfInterest : {false, true})
+    {
+      DataContainerArray::Pointer readDca = DataContainerArray::New();
+      DataContainerReader::Pointer reader = DataContainerReader::New();
+      reader->setInputFile(filePath);
+      reader->setDataContainerArray(readDca);
+      reader->setLoadArraysOnDemand(loadArraysOnDemand);
+      reader->setUseRegionOfInterest(useRegionOfInterest);
+      reader->setMinRegionOfInterest(IntVec3Type(2, 1, 1));
+      reader->setMaxRegionOfInterest(IntVec3Type(8, 5, 20));
+      reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+      reader->execute();
+      DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+      AttributeMatrix::Pointer readAttrMat = readDca->getAttributeMatrix(DataArrayPath("Image", "CellData", ""));
+      DREAM3D_REQUIRE_VALID_POINTER(readAttrMat.get())
+      readAttrMats.push_back(readAttrMat);
+    }
+    DREAM3D_REQUIRE(readAttrMats[0]->getTupleDimensions() == tupleDims)
+    DREAM3D_REQUIRE(readAttrMats[1]->getTupleDimensions() == count)
+
+    for(const auto& array : arrays)
+    {
+      IDataArray::Pointer fullArray = readAttrMats[0]->getAttributeArray(array->getName());
+      IDataArray::Pointer croppedArray = readAttrMats[1]->getAttributeArray(array->getName());
+      DREAM3D_REQUIRE_VALID_POINTER(fullArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(croppedArray.get())
+      DREAM3D_REQUIRE_EQUAL(fullArray->loadDeferredValues(), 0)
+      DREAM3D_REQUIRE_EQUAL(croppedArray->loadDeferredValues(), 0)
+      DREAM3D_REQUIRE_EQUAL(croppedArray->getNumberOfTuples(), count[0] * count[1] * count[2])
+
+      // The full read matches what was written, so the swapped dataset was converted to native order
+      const size_t tupleBytes = array->getNumberOfComponents() * array->getTypeSize();
+      DREAM3D_REQUIRE_EQUAL(::memcmp(fullArray->getVoidPointer(0), array->getVoidPointer(0), numTuples * tupleBytes), 0)
+
+      const uint8_t* fullData = static_cast<const uint8_t*>(fullArray->getVoidPointer(0));
+      const uint8_t* croppedData = static_cast<const uint8_t*>(croppedArray->getVoidPointer(0));
+      size_t croppedTuple = 0;
+      for(size_t z = 0; z < count[2]; z++)
+      {
+        for(size_t y = 0; y < count[1]; y++)
+        {
+          for(size_t x = 0; x < count[0]; x++)
+          {
+            size_t fullTuple = ((start[2] + z) * tupleDims[1] + (start[1] + y)) * tupleDims[0] + (start[0] + x);
+            DREAM3D_REQUIRE_EQUAL(::memcmp(croppedData + croppedTuple * tupleBytes, fullData + fullTuple * tupleBytes, tupleBytes), 0)
+            croppedTuple++;
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Rewrites the last chunk of a compressed array, which extends past the array along every dimension,
+  // so that it is stored shuffled but not deflated, then checks that the reader honors the filter mask
+  // stored with that chunk
+  // -----------------------------------------------------------------------------
+  void TestFilterMaskRead(bool loadArraysOnDemand)
+  {
+#if H5_VERSION_GE(1, 10, 2)
+    const std::vector<size_t> tupleDims = {11, 7, 5};
+    const size_t numTuples = tupleDims[0] * tupleDims[1] * tupleDims[2];
+    const QString filePath = DataContainerIOTest::FilterMaskFile();
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Compressed");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tupleDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(attrMat);
+    Int32ArrayType::Pointer idsArray = Int32ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 2), "Ids", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      idsArray->setComponent(i, 0, static_cast<int32_t>(i * 3) - 100);
+      idsArray->setComponent(i, 1, static_cast<int32_t>(i % 17));
+    }
+    attrMat->insertOrAssign(idsArray);
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(filePath);
+    writer->setWriteXdmfFile(false);
+    writer->setCompressionLevel(6);
+    writer->setUseShuffleFilter(true);
+    writer->setChunkDimensions(IntVec3Type(4, 3, 2));
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    {
+      hid_t fileId = QH5Utilities::openFile(filePath, false);
+      DREAM3D_REQUIRE(fileId >= 0)
+      H5ScopedFileSentinel sentinel(fileId, true);
+      QString amPath = QString("/%1/Compressed/CellData").arg(SIMPL::StringConstants::DataContainerGroupName);
+      hid_t amGid = H5Gopen(fileId, amPath.toLatin1().constData(), H5P_DEFAULT);
+      DREAM3D_REQUIRE(amGid >= 0)
+      sentinel.addGroupId(amGid);
+
+      hid_t did = H5Dopen(amGid, "Ids", H5P_DEFAULT);
+      DREAM3D_REQUIRE(did >= 0)
+      hid_t dataSpace = H5Dget_space(did);
+      hid_t createPlist = H5Dget_create_plist(did);
+      int rank = H5Sget_simple_extent_ndims(dataSpace);
+      std::vector<hsize_t> dims(rank, 0);
+      std::vector<hsize_t> chunkDims(rank, 0);
+      H5Sget_simple_extent_dims(dataSpace, dims.data(), nullptr);
+      bool chunked = (H5Pget_chunk(createPlist, rank, chunkDims.data()) == rank);
+
+      // A set bit in the mask marks the filter at that position of the pipeline as not applied
+      uint32_t filterMask = 0;
+      bool shuffled = false;
+      int numFilters = H5Pget_nfilters(createPlist);
+      for(int i = 0; i < numFilters; i++)
+      {
+        unsigned int flags = 0;
+        size_t numValues = 0;
+        unsigned int filterConfig = 0;
+        H5Z_filter_t filter = H5Pget_filter2(createPlist, static_cast<unsigned>(i), &flags, &numValues, nullptr, 0, nullptr, &filterConfig);
+        if(filter == H5Z_FILTER_DEFLATE)
+        {
+          filterMask |= (1u << i);
+        }
+        shuffled = shuffled || (filter == H5Z_FILTER_SHUFFLE);
+      }
+      H5Pclose(createPlist);
+      H5Sclose(dataSpace);
+
+      // Fill the last chunk from the array in C order, leaving the part outside of the dataset zero
+      std::vector<hsize_t> offset(rank, 0);
+      size_t chunkElements = 1;
+      for(int d = 0; d < rank; d++)
+      {
+        offset[d] = (chunkDims[d] > 0) ? (dims[d] - 1) / chunkDims[d] * chunkDims[d] : 0;
+        chunkElements *= chunkDims[d];
+      }
+      std::vector<int32_t> chunk(chunkElements, 0);
+      for(size_t i = 0; chunked && i < chunkElements; i++)
+      {
+        size_t remainder = i;
+        size_t fileIndex = 0;
+        size_t stride = 1;
+        bool inside = true;
+        for(int d = rank - 1; d >= 0; d--)
+        {
+          hsize_t pos = offset[d] + remainder % chunkDims[d];
+          remainder /= chunkDims[d];
+          inside = inside && pos < dims[d];
+          fileIndex += pos * stride;
+          stride *= dims[d];
+        }
+        if(inside)
+        {
+          chunk[i] = idsArray->getValue(fileIndex);
+        }
+      }
+
+      const size_t typeSize = sizeof(int32_t);
+      std::vector<uint8_t> bytes(chunkElements * typeSize, 0);
+      const uint8_t* src = reinterpret_cast<const uint8_t*>(chunk.data());
+      for(size_t i = 0; i < chunkElements; i++)
+      {
+        for(size_t b = 0; b < typeSize; b++)
+        {
+          bytes[shuffled ? b * chunkElements + i : i * typeSize + b] = src[i * typeSize + b];
+        }
+      }
+      herr_t err = chunked ? H5Dwrite_chunk(did, H5P_DEFAULT, filterMask, offset.data(), bytes.size(), bytes.data()) : -1;
+      H5Dclose(did);
+      DREAM3D_REQUIRE(chunked)
+      DREAM3D_REQUIRE(filterMask != 0)
+      DREAM3D_REQUIRE(err >= 0)
+    }
+
+    DataContainerArray::Pointer readDca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(filePath);
+    reader->setDataContainerArray(readDca);
+    reader->setLoadArraysOnDemand(loadArraysOnDemand);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+
+    IDataArray::Pointer readArray = readDca->getAttributeMatrix(DataArrayPath("Compressed", "CellData", ""))->getAttributeArray("Ids");
+    DREAM3D_REQUIRE_VALID_POINTER(readArray.get())
+    DREAM3D_REQUIRE_EQUAL(readArray->loadDeferredValues(), 0)
+    DREAM3D_REQUIRE_EQUAL(readArray->getSize(), idsArray->getSize())
+    DREAM3D_REQUIRE_EQUAL(::memcmp(readArray->getVoidPointer(0), idsArray->getVoidPointer(0), idsArray->getSize() * sizeof(int32_t)), 0)
+#endif
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1196,6 +1681,13 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestCompressedDataContainerWriter())
+    DREAM3D_REGISTER_TEST(TestParallelCompressedRead())
+    DREAM3D_REGISTER_TEST(TestRegionOfInterestRead(false, false))
+    DREAM3D_REGISTER_TEST(TestRegionOfInterestRead(true, false))
+    DREAM3D_REGISTER_TEST(TestRegionOfInterestRead(true, true))
+    DREAM3D_REGISTER_TEST(TestFilterMaskRead(false))
+    DREAM3D_REGISTER_TEST(TestFilterMaskRead(true))
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
 
 #if REMOVE_TEST_FILES
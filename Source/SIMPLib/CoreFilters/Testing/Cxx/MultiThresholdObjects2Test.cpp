@@ -38,6 +38,7 @@
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects2.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -355,6 +356,77 @@ public:
     return 1;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunNestedComparisonSetTest()
+  {
+    // Enough tuples that the comparisons are evaluated over several tiles
+    const size_t numTuples = 10007;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("dc");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    UInt16ArrayType::Pointer dataU16 = UInt16ArrayType::CreateArray(numTuples, std::string("TestArrayUInt16"), true);
+    DoubleArrayType::Pointer dataD = DoubleArrayType::CreateArray(numTuples, std::string("TestArrayDouble"), true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      dataU16->setValue(i, static_cast<uint16_t>(i % 211));
+      dataD->setValue(i, static_cast<double>(i % 100) / 100.0);
+    }
+    am->insertOrAssign(dataU16);
+    am->insertOrAssign(dataD);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    // TestArrayUInt16 == 7 OR NOT(TestArrayUInt16 > 100 OR TestArrayDouble < 0.25)
+    ComparisonValue::Pointer equal = ComparisonValue::New();
+    equal->setAttributeArrayName(dataU16->getName());
+    equal->setCompOperator(SIMPL::Comparison::Operator_Equal);
+    equal->setCompValue(7);
+
+    ComparisonSet::Pointer childSet = ComparisonSet::New();
+    childSet->setUnionOperator(SIMPL::Union::Operator_Or);
+    childSet->setInvertComparison(true);
+
+    ComparisonValue::Pointer greater = ComparisonValue::New();
+    greater->setAttributeArrayName(dataU16->getName());
+    greater->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    greater->setCompValue(100);
+    childSet->addComparison(greater);
+
+    ComparisonValue::Pointer less = ComparisonValue::New();
+    less->setUnionOperator(SIMPL::Union::Operator_Or);
+    less->setAttributeArrayName(dataD->getName());
+    less->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    less->setCompValue(0.25);
+    childSet->addComparison(less);
+
+    ComparisonInputsAdvanced comp;
+    comp.setDataContainerName("dc");
+    comp.setAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName);
+    comp.addInput(equal);
+    comp.addInput(childSet);
+
+    MultiThresholdObjects2::Pointer filter = MultiThresholdObjects2::New();
+    filter->setDataContainerArray(dca);
+    filter->setSelectedThresholds(comp);
+    filter->setDestinationArrayName("Mask");
+    filter->setScalarType(SIMPL::ScalarTypes::Type::UInt8);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+    UInt8ArrayType::Pointer mask = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray("Mask"));
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      bool expected = dataU16->getValue(i) == 7 || !(dataU16->getValue(i) > 100 || dataD->getValue(i) < 0.25);
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), expected ? 1 : 0)
+    }
+
+    return 1;
+  }
+
   /**
    * @brief
    */
@@ -364,6 +436,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(RunComparisonValueTests())
     DREAM3D_REGISTER_TEST(RunComparisonSetTests())
+    DREAM3D_REGISTER_TEST(RunNestedComparisonSetTest())
   }
 
 private:
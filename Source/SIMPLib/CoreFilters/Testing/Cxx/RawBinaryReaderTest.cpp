@@ -48,6 +48,7 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
 /* Testing Notes:
@@ -63,6 +64,8 @@
  *  testCase5: This tests when the file size is larger than the allocated size and there is junk at the beginning and end of the file.
  *
  *  testCase6: This tests when skipHeaderBytes equals the file size
+ *
+ *  testCase7: This tests memory mapping the file and reading big endian data
  */
 
 /** we are going to use a fairly large array size because we want to exercise the
@@ -873,6 +876,105 @@ public:
     testCase6_TestPrimitives<double>(SIMPL::NumericTypes::Type::Double);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  typename DataArray<T>::Pointer testCase7_Read(SIMPL::NumericTypes::Type scalarType, size_t skipHeaderBytes, Detail::Endian endian, bool memoryMapFile)
+  {
+    std::vector<size_t> dims(1, k_ArraySize);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(dims, "AttributeMatrix", AttributeMatrix::Type::Any);
+    DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::DataContainerName);
+    m->addOrReplaceAttributeMatrix(am);
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addOrReplaceDataContainer(m);
+
+    RawBinaryReader::Pointer filt = createRawBinaryReaderFilter(scalarType, 1, skipHeaderBytes);
+    filt->setEndian(endian);
+    filt->setMemoryMapFile(memoryMapFile);
+    filt->setDataContainerArray(dca);
+    filt->execute();
+    int err = filt->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    return std::dynamic_pointer_cast<DataArray<T>>(am->getAttributeArray("Test_Array"));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  // testCase7: This tests memory mapping the file and reading big endian data
+  template <typename T>
+  void testCase7_Execute(SIMPL::NumericTypes::Type scalarType)
+  {
+    std::vector<T> values(k_ArraySize);
+    std::vector<T> junk(3, static_cast<T>(0));
+    for(size_t i = 0; i < k_ArraySize; ++i)
+    {
+      values[i] = static_cast<T>(i % 1000);
+    }
+
+    // The mapped array reads the values from the file, and changing it leaves the file alone
+    for(size_t junkSize : {size_t(0), junk.size()})
+    {
+      bool result = createAndWriteToFile(values.data(), values.size(), junkSize > 0 ? junk.data() : nullptr, junkSize, junkSize > 0 ? Detail::Start : Detail::None);
+      DREAM3D_REQUIRED(result, ==, true)
+
+      typename DataArray<T>::Pointer mapped = testCase7_Read<T>(scalarType, junkSize * sizeof(T), Detail::Little, true);
+      DREAM3D_REQUIRE_VALID_POINTER(mapped.get())
+      for(size_t i = 0; i < k_ArraySize; ++i)
+      {
+        DREAM3D_REQUIRE_EQUAL(mapped->getValue(i), values[i])
+      }
+      mapped->initializeWithValue(static_cast<T>(7));
+      mapped = DataArray<T>::NullPointer();
+
+      typename DataArray<T>::Pointer read = testCase7_Read<T>(scalarType, junkSize * sizeof(T), Detail::Little, false);
+      DREAM3D_REQUIRE_VALID_POINTER(read.get())
+      for(size_t i = 0; i < k_ArraySize; ++i)
+      {
+        DREAM3D_REQUIRE_EQUAL(read->getValue(i), values[i])
+      }
+    }
+
+    // Big endian values are swapped while they are copied, with and without the memory map option
+    std::vector<T> swapped(values);
+    for(auto& value : swapped)
+    {
+      SIMPLib::Endian::ByteSwapper::convert(value);
+    }
+    bool result = createAndWriteToFile(swapped.data(), swapped.size(), junk.data(), junk.size(), Detail::Start);
+    DREAM3D_REQUIRED(result, ==, true)
+    for(bool memoryMapFile : {false, true})
+    {
+      typename DataArray<T>::Pointer read = testCase7_Read<T>(scalarType, junk.size() * sizeof(T), Detail::Big, memoryMapFile);
+      DREAM3D_REQUIRE_VALID_POINTER(read.get())
+      for(size_t i = 0; i < k_ArraySize; ++i)
+      {
+        DREAM3D_REQUIRE_EQUAL(read->getValue(i), values[i])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void testCase7()
+  {
+    QDir dir(UnitTest::RawBinaryReaderTest::TestDir);
+    if(!dir.mkpath("."))
+    {
+      return;
+    }
+
+    testCase7_Execute<uint8_t>(SIMPL::NumericTypes::Type::UInt8);
+    testCase7_Execute<int16_t>(SIMPL::NumericTypes::Type::Int16);
+    testCase7_Execute<uint32_t>(SIMPL::NumericTypes::Type::UInt32);
+    testCase7_Execute<int64_t>(SIMPL::NumericTypes::Type::Int64);
+    testCase7_Execute<float>(SIMPL::NumericTypes::Type::Float);
+    testCase7_Execute<double>(SIMPL::NumericTypes::Type::Double);
+  }
+
   // -----------------------------------------------------------------------------
   //  Use unit test framework
   // -----------------------------------------------------------------------------
@@ -891,6 +993,7 @@ public:
     DREAM3D_REGISTER_TEST(testCase4())
     DREAM3D_REGISTER_TEST(testCase5())
     DREAM3D_REGISTER_TEST(testCase6())
+    DREAM3D_REGISTER_TEST(testCase7())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
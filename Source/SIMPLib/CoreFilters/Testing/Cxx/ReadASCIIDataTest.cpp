@@ -41,6 +41,7 @@
 #include "SIMPLib/CoreFilters/ReadASCIIData.h"
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -427,6 +428,100 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteMultiColumnFile(size_t numRows, size_t badRow)
+  {
+    QFile data(UnitTest::ReadASCIIDataTest::TestFile2);
+    if(data.open(QFile::WriteOnly))
+    {
+      QTextStream out(&data);
+      for(size_t row = 0; row < numRows; row++)
+      {
+        out << row << ",  " << (row == badRow ? QString("x") : QString::number(row * 0.25, 'f', 2)) << ",Name" << row << "\r\n";
+      }
+      data.close();
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunMultiColumnTest()
+  {
+    const size_t numRows = 150000;
+    const QString k_Ids("Ids");
+    const QString k_Values("Values");
+    const QString k_Names("Names");
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 1;
+    data.consecutiveDelimiters = true;
+    data.dataHeaders << k_Ids << k_Values << k_Names;
+    data.dataTypes << SIMPL::TypeNames::Int32 << SIMPL::TypeNames::Double << SIMPL::TypeNames::String;
+    data.delimiters.push_back(',');
+    data.delimiters.push_back(' ');
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile2;
+    data.numberOfLines = static_cast<int>(numRows);
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = std::vector<size_t>(1, numRows);
+
+    // Every row is parsed, wherever the rows end up in the parallel chunks
+    {
+      WriteMultiColumnFile(numRows, numRows);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCode();
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+
+      AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+      Int32ArrayType::Pointer ids = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(k_Ids));
+      DoubleArrayType::Pointer values = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray(k_Values));
+      StringDataArray::Pointer names = std::dynamic_pointer_cast<StringDataArray>(am->getAttributeArray(k_Names));
+      DREAM3D_REQUIRE_VALID_POINTER(ids.get())
+      DREAM3D_REQUIRE_VALID_POINTER(values.get())
+      DREAM3D_REQUIRE_VALID_POINTER(names.get())
+
+      for(size_t row = 0; row < numRows; row++)
+      {
+        DREAM3D_REQUIRE_EQUAL(ids->getValue(row), static_cast<int32_t>(row))
+        DREAM3D_REQUIRE_EQUAL(values->getValue(row), row * 0.25)
+        DREAM3D_REQUIRE_EQUAL(names->getValue(row), QString("Name%1").arg(row))
+      }
+    }
+
+    // A bad value in the last rows is still reported
+    {
+      WriteMultiColumnFile(numRows, numRows - 3);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCode();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::CONVERSION_FAILURE)
+    }
+
+    // A short file leaves the trailing rows empty
+    {
+      data.numberOfLines = static_cast<int>(numRows + 1);
+      data.tupleDims = std::vector<size_t>(1, numRows + 1);
+      WriteMultiColumnFile(numRows, numRows);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCode();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::INCONSISTENT_COLS)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -459,6 +554,7 @@ public:
     DREAM3D_REGISTER_TEST(RemoveTestFiles()) // In case the previous test asserted or stopped prematurely
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(RunMultiColumnTest())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
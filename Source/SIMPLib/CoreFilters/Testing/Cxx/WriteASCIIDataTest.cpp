@@ -33,12 +33,16 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
 #include <cstdlib>
 
 #include <iostream>
+#include <limits>
 #include <string>
 
+#include <QtCore/QFile>
 #include <QtCore/QString>
+#include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
@@ -79,6 +83,8 @@ public:
 #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::TestTempDir + "/" + k_ArrayName + k_Extension);
     QFile::remove(UnitTest::TestTempDir + "/" + "SingleFileMode.csv");
+    QFile::remove(UnitTest::TestTempDir + "/" + "Float_Data" + k_Extension);
+    QFile::remove(UnitTest::TestTempDir + "/" + "NumericSingleFileMode.csv");
 #endif
   }
 
@@ -179,6 +185,109 @@ public:
     DREAM3D_REQUIRE(err < 0)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray ReadFile(const QString& filePath)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE(file.open(QIODevice::ReadOnly | QIODevice::Text))
+    return file.readAll();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunNumericTest()
+  {
+    // Enough tuples that the rows are formatted in several parallel blocks
+    const size_t numTuples = 10000;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), "TestAttributeMatrix", AttributeMatrix::Type::Any);
+
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 2), "Float_Data", true);
+    DoubleArrayType::Pointer doubleArray = DoubleArrayType::CreateArray(numTuples, "Double_Data", true);
+    Int8ArrayType::Pointer int8Array = Int8ArrayType::CreateArray(numTuples, "Int8_Data", true);
+    UInt64ArrayType::Pointer uint64Array = UInt64ArrayType::CreateArray(numTuples, "UInt64_Data", true);
+    BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(numTuples, "Bool_Data", true);
+    StringDataArray::Pointer strArray = StringDataArray::CreateArray(numTuples, "String_Data", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      double value = (static_cast<double>(i) - 5000.0) / 7.0 * std::pow(10.0, static_cast<double>(i % 41) - 20.0);
+      floatArray->setComponent(i, 0, static_cast<float>(value));
+      floatArray->setComponent(i, 1, static_cast<float>(i) * 0.1f);
+      doubleArray->setValue(i, value);
+      int8Array->setValue(i, static_cast<int8_t>(i));
+      uint64Array->setValue(i, std::numeric_limits<uint64_t>::max() - i * 1234567);
+      boolArray->setValue(i, i % 3 == 0);
+      strArray->setValue(i, QString("Value %1").arg(i));
+    }
+    floatArray->setComponent(0, 0, std::numeric_limits<float>::quiet_NaN());
+    floatArray->setComponent(1, 0, std::numeric_limits<float>::infinity());
+    floatArray->setComponent(2, 0, -std::numeric_limits<float>::infinity());
+    floatArray->setComponent(3, 0, -0.0f);
+    doubleArray->setValue(0, std::numeric_limits<double>::quiet_NaN());
+    doubleArray->setValue(1, std::numeric_limits<double>::max());
+    doubleArray->setValue(2, std::numeric_limits<double>::denorm_min());
+
+    std::vector<IDataArray::Pointer> arrays = {floatArray, doubleArray, int8Array, uint64Array, boolArray, strArray};
+    std::vector<DataArrayPath> paths;
+    for(const auto& array : arrays)
+    {
+      am->insertOrAssign(array);
+      paths.push_back(DataArrayPath("DataContainer", "TestAttributeMatrix", array->getName()));
+    }
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    // Multi file mode writes the values as a default QTextStream does
+    WriteASCIIData::Pointer writer = WriteASCIIData::New();
+    writer->setDataContainerArray(dca);
+    writer->setSelectedDataArrayPaths({paths[0]});
+    writer->setOutputPath(UnitTest::TestTempDir);
+    writer->setDelimiter(WriteASCIIData::DelimiterType::Comma);
+    writer->setFileExtension(k_Extension);
+    writer->setMaxValPerLine(3);
+    writer->setOutputStyle(WriteASCIIData::MultiFile);
+    writer->execute();
+    int err = writer->getErrorCode();
+    DREAM3D_REQUIRE(err >= 0)
+
+    QString expected;
+    QTextStream out(&expected);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      out << floatArray->getComponent(i, 0) << ',' << floatArray->getComponent(i, 1);
+      out << (((i + 1) % 3 == 0) ? '\n' : ',');
+    }
+    out.flush();
+    DREAM3D_REQUIRE(ReadFile(UnitTest::TestTempDir + "/" + "Float_Data" + k_Extension) == expected.toLocal8Bit())
+
+    // Single file mode writes the values as IDataArray::printTuple does
+    QString singleFilePath = UnitTest::TestTempDir + "/" + "NumericSingleFileMode.csv";
+    writer->setSelectedDataArrayPaths(paths);
+    writer->setOutputStyle(WriteASCIIData::SingleFile);
+    writer->setOutputFilePath(singleFilePath);
+    writer->execute();
+    err = writer->getErrorCode();
+    DREAM3D_REQUIRE(err >= 0)
+
+    expected.clear();
+    out << "Float_Data_0,Float_Data_1,Double_Data,Int8_Data,UInt64_Data,Bool_Data,String_Data\n";
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      for(size_t c = 0; c < arrays.size(); c++)
+      {
+        arrays[c]->printTuple(out, i, ',');
+        out << ((c < arrays.size() - 1) ? ',' : '\n');
+      }
+    }
+    out.flush();
+    DREAM3D_REQUIRE(ReadFile(singleFilePath) == expected.toLocal8Bit())
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -192,6 +301,7 @@ public:
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
 #endif
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(RunNumericTest())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -34,12 +34,15 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "WriteASCIIData.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/CoreFilters/util/DelimitedTextWriter.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -81,44 +84,38 @@ public:
   {
     typename DataArrayType::Pointer inputArray = std::dynamic_pointer_cast<DataArrayType>(inputData);
 
-    QFile file(outputFile);
-    if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    DelimitedTextWriter::Pointer writer = DelimitedTextWriter::New(outputFile);
+    if(!writer->isOpen())
     {
       QString ss = QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
       filter->setErrorCondition(-11012, ss);
       return;
     }
 
-    QTextStream out(&file);
-
-    int32_t nComp = inputArray->getNumberOfComponents();
-
-    TInputType* inputArrayPtr = inputArray->getPointer(0);
-    size_t nTuples = inputArray->getNumberOfTuples();
+    const size_t nComp = inputArray->getNumberOfComponents();
+    const TInputType* inputArrayPtr = inputArray->getPointer(0);
+    const size_t nTuples = inputArray->getNumberOfTuples();
 
-    int32_t recCount = 0;
-    for(size_t i = 0; i < nTuples; i++)
-    {
-      for(int32_t j = 0; j < nComp; j++)
+    // Every MaxValPerLine'th tuple ends a line, all others are followed by the delimiter
+    auto formatTuple = [=](std::string& buffer, size_t i) {
+      for(size_t j = 0; j < nComp; j++)
       {
-        out << inputArrayPtr[i * nComp + j];
+        DelimitedTextWriter::AppendValue(buffer, inputArrayPtr[i * nComp + j]);
         if(j < nComp - 1)
         {
-          out << delimiter;
+          buffer.push_back(delimiter);
         }
       }
-      recCount++;
+      buffer.push_back((MaxValPerLine <= 1 || (i + 1) % static_cast<size_t>(MaxValPerLine) == 0) ? '\n' : delimiter);
+    };
 
-      if(recCount >= MaxValPerLine)
-      {
-        out << '\n';
-        recCount = 0;
-      }
-      else
-      {
-        out << delimiter;
-      }
+    if(!writer->writeRows(0, nTuples, formatTuple))
+    {
+      QString ss = QObject::tr("Error writing to the output file: '%1'").arg(outputFile);
+      filter->setErrorCondition(-11013, ss);
+      return;
     }
+    filter->notifyStatusMessage(writer->getThroughputMessage());
   }
 };
 
@@ -407,21 +404,22 @@ void WriteASCIIData::writeSingleFileOutput()
     return;
   }
 
-  QFile file(getOutputFilePath());
-  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  DelimitedTextWriter::Pointer writer = DelimitedTextWriter::New(getOutputFilePath());
+  if(!writer->isOpen())
   {
     QString ss = QObject::tr("Output file could not be opened: %1").arg(getOutputFilePath());
     setErrorCondition(-11021, ss);
     return;
   }
 
-  QTextStream outFile(&file);
-
   std::vector<IDataArray::Pointer> data;
+  std::vector<DelimitedTextWriter::RowFormatter> formatters;
 
   // *********** Print the header Line *******************
   char delimiter = lookupDelimiter();
 
+  QString header;
+  QTextStream outFile(&header);
   for(int32_t i = 0; i < m_SelectedWeakPtrVector.count(); i++)
   {
     IDataArray::Pointer selectedArrayPtr = m_SelectedWeakPtrVector.at(i).lock();
@@ -446,8 +444,16 @@ void WriteASCIIData::writeSingleFileOutput()
     }
     // Get the IDataArray from the DataContainer
     data.push_back(selectedArrayPtr);
+    formatters.push_back(DelimitedTextWriter::CreateTupleFormatter(selectedArrayPtr, delimiter));
   }
   outFile << "\n";
+  outFile.flush();
+  if(!writer->write(header))
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputFilePath());
+    setErrorCondition(-11022, ss);
+    return;
+  }
 
   // Get the number of tuples in the arrays
   size_t numTuples = 0;
@@ -456,37 +462,39 @@ void WriteASCIIData::writeSingleFileOutput()
     numTuples = data[0]->getNumberOfTuples();
   }
 
-  float threshold = 0.0f;
+  // Print a row of data
   size_t numArrays = data.size();
-  for(size_t i = 0; i < numTuples; ++i)
-  {
-    float percentIncrement = static_cast<float>(i) / static_cast<float>(numTuples) * 100.0f;
-    if(percentIncrement > threshold)
+  auto formatRow = [&formatters, numArrays, delimiter](std::string& buffer, size_t i) {
+    for(size_t c = 0; c < numArrays; c++)
     {
-      QString ss = QObject::tr("Writing Output: %1%").arg(static_cast<int32_t>(percentIncrement));
-      notifyStatusMessage(ss);
-      threshold = threshold + 5.0f;
-      if(threshold < percentIncrement)
+      formatters[c](buffer, i);
+      if(c < numArrays - 1) // Last column
       {
-        threshold = percentIncrement;
+        buffer.push_back(delimiter);
       }
     }
+    buffer.push_back('\n');
+  };
 
-    // Print a row of data
-    for(size_t c = 0; c < numArrays; c++)
+  // The rows are written in blocks so progress can be reported in between
+  size_t blockSize = std::max(numTuples / 20, static_cast<size_t>(65536));
+  for(size_t startRow = 0; startRow < numTuples; startRow += blockSize)
+  {
+    QString ss = QObject::tr("Writing Output: %1%").arg(static_cast<int32_t>(static_cast<float>(startRow) / static_cast<float>(numTuples) * 100.0f));
+    notifyStatusMessage(ss);
+    if(getCancel())
     {
-      QString s;
-      QTextStream out(&s);
-      data.at(c)->printTuple(out, i, delimiter);
+      return;
+    }
 
-      if(c < numArrays - 1) // Last column
-      {
-        out << delimiter;
-      }
-      outFile << s;
+    if(!writer->writeRows(startRow, std::min(startRow + blockSize, numTuples), formatRow))
+    {
+      ss = QObject::tr("Error writing to the output file: %1").arg(getOutputFilePath());
+      setErrorCondition(-11022, ss);
+      return;
     }
-    outFile << "\n";
   }
+  notifyStatusMessage(writer->getThroughputMessage());
 }
 
 // -----------------------------------------------------------------------------
@@ -496,35 +504,30 @@ void WriteASCIIData::writeStringArray(const IDataArray::Pointer& inputData, cons
 {
   StringDataArray::Pointer inputArray = std::dynamic_pointer_cast<StringDataArray>(inputData);
 
-  QFile file(outputFile);
-  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  DelimitedTextWriter::Pointer writer = DelimitedTextWriter::New(outputFile);
+  if(!writer->isOpen())
   {
     QString ss = QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
     setErrorCondition(-11011, ss);
     return;
   }
 
-  QTextStream out(&file);
-
   size_t nTuples = inputArray->getNumberOfTuples();
+  int32_t maxValPerLine = getMaxValPerLine();
 
-  int32_t recCount = 0;
-  for(size_t i = 0; i < nTuples; i++)
-  {
-    out << inputArray->getValue(i);
-
-    recCount++;
+  auto formatValue = [inputArray, maxValPerLine, delimiter](std::string& buffer, size_t i) {
+    QByteArray bytes = inputArray->getValue(i).toLocal8Bit();
+    buffer.append(bytes.constData(), static_cast<size_t>(bytes.size()));
+    buffer.push_back((maxValPerLine <= 1 || (i + 1) % static_cast<size_t>(maxValPerLine) == 0) ? '\n' : delimiter);
+  };
 
-    if(recCount >= getMaxValPerLine())
-    {
-      out << '\n';
-      recCount = 0;
-    }
-    else
-    {
-      out << delimiter;
-    }
+  if(!writer->writeRows(0, nTuples, formatValue))
+  {
+    QString ss = QObject::tr("Error writing to the output file: '%1'").arg(outputFile);
+    setErrorCondition(-11014, ss);
+    return;
   }
+  notifyStatusMessage(writer->getThroughputMessage());
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ ABSOperator::ABSOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("abs");
+  setOperation(Operation::Abs);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ ACosOperator::ACosOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("acos");
+  setOperation(Operation::ACos);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ ASinOperator::ASinOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("asin");
+  setOperation(Operation::ASin);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ ATanOperator::ATanOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("atan");
+  setOperation(Operation::ATan);
 }
 
 // -----------------------------------------------------------------------------
@@ -100,6 +100,20 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief Parses the UTF-8 token between first and last into the data array at index. The
+   * default implementation converts the token to a QString and calls parse(const QString&, size_t).
+   * Tokens for different indices may be parsed concurrently.
+   * @param first
+   * @param last
+   * @param index
+   * @return
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* first, const char* last, size_t index)
+  {
+    return parse(QString::fromUtf8(first, static_cast<int>(last - first)), index);
+  }
+
 protected:
   AbstractDataParser() = default;
 
@@ -177,6 +191,23 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* first, const char* last, size_t index) override
+  {
+    using ValueType = typename ArrayType::value_type;
+    if constexpr(std::is_arithmetic<ValueType>::value)
+    {
+      ValueType value = static_cast<ValueType>(0);
+      if(ParserFunctor::FromChars(first, last, value))
+      {
+        ParserFunctor::ErrorObject obj;
+        obj.ok = true;
+        (*m_Ptr).setValue(index, value);
+        return obj;
+      }
+    }
+    return AbstractDataParser::parse(first, last, index);
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
@@ -48,6 +48,7 @@ AdditionOperator::AdditionOperator()
 {
   setPrecedence(A_Precedence);
   setInfixToken("+");
+  setOperation(Operation::Addition);
 }
 
 // -----------------------------------------------------------------------------
@@ -79,23 +79,29 @@ public:
 
   IDataArray::Pointer getArray() override
   {
-    return m_Array;
+    return doubleArray();
   }
 
-  void setValue(int i, double val) override
+  IDataArray::Pointer getSourceArray() override
   {
-    m_Array->setValue(i, val);
+    return m_Source;
   }
 
-  double getValue(int i) override
+  void setValue(size_t i, double val) override
   {
-    if(m_Array->getNumberOfTuples() > 1)
+    doubleArray()->setValue(i, val);
+  }
+
+  double getValue(size_t i) override
+  {
+    const DoubleArrayType::Pointer& array = doubleArray();
+    if(array->getNumberOfTuples() > 1)
     {
-      return static_cast<double>(m_Array->getValue(i));
+      return static_cast<double>(array->getValue(i));
     }
-    if(m_Array->getNumberOfTuples() == 1)
+    if(array->getNumberOfTuples() == 1)
     {
-      return static_cast<double>(m_Array->getValue(0));
+      return static_cast<double>(array->getValue(0));
     }
     // ERROR: The array is empty!
     return 0.0;
@@ -108,16 +114,16 @@ public:
 
   DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) override
   {
-    if(c >= 0 && c <= m_Array->getNumberOfComponents())
+    if(c >= 0 && c <= m_Source->getNumberOfComponents())
     {
-      if(m_Array->getNumberOfComponents() > 1)
+      if(m_Source->getNumberOfComponents() > 1)
       {
-        DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(m_Array->getNumberOfTuples(), {1}, m_Array->getName(), allocate);
+        DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(m_Source->getNumberOfTuples(), {1}, m_Source->getName(), allocate);
         if(allocate)
         {
-          for(int i = 0; i < m_Array->getNumberOfTuples(); i++)
+          for(size_t i = 0; i < m_Source->getNumberOfTuples(); i++)
           {
-            newArray->setComponent(i, 0, m_Array->getComponent(i, c));
+            newArray->setComponent(i, 0, static_cast<double>(m_Source->getComponent(i, c)));
           }
         }
 
@@ -141,21 +147,40 @@ protected:
 
   CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate)
   : ICalculatorArray()
+  , m_Source(dataArray)
   , m_Type(type)
+  , m_Allocate(allocate)
   {
-    m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), allocate);
-    if(allocate)
-    {
-      for(int i = 0; i < dataArray->getSize(); i++)
-      {
-        m_Array->setValue(i, static_cast<double>(dataArray->getValue(i)));
-      }
-    }
   }
 
 private:
+  typename DataArray<T>::Pointer m_Source;
   DoubleArrayType::Pointer m_Array;
   ValueType m_Type;
+  bool m_Allocate = true;
+
+  /**
+   * @brief Returns the values of the source array converted to double. The conversion
+   * is only done the first time it is needed, so arrays that are evaluated through a
+   * CalculatorProgram are never copied.
+   * @return
+   */
+  const DoubleArrayType::Pointer& doubleArray()
+  {
+    if(nullptr == m_Array)
+    {
+      m_Array = DoubleArrayType::CreateArray(m_Source->getNumberOfTuples(), m_Source->getComponentDimensions(), m_Source->getName(), m_Allocate);
+      if(m_Allocate)
+      {
+        size_t count = m_Source->getSize();
+        for(size_t i = 0; i < count; i++)
+        {
+          m_Array->setValue(i, static_cast<double>(m_Source->getValue(i)));
+        }
+      }
+    }
+    return m_Array;
+  }
 
 public:
   CalculatorArray(const CalculatorArray&) = delete;            // Copy Constructor Not Implemented
@@ -79,6 +79,22 @@ CalculatorOperator::OperatorType CalculatorOperator::getOperatorType()
   return m_OperatorType;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorOperator::Operation CalculatorOperator::getOperation() const
+{
+  return m_Operation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorOperator::setOperation(Operation operation)
+{
+  m_Operation = operation;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -56,6 +56,37 @@ public:
     Binary
   };
 
+  /**
+   * @brief Identifies the mathematical function an operator applies so that an
+   * expression can be compiled into a CalculatorProgram instead of being
+   * evaluated operator by operator.
+   */
+  enum class Operation
+  {
+    Unknown,
+    Addition,
+    Subtraction,
+    Multiplication,
+    Division,
+    Pow,
+    Root,
+    Log,
+    Negative,
+    Abs,
+    Ceil,
+    Floor,
+    Exp,
+    Ln,
+    Log10,
+    Sqrt,
+    Sin,
+    Cos,
+    Tan,
+    ASin,
+    ACos,
+    ATan
+  };
+
   using Self = CalculatorOperator;
   using Pointer = std::shared_ptr<Self>;
   using ConstPointer = std::shared_ptr<const Self>;
@@ -74,6 +105,10 @@ public:
 
   OperatorType getOperatorType();
 
+  Operation getOperation() const;
+
+  static double root(double base, double root);
+
 protected:
   CalculatorOperator();
 
@@ -87,16 +122,17 @@ protected:
     E_Precedence
   };
 
-  double root(double base, double root);
-
   Precedence getPrecedence();
   void setPrecedence(Precedence precedence);
 
   void setOperatorType(OperatorType type);
 
+  void setOperation(Operation operation);
+
 private:
   Precedence m_Precedence = {Unknown_Precedence};
   OperatorType m_OperatorType;
+  Operation m_Operation = {Operation::Unknown};
 
 public:
   CalculatorOperator(const CalculatorOperator&) = delete;            // Copy Constructor Not Implemented
@@ -123,12 +159,12 @@ public:
       newArray = DoubleArrayType::CreateArray(array2->getArray()->getNumberOfTuples(), array2->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName(), true);                    \
     }                                                                                                                                                                                                  \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < static_cast<int>(newArray->getNumberOfTuples()); i++)                                                                                                                           \
+    size_t numComps = newArray->getNumberOfComponents();                                                                                                                                               \
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                          \
     {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+      for(size_t c = 0; c < numComps; c++)                                                                                                                                                             \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
+        size_t index = numComps * i + c;                                                                                                                                                               \
         double num1 = array1->getValue(index);                                                                                                                                                         \
         double num2 = array2->getValue(index);                                                                                                                                                         \
         newArray->setValue(index, func(num2, num1));                                                                                                                                                   \
@@ -0,0 +1,530 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "CalculatorProgram.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "ICalculatorArray.h"
+
+namespace
+{
+using Operation = CalculatorOperator::Operation;
+using LoadFunction = void (*)(const void* data, size_t start, size_t count, double* values);
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void LoadValues(const void* data, size_t start, size_t count, double* values)
+{
+  const T* ptr = static_cast<const T*>(data) + start;
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = static_cast<double>(ptr[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+LoadFunction LoadFunctionFor(const IDataArray::Pointer& array)
+{
+  return nullptr != std::dynamic_pointer_cast<DataArray<T>>(array) ? LoadValues<T> : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+LoadFunction GetLoadFunction(const IDataArray::Pointer& array)
+{
+  std::array<LoadFunction, 11> loaders = {LoadFunctionFor<float>(array),    LoadFunctionFor<double>(array),   LoadFunctionFor<int8_t>(array),  LoadFunctionFor<uint8_t>(array),
+                                          LoadFunctionFor<int16_t>(array),  LoadFunctionFor<uint16_t>(array), LoadFunctionFor<int32_t>(array), LoadFunctionFor<uint32_t>(array),
+                                          LoadFunctionFor<int64_t>(array),  LoadFunctionFor<uint64_t>(array), LoadFunctionFor<bool>(array)};
+  for(const auto& load : loaders)
+  {
+    if(nullptr != load)
+    {
+      return load;
+    }
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+bool IsBinary(Operation operation)
+{
+  switch(operation)
+  {
+  case Operation::Addition:
+  case Operation::Subtraction:
+  case Operation::Multiplication:
+  case Operation::Division:
+  case Operation::Pow:
+  case Operation::Root:
+  case Operation::Log:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Calls visitor with a function object that computes the unary operation. The
+ * math matches the CREATE_NEW_ARRAY_* macros used by the operators themselves.
+ */
+template <typename Visitor>
+bool VisitUnary(Operation operation, bool degrees, Visitor&& visitor)
+{
+  switch(operation)
+  {
+  case Operation::Negative:
+    visitor([](double x) { return -1 * x; });
+    return true;
+  case Operation::Abs:
+    visitor([](double x) { return std::fabs(x); });
+    return true;
+  case Operation::Ceil:
+    visitor([](double x) { return std::ceil(x); });
+    return true;
+  case Operation::Floor:
+    visitor([](double x) { return std::floor(x); });
+    return true;
+  case Operation::Exp:
+    visitor([](double x) { return std::exp(x); });
+    return true;
+  case Operation::Ln:
+    visitor([](double x) { return std::log(x); });
+    return true;
+  case Operation::Log10:
+    visitor([](double x) { return std::log10(x); });
+    return true;
+  case Operation::Sqrt:
+    visitor([](double x) { return std::sqrt(x); });
+    return true;
+  case Operation::Sin:
+    if(degrees)
+    {
+      visitor([](double x) { return std::sin(CalculatorOperator::toRadians(x)); });
+    }
+    else
+    {
+      visitor([](double x) { return std::sin(x); });
+    }
+    return true;
+  case Operation::Cos:
+    if(degrees)
+    {
+      visitor([](double x) { return std::cos(CalculatorOperator::toRadians(x)); });
+    }
+    else
+    {
+      visitor([](double x) { return std::cos(x); });
+    }
+    return true;
+  case Operation::Tan:
+    if(degrees)
+    {
+      visitor([](double x) { return std::tan(CalculatorOperator::toRadians(x)); });
+    }
+    else
+    {
+      visitor([](double x) { return std::tan(x); });
+    }
+    return true;
+  case Operation::ASin:
+    if(degrees)
+    {
+      visitor([](double x) { return CalculatorOperator::toDegrees(std::asin(x)); });
+    }
+    else
+    {
+      visitor([](double x) { return std::asin(x); });
+    }
+    return true;
+  case Operation::ACos:
+    if(degrees)
+    {
+      visitor([](double x) { return CalculatorOperator::toDegrees(std::acos(x)); });
+    }
+    else
+    {
+      visitor([](double x) { return std::acos(x); });
+    }
+    return true;
+  case Operation::ATan:
+    if(degrees)
+    {
+      visitor([](double x) { return CalculatorOperator::toDegrees(std::atan(x)); });
+    }
+    else
+    {
+      visitor([](double x) { return std::atan(x); });
+    }
+    return true;
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Calls visitor with a function object that computes the binary operation. lhs is
+ * the operand that was pushed first, so "a - b" and "log(a, b)" are computed as func(a, b).
+ */
+template <typename Visitor>
+bool VisitBinary(Operation operation, Visitor&& visitor)
+{
+  switch(operation)
+  {
+  case Operation::Addition:
+    visitor([](double lhs, double rhs) { return lhs + rhs; });
+    return true;
+  case Operation::Subtraction:
+    visitor([](double lhs, double rhs) { return lhs - rhs; });
+    return true;
+  case Operation::Multiplication:
+    visitor([](double lhs, double rhs) { return lhs * rhs; });
+    return true;
+  case Operation::Division:
+    visitor([](double lhs, double rhs) { return lhs / rhs; });
+    return true;
+  case Operation::Pow:
+    visitor([](double lhs, double rhs) { return std::pow(lhs, rhs); });
+    return true;
+  case Operation::Root:
+    visitor([](double lhs, double rhs) { return CalculatorOperator::root(lhs, rhs); });
+    return true;
+  case Operation::Log:
+    visitor([](double lhs, double rhs) { return std::log(rhs) / std::log(lhs); });
+    return true;
+  default:
+    return false;
+  }
+}
+
+struct StackEntry
+{
+  bool isConstant = false;
+  double value = 0.0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorProgram::CalculatorProgram() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorProgram::~CalculatorProgram() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorProgram::Pointer CalculatorProgram::Compile(const QVector<CalculatorItem::Pointer>& rpn, bool degrees)
+{
+  Pointer program = Pointer(new CalculatorProgram());
+  program->m_Degrees = degrees;
+
+  std::vector<StackEntry> stack;
+  size_t depth = 0;
+  size_t numValues = 0;
+
+  for(const auto& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    CalculatorOperator::Pointer calcOperator = std::dynamic_pointer_cast<CalculatorOperator>(item);
+    if(nullptr != calcArray && calcArray->getType() == ICalculatorArray::Array)
+    {
+      IDataArray::Pointer array = calcArray->getSourceArray();
+      Source source;
+      source.array = array;
+      source.load = GetLoadFunction(array);
+      if(nullptr == array || nullptr == source.load || nullptr == array->getVoidPointer(0))
+      {
+        return NullPointer();
+      }
+
+      if(program->m_Sources.empty())
+      {
+        program->m_NumberOfTuples = array->getNumberOfTuples();
+        program->m_ComponentDimensions = array->getComponentDimensions();
+        numValues = array->getSize();
+      }
+      else if(array->getSize() != numValues)
+      {
+        return NullPointer();
+      }
+
+      Instruction instruction;
+      instruction.code = Code::Load;
+      instruction.source = program->m_Sources.size();
+      program->m_Instructions.push_back(instruction);
+      program->m_Sources.push_back(source);
+
+      stack.push_back(StackEntry());
+      depth++;
+      program->m_StackDepth = std::max(program->m_StackDepth, depth);
+    }
+    else if(nullptr != calcArray)
+    {
+      // Numbers only ever have a single value
+      StackEntry entry;
+      entry.isConstant = true;
+      entry.value = calcArray->getValue(0);
+      stack.push_back(entry);
+    }
+    else if(nullptr != calcOperator && IsBinary(calcOperator->getOperation()))
+    {
+      if(stack.size() < 2)
+      {
+        return NullPointer();
+      }
+      StackEntry rhs = stack.back();
+      stack.pop_back();
+      StackEntry& lhs = stack.back();
+
+      if(lhs.isConstant && rhs.isConstant)
+      {
+        VisitBinary(calcOperator->getOperation(), [&lhs, &rhs](auto func) { lhs.value = func(lhs.value, rhs.value); });
+        continue;
+      }
+
+      Instruction instruction;
+      instruction.code = Code::Binary;
+      instruction.operation = calcOperator->getOperation();
+      instruction.lhsIsConstant = lhs.isConstant;
+      instruction.rhsIsConstant = rhs.isConstant;
+      instruction.constant = lhs.isConstant ? lhs.value : rhs.value;
+      program->m_Instructions.push_back(instruction);
+
+      if(!lhs.isConstant && !rhs.isConstant)
+      {
+        depth--;
+      }
+      lhs.isConstant = false;
+    }
+    else if(nullptr != calcOperator && calcOperator->getOperation() != Operation::Unknown)
+    {
+      if(stack.empty())
+      {
+        return NullPointer();
+      }
+      StackEntry& entry = stack.back();
+
+      if(entry.isConstant)
+      {
+        VisitUnary(calcOperator->getOperation(), degrees, [&entry](auto func) { entry.value = func(entry.value); });
+        continue;
+      }
+
+      Instruction instruction;
+      instruction.code = Code::Unary;
+      instruction.operation = calcOperator->getOperation();
+      program->m_Instructions.push_back(instruction);
+    }
+    else
+    {
+      return NullPointer();
+    }
+  }
+
+  // The expression must reduce to a single array
+  if(stack.size() != 1 || stack.front().isConstant)
+  {
+    return NullPointer();
+  }
+
+  return program;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CalculatorProgram::getNumberOfTuples() const
+{
+  return m_NumberOfTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> CalculatorProgram::getComponentDimensions() const
+{
+  return m_ComponentDimensions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorProgram::evaluateTile(size_t start, size_t count, double* stack) const
+{
+  size_t depth = 0;
+  for(const auto& instruction : m_Instructions)
+  {
+    switch(instruction.code)
+    {
+    case Code::Load:
+    {
+      const Source& source = m_Sources[instruction.source];
+      source.load(source.array->getVoidPointer(0), start, count, stack + depth * k_TileSize);
+      depth++;
+      break;
+    }
+    case Code::Unary:
+    {
+      double* values = stack + (depth - 1) * k_TileSize;
+      VisitUnary(instruction.operation, m_Degrees, [values, count](auto func) {
+        for(size_t i = 0; i < count; i++)
+        {
+          values[i] = func(values[i]);
+        }
+      });
+      break;
+    }
+    case Code::Binary:
+    {
+      double constant = instruction.constant;
+      if(instruction.lhsIsConstant)
+      {
+        double* values = stack + (depth - 1) * k_TileSize;
+        VisitBinary(instruction.operation, [values, count, constant](auto func) {
+          for(size_t i = 0; i < count; i++)
+          {
+            values[i] = func(constant, values[i]);
+          }
+        });
+      }
+      else if(instruction.rhsIsConstant)
+      {
+        double* values = stack + (depth - 1) * k_TileSize;
+        VisitBinary(instruction.operation, [values, count, constant](auto func) {
+          for(size_t i = 0; i < count; i++)
+          {
+            values[i] = func(values[i], constant);
+          }
+        });
+      }
+      else
+      {
+        double* lhs = stack + (depth - 2) * k_TileSize;
+        const double* rhs = stack + (depth - 1) * k_TileSize;
+        VisitBinary(instruction.operation, [lhs, rhs, count](auto func) {
+          for(size_t i = 0; i < count; i++)
+          {
+            lhs[i] = func(lhs[i], rhs[i]);
+          }
+        });
+        depth--;
+      }
+      break;
+    }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer CalculatorProgram::evaluate(const QString& name) const
+{
+  typename DataArray<T>::Pointer output = DataArray<T>::CreateArray(m_NumberOfTuples, m_ComponentDimensions, name, true);
+  T* outputPtr = output->getPointer(0);
+  size_t numValues = output->getSize();
+  size_t numTiles = (numValues + k_TileSize - 1) / k_TileSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTiles);
+  dataAlg.execute([this, outputPtr, numValues](const SIMPLRange& range) {
+    std::vector<double> stack(m_StackDepth * k_TileSize);
+    for(size_t tile = range.min(); tile < range.max(); tile++)
+    {
+      size_t start = tile * k_TileSize;
+      size_t count = numValues - start;
+      if(count > k_TileSize)
+      {
+        count = k_TileSize;
+      }
+
+      evaluateTile(start, count, stack.data());
+      for(size_t i = 0; i < count; i++)
+      {
+        outputPtr[start + i] = static_cast<T>(stack[i]);
+      }
+    }
+  });
+
+  return output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer CalculatorProgram::evaluate(SIMPL::ScalarTypes::Type scalarType, const QString& name) const
+{
+  switch(scalarType)
+  {
+  case SIMPL::ScalarTypes::Type::Int8:
+    return evaluate<int8_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt8:
+    return evaluate<uint8_t>(name);
+  case SIMPL::ScalarTypes::Type::Int16:
+    return evaluate<int16_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt16:
+    return evaluate<uint16_t>(name);
+  case SIMPL::ScalarTypes::Type::Int32:
+    return evaluate<int32_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt32:
+    return evaluate<uint32_t>(name);
+  case SIMPL::ScalarTypes::Type::Int64:
+    return evaluate<int64_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt64:
+    return evaluate<uint64_t>(name);
+  case SIMPL::ScalarTypes::Type::Float:
+    return evaluate<float>(name);
+  case SIMPL::ScalarTypes::Type::Double:
+    return evaluate<double>(name);
+  case SIMPL::ScalarTypes::Type::Bool:
+    return evaluate<bool>(name);
+  default:
+    break;
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+CalculatorProgram::Pointer CalculatorProgram::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
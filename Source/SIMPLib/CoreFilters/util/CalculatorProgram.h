@@ -0,0 +1,154 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+#include "CalculatorItem.h"
+#include "CalculatorOperator.h"
+
+/**
+ * @brief The CalculatorProgram class compiles an ArrayCalculator expression in RPN order
+ * into a flat list of instructions and evaluates it in cache sized tiles. Every tile runs the
+ * whole expression before the next one is started, so no full size temporary arrays are
+ * allocated for the intermediate results, and the tiles are distributed across threads.
+ * Numeric sub-expressions are folded into constants when the program is compiled.
+ */
+class SIMPLib_EXPORT CalculatorProgram
+{
+public:
+  using Self = CalculatorProgram;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Number of values of every intermediate result that are kept in memory at once
+   */
+  static const size_t k_TileSize = 1024;
+
+  /**
+   * @brief Compiles the RPN expression. A null pointer is returned if the expression contains
+   * an item that cannot be compiled, is malformed or does not reference any array, in which
+   * case the expression should be evaluated by the operators themselves.
+   * @param rpn
+   * @param degrees True if the trigonometric operators use degrees
+   * @return
+   */
+  static Pointer Compile(const QVector<CalculatorItem::Pointer>& rpn, bool degrees);
+
+  virtual ~CalculatorProgram();
+
+  /**
+   * @brief Returns the number of tuples of the result
+   * @return
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the component dimensions of the result
+   * @return
+   */
+  std::vector<size_t> getComponentDimensions() const;
+
+  /**
+   * @brief Evaluates the program into a new array of the given scalar type. Values are
+   * converted from double the same way ArrayCalculator::convertArrayType converts them.
+   * @param scalarType
+   * @param name
+   * @return The result array or nullptr if the scalar type is not supported
+   */
+  IDataArray::Pointer evaluate(SIMPL::ScalarTypes::Type scalarType, const QString& name) const;
+
+protected:
+  CalculatorProgram();
+
+private:
+  enum class Code
+  {
+    Load,
+    Unary,
+    Binary
+  };
+
+  struct Instruction
+  {
+    Code code = Code::Load;
+    CalculatorOperator::Operation operation = CalculatorOperator::Operation::Unknown;
+    size_t source = 0;
+    bool lhsIsConstant = false;
+    bool rhsIsConstant = false;
+    double constant = 0.0;
+  };
+
+  using LoadFunction = void (*)(const void* data, size_t start, size_t count, double* values);
+
+  struct Source
+  {
+    IDataArray::Pointer array;
+    LoadFunction load = nullptr;
+  };
+
+  std::vector<Instruction> m_Instructions;
+  std::vector<Source> m_Sources;
+  size_t m_StackDepth = 0;
+  size_t m_NumberOfTuples = 0;
+  std::vector<size_t> m_ComponentDimensions;
+  bool m_Degrees = false;
+
+  /**
+   * @brief Runs the program over the values [start, start + count) and leaves the result in stack[0]
+   * @param start
+   * @param count
+   * @param stack
+   */
+  void evaluateTile(size_t start, size_t count, double* stack) const;
+
+  template <typename T>
+  IDataArray::Pointer evaluate(const QString& name) const;
+
+public:
+  CalculatorProgram(const CalculatorProgram&) = delete;            // Copy Constructor Not Implemented
+  CalculatorProgram(CalculatorProgram&&) = delete;                 // Move Constructor Not Implemented
+  CalculatorProgram& operator=(const CalculatorProgram&) = delete; // Copy Assignment Not Implemented
+  CalculatorProgram& operator=(CalculatorProgram&&) = delete;      // Move Assignment Not Implemented
+};
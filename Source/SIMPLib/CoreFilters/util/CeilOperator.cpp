@@ -48,6 +48,7 @@ CeilOperator::CeilOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("ceil");
+  setOperation(Operation::Ceil);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ CosOperator::CosOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("cos");
+  setOperation(Operation::Cos);
 }
 
 // -----------------------------------------------------------------------------
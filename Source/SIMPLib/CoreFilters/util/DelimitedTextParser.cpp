@@ -0,0 +1,338 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "DelimitedTextParser.h"
+
+#include <algorithm>
+#include <mutex>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextParser::DelimitedTextParser() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextParser::~DelimitedTextParser()
+{
+  if(m_File.isOpen())
+  {
+    m_File.close();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextParser::Pointer DelimitedTextParser::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextParser::Pointer DelimitedTextParser::New(const QString& filePath)
+{
+  Pointer sharedPtr(new DelimitedTextParser());
+  sharedPtr->m_File.setFileName(filePath);
+  if(!sharedPtr->m_File.open(QIODevice::ReadOnly))
+  {
+    return sharedPtr;
+  }
+
+  qint64 fileSize = sharedPtr->m_File.size();
+  if(fileSize > 0)
+  {
+    uchar* map = sharedPtr->m_File.map(0, fileSize);
+    if(nullptr != map)
+    {
+      sharedPtr->m_Data = reinterpret_cast<const char*>(map);
+    }
+    else
+    {
+      // Files that cannot be mapped, such as pipes, are read into memory instead
+      sharedPtr->m_Buffer = sharedPtr->m_File.readAll();
+      sharedPtr->m_Data = sharedPtr->m_Buffer.constData();
+      fileSize = sharedPtr->m_Buffer.size();
+    }
+  }
+  sharedPtr->m_Size = static_cast<size_t>(fileSize);
+
+  // Skip the UTF-8 byte order mark like QTextStream does
+  if(sharedPtr->m_Size >= 3 && std::memcmp(sharedPtr->m_Data, "\xEF\xBB\xBF", 3) == 0)
+  {
+    sharedPtr->m_Data += 3;
+    sharedPtr->m_Size -= 3;
+  }
+
+  sharedPtr->m_IsOpen = true;
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DelimitedTextParser::isOpen() const
+{
+  return m_IsOpen;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DelimitedTextParser::indexRows(size_t firstLine, size_t numRows)
+{
+  // A row that does not exist starts past the end of the file. The extra entry marks the end of the last row.
+  m_RowStarts.assign(numRows + 1, m_Size + 1);
+  if(firstLine == 0)
+  {
+    m_RowStarts[0] = 0;
+  }
+
+  size_t numChunks = m_Size / k_ChunkSize + 1;
+  std::vector<size_t> newlines(numChunks + 1, 0);
+
+  ParallelDataAlgorithm countAlg;
+  countAlg.setRange(0, numChunks);
+  countAlg.execute([&](const SIMPLRange& range) {
+    for(size_t c = range.min(); c < range.max(); c++)
+    {
+      const char* begin = m_Data + std::min(c * k_ChunkSize, m_Size);
+      const char* end = m_Data + std::min((c + 1) * k_ChunkSize, m_Size);
+      newlines[c + 1] = static_cast<size_t>(std::count(begin, end, '\n'));
+    }
+  });
+  for(size_t c = 0; c < numChunks; c++)
+  {
+    newlines[c + 1] += newlines[c];
+  }
+
+  // The line following the n'th newline of the file is line n + 1
+  size_t lastLine = firstLine + numRows;
+  ParallelDataAlgorithm indexAlg;
+  indexAlg.setRange(0, numChunks);
+  indexAlg.execute([&](const SIMPLRange& range) {
+    for(size_t c = range.min(); c < range.max(); c++)
+    {
+      size_t line = newlines[c] + 1;
+      if(newlines[c + 1] + 1 <= firstLine || line > lastLine)
+      {
+        continue;
+      }
+      const char* ptr = m_Data + std::min(c * k_ChunkSize, m_Size);
+      const char* end = m_Data + std::min((c + 1) * k_ChunkSize, m_Size);
+      while(ptr != end && line <= lastLine)
+      {
+        const char* newline = static_cast<const char*>(std::memchr(ptr, '\n', static_cast<size_t>(end - ptr)));
+        if(nullptr == newline)
+        {
+          break;
+        }
+        if(line >= firstLine)
+        {
+          m_RowStarts[line - firstLine] = static_cast<size_t>(newline - m_Data) + 1;
+        }
+        ptr = newline + 1;
+        line++;
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DelimitedTextParser::getNumberOfRows() const
+{
+  return m_RowStarts.empty() ? 0 : m_RowStarts.size() - 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DelimitedTextParser::getRow(size_t row) const
+{
+  size_t start = 0;
+  size_t end = 0;
+  getRowBounds(row, start, end);
+  return QString::fromUtf8(m_Data + start, static_cast<int>(end - start));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DelimitedTextParser::getRowBounds(size_t row, size_t& start, size_t& end) const
+{
+  start = m_RowStarts[row];
+  if(start > m_Size)
+  {
+    start = end = m_Size;
+    return;
+  }
+  // The row ends at the newline that starts the next one, and QTextStream drops a '\r' before it
+  end = m_RowStarts[row + 1] > m_Size ? m_Size : m_RowStarts[row + 1] - 1;
+  if(end > start && m_Data[end - 1] == '\r')
+  {
+    end--;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextParser::Error DelimitedTextParser::parseRows(const QList<AbstractDataParser::Pointer>& parsers, int32_t numColumns, const QList<char>& delimiters, size_t startRow, size_t endRow) const
+{
+  std::array<bool, 256> isDelimiter = {};
+  for(char delimiter : delimiters)
+  {
+    isDelimiter[static_cast<unsigned char>(delimiter)] = true;
+  }
+  bool splitRows = !delimiters.isEmpty();
+
+  std::vector<AbstractDataParser*> columnParsers;
+  for(const AbstractDataParser::Pointer& parser : parsers)
+  {
+    columnParsers.push_back(parser.get());
+  }
+
+  Error firstError;
+  std::mutex errorMutex;
+  std::atomic<size_t> firstErrorRow(std::numeric_limits<size_t>::max());
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(startRow, endRow);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<const char*> tokens;
+    Error error;
+    for(size_t row = range.min(); row < range.max() && row < firstErrorRow.load(); row++)
+    {
+      size_t start = 0;
+      size_t end = 0;
+      getRowBounds(row, start, end);
+
+      // Tokens are stored as pairs of begin and end pointers
+      tokens.clear();
+      const char* ptr = m_Data + start;
+      const char* rowEnd = m_Data + end;
+      if(!splitRows)
+      {
+        tokens.push_back(ptr);
+        tokens.push_back(rowEnd);
+      }
+      while(splitRows && ptr != rowEnd)
+      {
+        const char* first = ptr;
+        while(ptr != rowEnd && !isDelimiter[static_cast<unsigned char>(*ptr)])
+        {
+          ptr++;
+        }
+        if(first != ptr)
+        {
+          tokens.push_back(first);
+          tokens.push_back(ptr);
+        }
+        if(ptr != rowEnd)
+        {
+          ptr++;
+        }
+      }
+
+      error.type = ErrorType::None;
+      int32_t numTokens = static_cast<int32_t>(tokens.size() / 2);
+      if(numTokens != numColumns)
+      {
+        error.type = ErrorType::InconsistentColumns;
+        error.numberOfTokens = numTokens;
+      }
+      for(size_t i = 0; i < columnParsers.size() && error.type == ErrorType::None; i++)
+      {
+        int32_t column = columnParsers[i]->getColumnIndex();
+        ParserFunctor::ErrorObject obj = columnParsers[i]->parse(tokens[2 * column], tokens[2 * column + 1], row);
+        if(!obj.ok)
+        {
+          error.type = ErrorType::ConversionFailure;
+          error.column = column;
+          error.message = obj.errorMessage;
+        }
+      }
+
+      if(error.type != ErrorType::None)
+      {
+        error.row = row;
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if(row < firstErrorRow.load())
+        {
+          firstError = error;
+          firstErrorRow.store(row);
+        }
+        break;
+      }
+    }
+  });
+
+  return firstError;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DelimitedTextParser::findLine(size_t line) const
+{
+  size_t offset = 0;
+  for(size_t i = 0; i < line && offset < m_Size; i++)
+  {
+    const char* newline = static_cast<const char*>(std::memchr(m_Data + offset, '\n', m_Size - offset));
+    offset = (nullptr == newline) ? m_Size : static_cast<size_t>(newline - m_Data) + 1;
+  }
+  return offset;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> DelimitedTextParser::splitValueChunks(size_t start, const std::array<bool, 256>& separators) const
+{
+  std::vector<size_t> bounds(1, start);
+  size_t offset = start;
+  while(m_Size - offset > k_ChunkSize)
+  {
+    offset += k_ChunkSize;
+    while(offset < m_Size && !separators[static_cast<unsigned char>(m_Data[offset])])
+    {
+      offset++;
+    }
+    bounds.push_back(offset);
+  }
+  bounds.push_back(m_Size);
+  return bounds;
+}
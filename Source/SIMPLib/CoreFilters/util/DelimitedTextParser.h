@@ -0,0 +1,358 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The DelimitedTextParser class reads delimited text files for ReadASCIIData and
+ * ImportAsciDataArray. The file is memory mapped and split into chunks that end on a line or
+ * value boundary, and the chunks are tokenized and converted in parallel directly into the
+ * destination arrays without building a QString for every line.
+ */
+class SIMPLib_EXPORT DelimitedTextParser
+{
+public:
+  using Self = DelimitedTextParser;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Opens and maps the file. Use isOpen() to check if that succeeded.
+   * @param filePath
+   * @return
+   */
+  static Pointer New(const QString& filePath);
+
+  /**
+   * @brief Number of bytes the file is split into for the parallel passes
+   */
+  static const size_t k_ChunkSize = 1048576;
+
+  enum class ErrorType
+  {
+    None,
+    InconsistentColumns,
+    ConversionFailure
+  };
+
+  /**
+   * @brief The Error struct describes the error of the lowest row that failed to parse
+   */
+  struct Error
+  {
+    ErrorType type = ErrorType::None;
+    size_t row = 0;
+    int32_t column = 0;
+    int32_t numberOfTokens = 0;
+    QString message;
+  };
+
+  enum class ReadStatus
+  {
+    Ok,
+    ConversionFailure,
+    EndOfFile
+  };
+
+  virtual ~DelimitedTextParser();
+
+  /**
+   * @brief Returns true if the file could be opened and read
+   * @return
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief Finds the start of the lines [firstLine, firstLine + numRows) of the file. These lines
+   * are the rows used by getRow() and parseRows(). Rows past the end of the file are empty.
+   * @param firstLine Zero based index of the first line
+   * @param numRows
+   */
+  void indexRows(size_t firstLine, size_t numRows);
+
+  /**
+   * @brief Returns the number of rows found by indexRows()
+   * @return
+   */
+  size_t getNumberOfRows() const;
+
+  /**
+   * @brief Returns the text of the row without the line ending
+   * @param row
+   * @return
+   */
+  QString getRow(size_t row) const;
+
+  /**
+   * @brief Splits the rows [startRow, endRow) on the delimiters and hands the token of each
+   * parser's column to that parser, using the row as the insert index. Empty tokens are skipped
+   * as StringOperations::TokenizeString does, and a row that is not split into exactly numColumns
+   * tokens is an error.
+   * @param parsers
+   * @param numColumns
+   * @param delimiters
+   * @param startRow
+   * @param endRow
+   * @return The error of the lowest failing row, or an error of type None
+   */
+  Error parseRows(const QList<AbstractDataParser::Pointer>& parsers, int32_t numColumns, const QList<char>& delimiters, size_t startRow, size_t endRow) const;
+
+  /**
+   * @brief Converts a token the way an std::istream extracts a value of type T: a leading '+' is
+   * accepted and negative values wrap around for unsigned types. The whole token has to be used.
+   * @param first
+   * @param last
+   * @param value
+   * @return
+   */
+  template <typename T>
+  static bool ConvertValue(const char* first, const char* last, T& value)
+  {
+    bool hasPlus = (first != last && *first == '+');
+    if(hasPlus)
+    {
+      first++;
+    }
+    if(first == last || (hasPlus && (*first == '+' || *first == '-')))
+    {
+      return false;
+    }
+    if constexpr(std::is_floating_point<T>::value)
+    {
+#if defined(__cpp_lib_to_chars)
+      std::from_chars_result result = std::from_chars(first, last, value);
+      return result.ec == std::errc() && result.ptr == last;
+#else
+      bool ok = false;
+      value = static_cast<T>(QByteArray::fromRawData(first, static_cast<int>(last - first)).toDouble(&ok));
+      return ok;
+#endif
+    }
+    else
+    {
+      bool negate = false;
+      if(std::is_unsigned<T>::value && *first == '-')
+      {
+        first++;
+        negate = true;
+        if(first == last || *first == '-' || *first == '+')
+        {
+          return false;
+        }
+      }
+      std::from_chars_result result = std::from_chars(first, last, value);
+      if(result.ec != std::errc() || result.ptr != last)
+      {
+        return false;
+      }
+      if(negate)
+      {
+        value = static_cast<T>(static_cast<T>(0) - value);
+      }
+      return true;
+    }
+  }
+
+  /**
+   * @brief Converts the first count values that follow the first firstLine lines of the file.
+   * Values are separated by the delimiter or by white space and line breaks have no meaning. The
+   * function is called concurrently as convert(first, last, index) for every value and returns
+   * false if the value could not be converted.
+   * @param firstLine
+   * @param delimiter
+   * @param count
+   * @param convert
+   * @return ConversionFailure if a value could not be converted, EndOfFile if the file
+   * contains fewer than count values and Ok otherwise
+   */
+  template <typename ConvertFunc>
+  ReadStatus parseValues(size_t firstLine, char delimiter, size_t count, ConvertFunc convert) const
+  {
+    std::array<bool, 256> separators = {};
+    for(unsigned char c : {' ', '\t', '\n', '\v', '\f', '\r'})
+    {
+      separators[c] = true;
+    }
+    separators[static_cast<unsigned char>(delimiter)] = true;
+
+    std::vector<size_t> bounds = splitValueChunks(findLine(firstLine), separators);
+    size_t numChunks = bounds.size() - 1;
+
+    // First pass counts the values of each chunk so the second one knows where they are stored
+    std::vector<size_t> offsets(numChunks + 1, 0);
+    ParallelDataAlgorithm countAlg;
+    countAlg.setRange(0, numChunks);
+    countAlg.execute([&](const SIMPLRange& range) {
+      for(size_t c = range.min(); c < range.max(); c++)
+      {
+        offsets[c + 1] = ForEachValue(m_Data + bounds[c], m_Data + bounds[c + 1], separators, [](const char*, const char*) { return true; });
+      }
+    });
+    for(size_t c = 0; c < numChunks; c++)
+    {
+      offsets[c + 1] += offsets[c];
+    }
+
+    std::atomic<size_t> firstFailure(std::numeric_limits<size_t>::max());
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t c = range.min(); c < range.max(); c++)
+      {
+        size_t index = offsets[c];
+        if(index >= count || index > firstFailure.load())
+        {
+          continue;
+        }
+        ForEachValue(m_Data + bounds[c], m_Data + bounds[c + 1], separators, [&](const char* first, const char* last) {
+          if(index >= count)
+          {
+            return false;
+          }
+          if(!convert(first, last, index))
+          {
+            size_t failure = firstFailure.load();
+            while(index < failure && !firstFailure.compare_exchange_weak(failure, index))
+            {
+            }
+            return false;
+          }
+          index++;
+          return true;
+        });
+      }
+    });
+
+    if(firstFailure.load() < count)
+    {
+      return ReadStatus::ConversionFailure;
+    }
+    if(offsets[numChunks] < count)
+    {
+      return ReadStatus::EndOfFile;
+    }
+    return ReadStatus::Ok;
+  }
+
+protected:
+  DelimitedTextParser();
+
+private:
+  QFile m_File;
+  QByteArray m_Buffer;
+  const char* m_Data = nullptr;
+  size_t m_Size = 0;
+  bool m_IsOpen = false;
+  std::vector<size_t> m_RowStarts;
+
+  /**
+   * @brief Returns the offset of the start of the zero based line, or the file size if the
+   * file has fewer lines
+   * @param line
+   * @return
+   */
+  size_t findLine(size_t line) const;
+
+  /**
+   * @brief Returns the byte range of the row without the line ending
+   * @param row
+   * @param start
+   * @param end
+   */
+  void getRowBounds(size_t row, size_t& start, size_t& end) const;
+
+  /**
+   * @brief Splits [start, fileSize) into chunks of about k_ChunkSize bytes that end on a separator
+   * @param start
+   * @param separators
+   * @return The chunk boundaries, starting with start and ending with the file size
+   */
+  std::vector<size_t> splitValueChunks(size_t start, const std::array<bool, 256>& separators) const;
+
+  /**
+   * @brief Calls func(first, last) for every value in [begin, end) until it returns false
+   * @return The number of values func accepted
+   */
+  template <typename Func>
+  static size_t ForEachValue(const char* begin, const char* end, const std::array<bool, 256>& separators, Func func)
+  {
+    size_t numValues = 0;
+    const char* ptr = begin;
+    while(ptr != end)
+    {
+      while(ptr != end && separators[static_cast<unsigned char>(*ptr)])
+      {
+        ptr++;
+      }
+      const char* first = ptr;
+      while(ptr != end && !separators[static_cast<unsigned char>(*ptr)])
+      {
+        ptr++;
+      }
+      if(first != ptr)
+      {
+        if(!func(first, ptr))
+        {
+          break;
+        }
+        numValues++;
+      }
+    }
+    return numValues;
+  }
+
+public:
+  DelimitedTextParser(const DelimitedTextParser&) = delete;            // Copy Constructor Not Implemented
+  DelimitedTextParser(DelimitedTextParser&&) = delete;                 // Move Constructor Not Implemented
+  DelimitedTextParser& operator=(const DelimitedTextParser&) = delete; // Copy Assignment Not Implemented
+  DelimitedTextParser& operator=(DelimitedTextParser&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,231 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "DelimitedTextWriter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Number of blocks that are formatted before they are written, which bounds the memory used for a call to writeRows()
+ */
+const size_t k_BlocksPerPass = 64;
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool CreateDataArrayFormatter(const IDataArray::Pointer& array, char delimiter, DelimitedTextWriter::RowFormatter& formatter)
+{
+  typename DataArray<T>::Pointer dataArray = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == dataArray)
+  {
+    return false;
+  }
+
+  // The same precision DataArray::printTuple uses
+  int32_t precision = 6;
+  if(std::is_same<T, float>::value)
+  {
+    precision = 8;
+  }
+  else if(std::is_same<T, double>::value)
+  {
+    precision = 16;
+  }
+
+  const T* values = dataArray->getPointer(0);
+  const size_t numComps = dataArray->getNumberOfComponents();
+  formatter = [dataArray, values, numComps, delimiter, precision](std::string& buffer, size_t tuple) {
+    const T* tupleValues = values + tuple * numComps;
+    for(size_t j = 0; j < numComps; j++)
+    {
+      if(j != 0)
+      {
+        buffer.push_back(delimiter);
+      }
+      DelimitedTextWriter::AppendValue(buffer, tupleValues[j], precision);
+    }
+  };
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextWriter::DelimitedTextWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextWriter::~DelimitedTextWriter()
+{
+  if(m_File.isOpen())
+  {
+    m_File.close();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextWriter::Pointer DelimitedTextWriter::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextWriter::Pointer DelimitedTextWriter::New(const QString& filePath)
+{
+  Pointer sharedPtr(new DelimitedTextWriter());
+  sharedPtr->m_File.setFileName(filePath);
+  sharedPtr->m_IsOpen = sharedPtr->m_File.open(QIODevice::WriteOnly | QIODevice::Text);
+  sharedPtr->m_Start = std::chrono::steady_clock::now();
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DelimitedTextWriter::isOpen() const
+{
+  return m_IsOpen;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DelimitedTextWriter::write(const QString& text)
+{
+  QByteArray bytes = text.toLocal8Bit();
+  if(m_File.write(bytes) != bytes.size())
+  {
+    return false;
+  }
+  m_BytesWritten += static_cast<uint64_t>(bytes.size());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DelimitedTextWriter::writeRows(size_t startRow, size_t endRow, const RowFormatter& formatRow)
+{
+  size_t numBlocks = endRow > startRow ? (endRow - startRow + k_RowsPerBlock - 1) / k_RowsPerBlock : 0;
+  std::vector<std::string> buffers(std::min(numBlocks, k_BlocksPerPass));
+
+  for(size_t firstBlock = 0; firstBlock < numBlocks; firstBlock += k_BlocksPerPass)
+  {
+    size_t passBlocks = std::min(k_BlocksPerPass, numBlocks - firstBlock);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, passBlocks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t b = range.min(); b < range.max(); b++)
+      {
+        std::string& buffer = buffers[b];
+        buffer.clear();
+        size_t first = startRow + (firstBlock + b) * k_RowsPerBlock;
+        size_t last = std::min(first + k_RowsPerBlock, endRow);
+        for(size_t row = first; row < last; row++)
+        {
+          formatRow(buffer, row);
+        }
+      }
+    });
+
+    for(size_t b = 0; b < passBlocks; b++)
+    {
+      const std::string& buffer = buffers[b];
+      if(m_File.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size()))
+      {
+        return false;
+      }
+      m_BytesWritten += buffer.size();
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DelimitedTextWriter::getBytesWritten() const
+{
+  return m_BytesWritten;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DelimitedTextWriter::getThroughputMessage() const
+{
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+  double megaBytes = static_cast<double>(m_BytesWritten) / 1048576.0;
+  double rate = seconds > 0.0 ? megaBytes / seconds : 0.0;
+  return QObject::tr("Wrote %1 MB in %2 seconds (%3 MB/s)").arg(megaBytes, 0, 'f', 1).arg(seconds, 0, 'f', 2).arg(rate, 0, 'f', 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DelimitedTextWriter::RowFormatter DelimitedTextWriter::CreateTupleFormatter(const IDataArray::Pointer& array, char delimiter)
+{
+  RowFormatter formatter;
+  if(CreateDataArrayFormatter<int8_t>(array, delimiter, formatter) || CreateDataArrayFormatter<uint8_t>(array, delimiter, formatter) ||
+     CreateDataArrayFormatter<int16_t>(array, delimiter, formatter) || CreateDataArrayFormatter<uint16_t>(array, delimiter, formatter) ||
+     CreateDataArrayFormatter<int32_t>(array, delimiter, formatter) || CreateDataArrayFormatter<uint32_t>(array, delimiter, formatter) ||
+     CreateDataArrayFormatter<int64_t>(array, delimiter, formatter) || CreateDataArrayFormatter<uint64_t>(array, delimiter, formatter) ||
+     CreateDataArrayFormatter<float>(array, delimiter, formatter) || CreateDataArrayFormatter<double>(array, delimiter, formatter) ||
+     CreateDataArrayFormatter<bool>(array, delimiter, formatter) || CreateDataArrayFormatter<size_t>(array, delimiter, formatter))
+  {
+    return formatter;
+  }
+
+  // Any other kind of array writes itself
+  return [array, delimiter](std::string& buffer, size_t tuple) {
+    QString text;
+    QTextStream out(&text);
+    array->printTuple(out, tuple, delimiter);
+    out.flush();
+    QByteArray bytes = text.toLocal8Bit();
+    buffer.append(bytes.constData(), static_cast<size_t>(bytes.size()));
+  };
+}
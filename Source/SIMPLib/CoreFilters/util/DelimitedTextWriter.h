@@ -0,0 +1,183 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @brief The DelimitedTextWriter class writes delimited text files for WriteASCIIData and
+ * FeatureDataCSVWriter. Rows are formatted in parallel blocks into byte buffers with
+ * std::to_chars and the buffers are written to the file in order. The values are formatted
+ * byte for byte as a default QTextStream writes them.
+ */
+class SIMPLib_EXPORT DelimitedTextWriter
+{
+public:
+  using Self = DelimitedTextWriter;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Creates the file as a text file. Use isOpen() to check if that succeeded.
+   * @param filePath
+   * @return
+   */
+  static Pointer New(const QString& filePath);
+
+  /**
+   * @brief Number of rows each parallel task formats into a single buffer
+   */
+  static const size_t k_RowsPerBlock = 4096;
+
+  /**
+   * @brief Appends the text of a row to the buffer. It is called concurrently for different rows.
+   */
+  using RowFormatter = std::function<void(std::string& buffer, size_t row)>;
+
+  virtual ~DelimitedTextWriter();
+
+  /**
+   * @brief Returns true if the file could be created
+   * @return
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief Writes the text with the local 8 bit encoding that QTextStream uses
+   * @param text
+   * @return false if the text could not be written
+   */
+  bool write(const QString& text);
+
+  /**
+   * @brief Formats the rows [startRow, endRow) in parallel and writes them in order
+   * @param startRow
+   * @param endRow
+   * @param formatRow
+   * @return false if the text could not be written
+   */
+  bool writeRows(size_t startRow, size_t endRow, const RowFormatter& formatRow);
+
+  /**
+   * @brief Returns the number of bytes written so far
+   * @return
+   */
+  uint64_t getBytesWritten() const;
+
+  /**
+   * @brief Returns a status message with the size of the file and the rate it was written at
+   * @return
+   */
+  QString getThroughputMessage() const;
+
+  /**
+   * @brief Returns a formatter that appends the components of a tuple of the array separated by
+   * the delimiter, as IDataArray::printTuple writes them. DataArray types are formatted directly,
+   * all other arrays go through printTuple.
+   * @param array
+   * @param delimiter
+   * @return
+   */
+  static RowFormatter CreateTupleFormatter(const IDataArray::Pointer& array, char delimiter);
+
+  /**
+   * @brief Appends the value as a QTextStream with the given real number precision writes it:
+   * integers in decimal and floating point values in the shortest of fixed or scientific
+   * notation with precision significant digits, like printf's %g.
+   * @param buffer
+   * @param value
+   * @param precision
+   */
+  template <typename T>
+  static void AppendValue(std::string& buffer, T value, int32_t precision = 6)
+  {
+    if constexpr(std::is_same<T, bool>::value)
+    {
+      buffer.push_back(value ? '1' : '0');
+    }
+    else if constexpr(std::is_floating_point<T>::value)
+    {
+      // Qt decides how the special values and a negative zero are spelled
+      if(!std::isfinite(value) || value == static_cast<T>(0))
+      {
+        QByteArray text = QByteArray::number(static_cast<double>(value), 'g', precision);
+        buffer.append(text.constData(), static_cast<size_t>(text.size()));
+        return;
+      }
+#if defined(__cpp_lib_to_chars)
+      char text[64];
+      char* last = std::to_chars(text, text + sizeof(text), value, std::chars_format::general, precision).ptr;
+      buffer.append(text, static_cast<size_t>(last - text));
+#else
+      QByteArray text = QByteArray::number(static_cast<double>(value), 'g', precision);
+      buffer.append(text.constData(), static_cast<size_t>(text.size()));
+#endif
+    }
+    else
+    {
+      char text[32];
+      char* last = std::to_chars(text, text + sizeof(text), value).ptr;
+      buffer.append(text, static_cast<size_t>(last - text));
+    }
+  }
+
+protected:
+  DelimitedTextWriter();
+
+private:
+  QFile m_File;
+  bool m_IsOpen = false;
+  uint64_t m_BytesWritten = 0;
+  std::chrono::steady_clock::time_point m_Start;
+
+public:
+  DelimitedTextWriter(const DelimitedTextWriter&) = delete;            // Copy Constructor Not Implemented
+  DelimitedTextWriter(DelimitedTextWriter&&) = delete;                 // Move Constructor Not Implemented
+  DelimitedTextWriter& operator=(const DelimitedTextWriter&) = delete; // Copy Assignment Not Implemented
+  DelimitedTextWriter& operator=(DelimitedTextWriter&&) = delete;      // Move Assignment Not Implemented
+};
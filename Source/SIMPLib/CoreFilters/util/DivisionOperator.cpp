@@ -51,6 +51,7 @@ DivisionOperator::DivisionOperator()
 {
   setPrecedence(B_Precedence);
   setInfixToken("/");
+  setOperation(Operation::Division);
 }
 
 // -----------------------------------------------------------------------------
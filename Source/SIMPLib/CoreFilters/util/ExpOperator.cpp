@@ -48,6 +48,7 @@ ExpOperator::ExpOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("exp");
+  setOperation(Operation::Exp);
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,234 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "FeatureReduction.h"
+
+#include <functional>
+#include <thread>
+
+namespace
+{
+/**
+ * @brief Upper bound for the scratch memory of all chunks of one reduction
+ */
+const size_t k_ScratchBudget = size_t(512) * 1024 * 1024;
+
+/**
+ * @brief Smallest number of elements worth a chunk of its own
+ */
+const size_t k_MinElementsPerChunk = 16384;
+
+// -----------------------------------------------------------------------------
+size_t ChunkBegin(size_t numElements, size_t chunk, size_t numChunks)
+{
+  return numElements * chunk / numChunks;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+std::vector<QString> FeatureReduction::ReductionTypeNames()
+{
+  return {"Last", "First", "Minimum", "Maximum", "Sum", "Mean", "Count", "Mode"};
+}
+
+// -----------------------------------------------------------------------------
+size_t FeatureReduction::ChunkCount(size_t numElements, size_t bytesPerChunk)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  size_t numChunks = std::max(std::thread::hardware_concurrency(), 1U);
+  numChunks = std::min(numChunks, numElements / k_MinElementsPerChunk);
+  if(bytesPerChunk > 0)
+  {
+    numChunks = std::min(numChunks, k_ScratchBudget / bytesPerChunk);
+  }
+  return std::max(numChunks, size_t(1));
+#else
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+FeatureReduction::IdRange FeatureReduction::FindIdRange(const int32_t* featureIds, size_t numElements)
+{
+  const size_t numChunks = ChunkCount(numElements, 0);
+  std::vector<IdRange> ranges(numChunks);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      IdRange& idRange = ranges[chunk];
+      const size_t end = ChunkBegin(numElements, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numElements, chunk, numChunks); i < end; i++)
+      {
+        idRange.minimum = std::min(idRange.minimum, featureIds[i]);
+        idRange.maximum = std::max(idRange.maximum, featureIds[i]);
+      }
+    }
+  });
+
+  IdRange result;
+  for(const auto& idRange : ranges)
+  {
+    result.minimum = std::min(result.minimum, idRange.minimum);
+    result.maximum = std::max(result.maximum, idRange.maximum);
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<uint64_t> FeatureReduction::CountElements(const int32_t* featureIds, size_t numElements, size_t numFeatures)
+{
+  const size_t numChunks = ChunkCount(numElements, numFeatures * sizeof(uint64_t));
+  std::vector<std::vector<uint64_t>> chunkCounts(numChunks);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<uint64_t>& counts = chunkCounts[chunk];
+      counts.assign(numFeatures, 0);
+      const size_t end = ChunkBegin(numElements, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numElements, chunk, numChunks); i < end; i++)
+      {
+        counts[featureIds[i]]++;
+      }
+    }
+  });
+
+  std::vector<uint64_t> result = std::move(chunkCounts[0]);
+  for(size_t chunk = 1; chunk < numChunks; chunk++)
+  {
+    std::transform(result.begin(), result.end(), chunkCounts[chunk].begin(), result.begin(), std::plus<uint64_t>());
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> FeatureReduction::FindRepresentatives(const int32_t* featureIds, size_t numElements, size_t numFeatures, bool first)
+{
+  const size_t numChunks = ChunkCount(numElements, numFeatures * sizeof(size_t));
+  std::vector<std::vector<size_t>> chunkIndices(numChunks);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<size_t>& indices = chunkIndices[chunk];
+      indices.assign(numFeatures, numElements);
+      const size_t begin = ChunkBegin(numElements, chunk, numChunks);
+      const size_t end = ChunkBegin(numElements, chunk + 1, numChunks);
+      if(first)
+      {
+        for(size_t i = end; i > begin; i--)
+        {
+          indices[featureIds[i - 1]] = i - 1;
+        }
+      }
+      else
+      {
+        for(size_t i = begin; i < end; i++)
+        {
+          indices[featureIds[i]] = i;
+        }
+      }
+    }
+  });
+
+  // The chunks are in element order, so the first chunk holding a feature has its first element and the last
+  // chunk holding it has its last element
+  std::vector<size_t> result = std::move(chunkIndices[0]);
+  for(size_t chunk = 1; chunk < numChunks; chunk++)
+  {
+    const std::vector<size_t>& indices = chunkIndices[chunk];
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      if(indices[f] < numElements && (!first || result[f] == numElements))
+      {
+        result[f] = indices[f];
+      }
+    }
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+void FeatureReduction::GroupElements(const int32_t* featureIds, size_t numElements, size_t numFeatures, std::vector<uint64_t>& offsets, std::vector<size_t>& order)
+{
+  const size_t numChunks = ChunkCount(numElements, numFeatures * sizeof(uint64_t));
+  std::vector<std::vector<uint64_t>> chunkCounts(numChunks);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<uint64_t>& counts = chunkCounts[chunk];
+      counts.assign(numFeatures, 0);
+      const size_t end = ChunkBegin(numElements, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numElements, chunk, numChunks); i < end; i++)
+      {
+        counts[featureIds[i]]++;
+      }
+    }
+  });
+
+  // Turn the counts into the position at which every chunk writes the elements of each feature, so that the
+  // elements of a feature stay in element order
+  offsets.assign(numFeatures + 1, 0);
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    uint64_t position = offsets[f];
+    for(auto& counts : chunkCounts)
+    {
+      const uint64_t count = counts[f];
+      counts[f] = position;
+      position += count;
+    }
+    offsets[f + 1] = position;
+  }
+
+  order.resize(numElements);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<uint64_t>& positions = chunkCounts[chunk];
+      const size_t end = ChunkBegin(numElements, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numElements, chunk, numChunks); i < end; i++)
+      {
+        order[positions[featureIds[i]]++] = i;
+      }
+    }
+  });
+}
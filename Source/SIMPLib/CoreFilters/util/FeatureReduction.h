@@ -0,0 +1,383 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Parallel "group by feature id" reductions of element arrays into feature arrays. The elements
+ * are split into a few contiguous chunks, every chunk reduces into its own dense per feature accumulator
+ * and the accumulators are merged per feature at the end. All functions expect every feature id to be
+ * in [0, numFeatures), which FindIdRange() can check.
+ */
+namespace FeatureReduction
+{
+/**
+ * @brief Type used to hold values of T in scratch vectors, since std::vector<bool> can not be written from several threads
+ */
+template <typename T>
+using ScratchType = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+
+/**
+ * @brief How the values of all elements of a feature are combined into the value of the feature.
+ * The order matches ReductionTypeNames().
+ */
+enum class ReductionType : int32_t
+{
+  Last = 0,
+  First = 1,
+  Minimum = 2,
+  Maximum = 3,
+  Sum = 4,
+  Mean = 5,
+  Count = 6,
+  Mode = 7
+};
+
+/**
+ * @brief Returns the human readable names of the reduction types in the order of the enumeration
+ */
+SIMPLib_EXPORT std::vector<QString> ReductionTypeNames();
+
+/**
+ * @brief Smallest and largest feature id of a set of elements. An empty set has a maximum below the minimum.
+ */
+struct IdRange
+{
+  int32_t minimum = std::numeric_limits<int32_t>::max();
+  int32_t maximum = std::numeric_limits<int32_t>::min();
+};
+
+/**
+ * @brief Finds the smallest and largest feature id in parallel
+ */
+SIMPLib_EXPORT IdRange FindIdRange(const int32_t* featureIds, size_t numElements);
+
+/**
+ * @brief Returns the number of chunks the elements are split into when every chunk needs bytesPerChunk of
+ * scratch memory. It is bounded by the number of threads and by a fixed memory budget.
+ */
+SIMPLib_EXPORT size_t ChunkCount(size_t numElements, size_t bytesPerChunk);
+
+/**
+ * @brief Returns the number of elements of every feature
+ */
+SIMPLib_EXPORT std::vector<uint64_t> CountElements(const int32_t* featureIds, size_t numElements, size_t numFeatures);
+
+/**
+ * @brief Returns the index of the first (or last) element of every feature, or numElements for a feature
+ * without elements
+ */
+SIMPLib_EXPORT std::vector<size_t> FindRepresentatives(const int32_t* featureIds, size_t numElements, size_t numFeatures, bool first);
+
+/**
+ * @brief Sorts the element indices by feature id with a parallel counting sort. The elements of feature f are
+ * order[offsets[f]] up to but not including order[offsets[f + 1]], in increasing element order.
+ */
+SIMPLib_EXPORT void GroupElements(const int32_t* featureIds, size_t numElements, size_t numFeatures, std::vector<uint64_t>& offsets, std::vector<size_t>& order);
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Combines every component of the elements of each feature with combine, starting from identity,
+ * using one dense accumulator per chunk. Features without elements keep identity.
+ */
+template <typename T, typename AccumType, typename Combine>
+std::vector<AccumType> AccumulateComponents(const T* values, size_t numComp, const int32_t* featureIds, size_t numElements, size_t numFeatures, AccumType identity, Combine combine)
+{
+  const size_t accumSize = numFeatures * numComp;
+  const size_t numChunks = ChunkCount(numElements, accumSize * sizeof(AccumType));
+  std::vector<std::vector<AccumType>> chunkAccums(numChunks);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<AccumType>& accum = chunkAccums[chunk];
+      accum.assign(accumSize, identity);
+      const size_t end = numElements * (chunk + 1) / numChunks;
+      for(size_t i = numElements * chunk / numChunks; i < end; i++)
+      {
+        AccumType* dest = accum.data() + static_cast<size_t>(featureIds[i]) * numComp;
+        const T* src = values + i * numComp;
+        for(size_t c = 0; c < numComp; c++)
+        {
+          dest[c] = combine(dest[c], static_cast<AccumType>(src[c]));
+        }
+      }
+    }
+  });
+
+  std::vector<AccumType> result = std::move(chunkAccums[0]);
+  dataAlg.setRange(0, accumSize);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = 1; chunk < numChunks; chunk++)
+    {
+      const std::vector<AccumType>& accum = chunkAccums[chunk];
+      for(size_t j = range.min(); j < range.max(); j++)
+      {
+        result[j] = combine(result[j], accum[j]);
+      }
+    }
+  });
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Returns the most frequent value of each component of the elements of every feature. Ties go to the
+ * smallest value and NaN values are only used if a feature has nothing else.
+ */
+template <typename T>
+std::vector<ScratchType<T>> ModeComponents(const T* values, size_t numComp, const int32_t* featureIds, size_t numElements, size_t numFeatures)
+{
+  using ValueType = ScratchType<T>;
+  std::vector<uint64_t> offsets;
+  std::vector<size_t> order;
+  GroupElements(featureIds, numElements, numFeatures, offsets, order);
+
+  std::vector<ValueType> result(numFeatures * numComp, static_cast<ValueType>(0));
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numFeatures);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<ValueType> featureValues;
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      if(offsets[f] == offsets[f + 1])
+      {
+        continue;
+      }
+      for(size_t c = 0; c < numComp; c++)
+      {
+        featureValues.clear();
+        for(uint64_t k = offsets[f]; k < offsets[f + 1]; k++)
+        {
+          featureValues.push_back(values[order[k] * numComp + c]);
+        }
+        auto last = featureValues.end();
+        if constexpr(std::is_floating_point_v<T>)
+        {
+          last = std::remove_if(featureValues.begin(), featureValues.end(), [](ValueType v) { return std::isnan(v); });
+          if(last == featureValues.begin())
+          {
+            result[f * numComp + c] = std::numeric_limits<T>::quiet_NaN();
+            continue;
+          }
+        }
+        std::sort(featureValues.begin(), last);
+
+        ValueType best = featureValues.front();
+        size_t bestCount = 0;
+        for(auto run = featureValues.begin(); run != last;)
+        {
+          auto runEnd = std::upper_bound(run, last, *run);
+          const size_t count = static_cast<size_t>(runEnd - run);
+          if(count > bestCount)
+          {
+            best = *run;
+            bestCount = count;
+          }
+          run = runEnd;
+        }
+        result[f * numComp + c] = best;
+      }
+    }
+  });
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Returns the first feature whose elements do not all have the same value, or -1 if every feature is
+ * consistent. The elements are compared against the representatives from FindRepresentatives().
+ */
+template <typename T>
+int32_t FindInconsistentFeature(const DataArray<T>& elements, const int32_t* featureIds, const std::vector<size_t>& representatives)
+{
+  const size_t numElements = elements.getNumberOfTuples();
+  const size_t numComp = elements.getNumberOfComponents();
+  const T* values = elements.data();
+
+  std::atomic<size_t> firstElement(numElements);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numElements);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max() && i < firstElement.load(std::memory_order_relaxed); i++)
+    {
+      const T* rep = values + representatives[featureIds[i]] * numComp;
+      if(!std::equal(rep, rep + numComp, values + i * numComp))
+      {
+        size_t current = firstElement.load();
+        while(i < current && !firstElement.compare_exchange_weak(current, i))
+        {
+        }
+        break;
+      }
+    }
+  });
+  return firstElement == numElements ? -1 : featureIds[firstElement];
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Reduces the elements of every feature into a new feature array with numFeatures tuples. Features
+ * without elements are set to 0. Sum and Mean create a double array, Count creates a single component
+ * int32_t array and the other reductions keep the type and components of the elements.
+ */
+template <typename T>
+IDataArray::Pointer Reduce(const DataArray<T>& elements, const int32_t* featureIds, size_t numFeatures, ReductionType type, const QString& name)
+{
+  const size_t numElements = elements.getNumberOfTuples();
+  const size_t numComp = elements.getNumberOfComponents();
+  const std::vector<size_t> cDims = elements.getComponentDimensions();
+  const T* values = elements.data();
+
+  ParallelDataAlgorithm dataAlg;
+  switch(type)
+  {
+  case ReductionType::Last:
+  case ReductionType::First:
+  {
+    std::vector<size_t> representatives = FindRepresentatives(featureIds, numElements, numFeatures, type == ReductionType::First);
+    typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(numFeatures, cDims, name, true);
+    feature->initializeWithZeros();
+    T* dest = feature->getPointer(0);
+    dataAlg.setRange(0, numFeatures);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t f = range.min(); f < range.max(); f++)
+      {
+        if(representatives[f] < numElements)
+        {
+          std::copy(values + representatives[f] * numComp, values + (representatives[f] + 1) * numComp, dest + f * numComp);
+        }
+      }
+    });
+    return feature;
+  }
+  case ReductionType::Minimum:
+  case ReductionType::Maximum:
+  {
+    using ValueType = ScratchType<T>;
+    std::vector<ValueType> extremes;
+    if(type == ReductionType::Minimum)
+    {
+      extremes = AccumulateComponents(values, numComp, featureIds, numElements, numFeatures, static_cast<ValueType>(std::numeric_limits<T>::max()),
+                                      [](ValueType a, ValueType b) { return b < a ? b : a; });
+    }
+    else
+    {
+      extremes = AccumulateComponents(values, numComp, featureIds, numElements, numFeatures, static_cast<ValueType>(std::numeric_limits<T>::lowest()),
+                                      [](ValueType a, ValueType b) { return a < b ? b : a; });
+    }
+    std::vector<uint64_t> counts = CountElements(featureIds, numElements, numFeatures);
+    typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(numFeatures, cDims, name, true);
+    T* dest = feature->getPointer(0);
+    for(size_t j = 0; j < extremes.size(); j++)
+    {
+      dest[j] = counts[j / numComp] == 0 ? static_cast<T>(0) : static_cast<T>(extremes[j]);
+    }
+    return feature;
+  }
+  case ReductionType::Sum:
+  case ReductionType::Mean:
+  {
+    std::vector<double> sums = AccumulateComponents(values, numComp, featureIds, numElements, numFeatures, 0.0, [](double a, double b) { return a + b; });
+    DoubleArrayType::Pointer feature = DoubleArrayType::CreateArray(numFeatures, cDims, name, true);
+    double* dest = feature->getPointer(0);
+    if(type == ReductionType::Sum)
+    {
+      std::copy(sums.begin(), sums.end(), dest);
+      return feature;
+    }
+    std::vector<uint64_t> counts = CountElements(featureIds, numElements, numFeatures);
+    for(size_t j = 0; j < sums.size(); j++)
+    {
+      const uint64_t count = counts[j / numComp];
+      dest[j] = count == 0 ? 0.0 : sums[j] / static_cast<double>(count);
+    }
+    return feature;
+  }
+  case ReductionType::Count:
+  {
+    std::vector<uint64_t> counts = CountElements(featureIds, numElements, numFeatures);
+    Int32ArrayType::Pointer feature = Int32ArrayType::CreateArray(numFeatures, std::vector<size_t>(1, 1), name, true);
+    std::transform(counts.begin(), counts.end(), feature->begin(), [](uint64_t count) { return static_cast<int32_t>(count); });
+    return feature;
+  }
+  case ReductionType::Mode:
+  {
+    std::vector<ScratchType<T>> modes = ModeComponents(values, numComp, featureIds, numElements, numFeatures);
+    typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(numFeatures, cDims, name, true);
+    std::transform(modes.begin(), modes.end(), feature->begin(), [](ScratchType<T> mode) { return static_cast<T>(mode); });
+    return feature;
+  }
+  }
+  return IDataArray::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Copies the value of every feature to each of its elements in parallel. The created array has one
+ * tuple per feature id.
+ */
+template <typename T>
+typename DataArray<T>::Pointer Scatter(const DataArray<T>& features, const int32_t* featureIds, size_t numElements, const QString& name)
+{
+  const size_t numComp = features.getNumberOfComponents();
+  typename DataArray<T>::Pointer elements = DataArray<T>::CreateArray(numElements, features.getComponentDimensions(), name, true);
+  const T* src = features.data();
+  T* dest = elements->getPointer(0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numElements);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const T* value = src + static_cast<size_t>(featureIds[i]) * numComp;
+      std::copy(value, value + numComp, dest + i * numComp);
+    }
+  });
+  return elements;
+}
+} // namespace FeatureReduction
@@ -48,6 +48,7 @@ FloorOperator::FloorOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("floor");
+  setOperation(Operation::Floor);
 }
 
 // -----------------------------------------------------------------------------
@@ -65,10 +65,16 @@ public:
   ~ICalculatorArray() override;
 
   virtual IDataArrayShPtrType getArray() = 0;
-  virtual double getValue(int i) = 0;
-  virtual void setValue(int i, double value) = 0;
+  virtual double getValue(size_t i) = 0;
+  virtual void setValue(size_t i, double value) = 0;
   virtual ValueType getType() = 0;
 
+  /**
+   * @brief Returns the array this item was created from without converting it to double
+   * @return
+   */
+  virtual IDataArrayShPtrType getSourceArray() = 0;
+
   virtual DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) = 0;
 
 protected:
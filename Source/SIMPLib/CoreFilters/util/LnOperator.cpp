@@ -48,6 +48,7 @@ LnOperator::LnOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("ln");
+  setOperation(Operation::Ln);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ Log10Operator::Log10Operator()
 {
   setNumberOfArguments(1);
   setInfixToken("log10");
+  setOperation(Operation::Log10);
 }
 
 // -----------------------------------------------------------------------------
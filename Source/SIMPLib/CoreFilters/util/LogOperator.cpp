@@ -48,6 +48,7 @@ LogOperator::LogOperator()
 {
   setNumberOfArguments(2);
   setInfixToken("log");
+  setOperation(Operation::Log);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ MultiplicationOperator::MultiplicationOperator()
 {
   setPrecedence(B_Precedence);
   setInfixToken("*");
+  setOperation(Operation::Multiplication);
 }
 
 // -----------------------------------------------------------------------------
@@ -50,6 +50,7 @@ NegativeOperator::NegativeOperator()
 {
   setOperatorType(Unary);
   setPrecedence(D_Precedence);
+  setOperation(Operation::Negative);
 }
 
 // -----------------------------------------------------------------------------
@@ -69,12 +70,12 @@ void NegativeOperator::calculate(AbstractFilter* filter, DataArrayPath calculate
     DoubleArrayType::Pointer newArray =
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName(), true);
 
-    int numComps = newArray->getNumberOfComponents();
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)
+    size_t numComps = newArray->getNumberOfComponents();
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)
     {
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)
+      for(size_t c = 0; c < numComps; c++)
       {
-        int index = numComps * i + c;
+        size_t index = numComps * i + c;
         double num = arrayPtr->getValue(index);
         newArray->setValue(index, -1 * num);
       }
@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include <charconv>
+#include <cmath>
+#include <type_traits>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 
@@ -54,6 +58,57 @@ public:
     bool ok = false;
     QString errorMessage;
   };
+
+  /**
+   * @brief Converts a plain decimal token with std::from_chars without allocating a QString.
+   * Tokens the functors could interpret differently (white space, a leading '+', leading zeros,
+   * hex prefixes, inf or nan) and values that are out of range are rejected so that the caller
+   * can hand them to the functor itself, which keeps the results and error messages identical.
+   * @param first
+   * @param last
+   * @param value
+   * @return True if the whole token was converted
+   */
+  template <typename T>
+  static bool FromChars(const char* first, const char* last, T& value)
+  {
+    const char* digits = (first != last && *first == '-') ? first + 1 : first;
+    if(digits == last)
+    {
+      return false;
+    }
+    if constexpr(std::is_integral<T>::value)
+    {
+      // A leading zero selects octal for the conversions that detect the base
+      if(*digits == '0' && digits + 1 != last)
+      {
+        return false;
+      }
+      std::from_chars_result result = std::from_chars(first, last, value);
+      return result.ec == std::errc() && result.ptr == last;
+    }
+    else
+    {
+#if defined(__cpp_lib_to_chars)
+      if((*digits < '0' || *digits > '9') && *digits != '.')
+      {
+        return false;
+      }
+      // Floats go through double like QString::toFloat does so they are rounded the same way
+      double dValue = 0.0;
+      std::from_chars_result result = std::from_chars(first, last, dValue);
+      if(result.ec != std::errc() || result.ptr != last)
+      {
+        return false;
+      }
+      value = static_cast<T>(dValue);
+      return !std::isinf(value) && (value != static_cast<T>(0) || dValue == 0.0);
+#else
+      // Floating point std::from_chars is not available from this standard library
+      return false;
+#endif
+    }
+  }
 };
 
 // -----------------------------------------------------------------------------
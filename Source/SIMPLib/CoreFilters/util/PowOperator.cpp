@@ -48,6 +48,7 @@ PowOperator::PowOperator()
 {
   setPrecedence(C_Precedence);
   setInfixToken("^");
+  setOperation(Operation::Pow);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ RootOperator::RootOperator()
 {
   setNumberOfArguments(2);
   setInfixToken("root");
+  setOperation(Operation::Root);
 }
 
 // -----------------------------------------------------------------------------
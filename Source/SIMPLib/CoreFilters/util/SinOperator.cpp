@@ -48,6 +48,7 @@ SinOperator::SinOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("sin");
+  setOperation(Operation::Sin);
 }
 
 // -----------------------------------------------------------------------------
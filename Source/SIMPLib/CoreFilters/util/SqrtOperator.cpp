@@ -48,6 +48,7 @@ SqrtOperator::SqrtOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("sqrt");
+  setOperation(Operation::Sqrt);
 }
 
 // -----------------------------------------------------------------------------
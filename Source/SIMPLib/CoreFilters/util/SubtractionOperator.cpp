@@ -48,6 +48,7 @@ SubtractionOperator::SubtractionOperator()
 {
   setPrecedence(A_Precedence);
   setInfixToken("-");
+  setOperation(Operation::Subtraction);
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@ TanOperator::TanOperator()
 {
   setNumberOfArguments(1);
   setInfixToken("tan");
+  setOperation(Operation::Tan);
 }
 
 // -----------------------------------------------------------------------------
@@ -89,12 +89,12 @@ public:
     DoubleArrayType::Pointer newArray =                                                                                                                                                                \
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName(), true);                         \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
+    size_t numComps = newArray->getNumberOfComponents();                                                                                                                                               \
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                          \
     {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+      for(size_t c = 0; c < numComps; c++)                                                                                                                                                             \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
+        size_t index = numComps * i + c;                                                                                                                                                               \
         double num = arrayPtr->getValue(index);                                                                                                                                                        \
         newArray->setValue(index, func(num));                                                                                                                                                          \
       }                                                                                                                                                                                                \
@@ -114,12 +114,12 @@ public:
     DoubleArrayType::Pointer newArray =                                                                                                                                                                \
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName(), true);                         \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
+    size_t numComps = newArray->getNumberOfComponents();                                                                                                                                               \
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                          \
     {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+      for(size_t c = 0; c < numComps; c++)                                                                                                                                                             \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
+        size_t index = numComps * i + c;                                                                                                                                                               \
         double num = arrayPtr->getValue(index);                                                                                                                                                        \
                                                                                                                                                                                                        \
         if(calculatorFilter->getUnits() == ArrayCalculator::Degrees)                                                                                                                                   \
@@ -147,12 +147,12 @@ public:
     DoubleArrayType::Pointer newArray =                                                                                                                                                                \
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName(), true);                         \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
+    size_t numComps = newArray->getNumberOfComponents();                                                                                                                                               \
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                          \
     {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+      for(size_t c = 0; c < numComps; c++)                                                                                                                                                             \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
+        size_t index = numComps * i + c;                                                                                                                                                               \
         double num = arrayPtr->getValue(index);                                                                                                                                                        \
                                                                                                                                                                                                        \
         if(calculatorFilter->getUnits() == ArrayCalculator::Degrees)                                                                                                                                   \
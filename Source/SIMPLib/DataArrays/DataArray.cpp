@@ -60,6 +60,7 @@
 #define SIMPL_BYTE_SWAP_64(x) bswap_64(x)
 #endif
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <iostream>
@@ -70,9 +71,13 @@
 
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 namespace
 {
+// Largest number of elements copied by one task when tuples are erased
+constexpr size_t k_EraseSegmentSize = 1 << 16;
+
 // Can be replaced with std::bit_cast in C++ 20
 
 template <class To, class From, class = std::enable_if_t<(sizeof(To) == sizeof(From)) && std::is_trivially_copyable<From>::value && std::is_trivial<To>::value>>
@@ -406,15 +411,38 @@ typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTupl
 template <typename T>
 IDataArray::Pointer DataArray<T>::deepCopy(bool forceNoAllocate) const
 {
+  if(hasDeferredLoader())
+  {
+    // The copy reads the same values from the file when it is first touched
+    auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+    daCopy->m_Storage = m_Storage;
+    if(!forceNoAllocate)
+    {
+      daCopy->setDeferredLoader(m_DeferredLoad->loader);
+    }
+    return daCopy;
+  }
   bool allocate = m_IsAllocated;
   if(forceNoAllocate)
   {
     allocate = false;
   }
-  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), allocate);
+  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+  daCopy->m_Storage = m_Storage;
+  if(allocate && daCopy->allocate() < 0)
+  {
+    return nullptr;
+  }
   if(m_IsAllocated && !forceNoAllocate)
   {
     std::copy(begin(), end(), daCopy->begin());
+    // A copy of values that failed to load carries the same error
+    if(getDeferredLoadError() < 0)
+    {
+      auto state = std::make_shared<DeferredLoadState>();
+      state->error = getDeferredLoadError();
+      daCopy->m_DeferredLoad = state;
+    }
   }
   return daCopy;
 }
@@ -543,6 +571,7 @@ void DataArray<T>::getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision)
 template <typename T>
 bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
+  ensureLoaded();
   if(!m_IsAllocated)
   {
     return false;
@@ -595,6 +624,7 @@ bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointe
 template <typename T>
 bool DataArray<T>::copyIntoArray(Pointer dest) const
 {
+  ensureLoaded();
   if(m_IsAllocated && dest->isAllocated() && m_Array && dest->getPointer(0))
   {
     std::copy(cbegin(), cend(), dest->begin());
@@ -607,7 +637,83 @@ bool DataArray<T>::copyIntoArray(Pointer dest) const
 template <typename T>
 bool DataArray<T>::isAllocated() const
 {
-  return m_IsAllocated;
+  return m_IsAllocated || hasDeferredLoader();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::setDeferredLoader(const DeferredLoaderType& loader)
+{
+  if(m_IsAllocated || nullptr != m_Array || !loader)
+  {
+    return false;
+  }
+  auto state = std::make_shared<DeferredLoadState>();
+  state->loader = loader;
+  state->pending = true;
+  m_DeferredLoad = state;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::hasDeferredLoader() const
+{
+  return nullptr != m_DeferredLoad && m_DeferredLoad->pending.load(std::memory_order_acquire);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::loadDeferredData() const
+{
+  std::lock_guard<std::mutex> lock(m_DeferredLoad->mutex);
+  if(!m_DeferredLoad->pending.load(std::memory_order_acquire))
+  {
+    return m_DeferredLoad->error.load(std::memory_order_relaxed);
+  }
+  // The values and the error are published to the other threads only once pending is cleared
+  auto self = const_cast<DataArray<T>*>(this);
+  int32_t err = 0;
+  if(m_Size > 0)
+  {
+    self->m_Array = allocateStorage(m_Size);
+    if(nullptr == m_Array)
+    {
+      err = -10300;
+    }
+    else
+    {
+      self->m_IsAllocated = true;
+      self->m_OwnsData = true;
+      if(!m_DeferredLoad->loader(m_Array, m_Size, sizeof(T)))
+      {
+        // Whatever the loader left in the buffer is not data
+        std::fill_n(m_Array, m_Size, static_cast<T>(0));
+        err = -10301;
+      }
+    }
+  }
+  m_DeferredLoad->error.store(err, std::memory_order_relaxed);
+  m_DeferredLoad->pending.store(false, std::memory_order_release);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::getDeferredLoadError() const
+{
+  if(nullptr == m_DeferredLoad || m_DeferredLoad->pending.load(std::memory_order_acquire))
+  {
+    return 0;
+  }
+  return m_DeferredLoad->error.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::loadDeferredValues() const
+{
+  return ensureLoaded();
 }
 
 // -----------------------------------------------------------------------------
@@ -628,6 +734,7 @@ void DataArray<T>::takeOwnership()
 template <typename T>
 void DataArray<T>::releaseOwnership()
 {
+  ensureLoaded();
   m_OwnsData = false;
 }
 
@@ -635,6 +742,11 @@ void DataArray<T>::releaseOwnership()
 template <typename T>
 int32_t DataArray<T>::allocate()
 {
+  // An explicit allocation replaces the values that were going to be loaded
+  if(nullptr != m_DeferredLoad)
+  {
+    m_DeferredLoad->pending.store(false, std::memory_order_release);
+  }
   if((nullptr != m_Array) && m_OwnsData)
   {
     deallocate();
@@ -649,7 +761,7 @@ int32_t DataArray<T>::allocate()
   }
 
   size_t newSize = m_Size;
-  m_Array = new(std::nothrow) T[newSize]();
+  m_Array = allocateStorage(newSize);
   if(!m_Array)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -661,10 +773,85 @@ int32_t DataArray<T>::allocate()
   return 1;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::setStorage(const typename DataArrayStorage<T>::Pointer& storage)
+{
+  ensureLoaded();
+  m_Storage = storage;
+  if(!m_IsAllocated || nullptr == m_Array || m_Size == 0)
+  {
+    return 1;
+  }
+
+  T* newArray = allocateStorage(m_Size);
+  if(nullptr == newArray)
+  {
+    qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. ";
+    return -1;
+  }
+  std::copy(cbegin(), cend(), newArray);
+  if(m_OwnsData)
+  {
+    deallocate();
+  }
+  m_Array = newArray;
+  m_OwnsData = true;
+  m_IsAllocated = true;
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename DataArrayStorage<T>::Pointer DataArray<T>::getStorage() const
+{
+  return m_Storage;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+QString DataArray<T>::getStorageName() const
+{
+  if(!m_IsAllocated || nullptr == m_Array)
+  {
+    return QString();
+  }
+  if(nullptr != m_Storage)
+  {
+    return m_Storage->getStorageName();
+  }
+  if(DataArrayStorageSettings::IsMappedMemory(m_Array))
+  {
+    return MemoryMappedDataArrayStorage<T>::New()->getStorageName();
+  }
+  return InMemoryDataArrayStorage<T>::New()->getStorageName();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* DataArray<T>::allocateStorage(size_t numElements) const
+{
+  T* ptr = nullptr;
+  if(nullptr != m_Storage)
+  {
+    ptr = m_Storage->allocate(numElements);
+  }
+  else
+  {
+    ptr = DataArrayStorage<T>::CreateDefault(numElements)->allocate(numElements);
+  }
+  if(nullptr != ptr)
+  {
+    DataArrayStorageSettings::AddAllocatedBytes(numElements * sizeof(T));
+  }
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::initializeWithZeros()
 {
+  ensureLoaded();
   if(!m_IsAllocated || nullptr == m_Array)
   {
     return;
@@ -676,6 +863,7 @@ void DataArray<T>::initializeWithZeros()
 template <typename T>
 void DataArray<T>::initializeWithValue(T initValue, size_t offset)
 {
+  ensureLoaded();
   if(!m_IsAllocated || nullptr == m_Array)
   {
     return;
@@ -687,6 +875,7 @@ void DataArray<T>::initializeWithValue(T initValue, size_t offset)
 template <typename T>
 int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
 {
+  ensureLoaded();
   int32_t err = 0;
 
   // If nothing is to be erased just return
@@ -702,10 +891,10 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   }
 
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
-  // off the end of the array and return an error code.
-  for(const size_t& idx : idxs)
+  // off the end of the array, or that are not sorted and unique, and return an error code.
+  for(size_t i = 0; i < idxs.size(); ++i)
   {
-    if(idx * m_NumComponents > m_MaxId)
+    if(idxs[i] * m_NumComponents > m_MaxId || (i > 0 && idxs[i] <= idxs[i - 1]))
     {
       return -100;
     }
@@ -715,75 +904,56 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
 
   // Create a new m_Array to copy into
-  T* newArray = new T[newSize]();
+  T* newArray = allocateStorage(newSize);
+  if(nullptr == newArray)
+  {
+    return -101;
+  }
 
 #ifndef NDEBUG
   // Splat AB across the array so we know if we are copying the values or not
   std::memset(newArray, 0xAB, newSize * sizeof(T));
 #endif
 
-  size_t j = 0;
-  size_t k = 0;
-  // Find the first chunk to copy by walking the idxs array until we get an
-  // index that is NOT a continuous increment from the start
-  for(k = 0; k < idxs.size(); ++k)
-  {
-    if(j == idxs[k])
+  // Every run of kept tuples between two erased indices becomes one or more copy segments. Long runs are
+  // split so that a few large runs still spread across all threads.
+  struct CopySegment
+  {
+    size_t src;
+    size_t dest;
+    size_t count;
+  };
+  std::vector<CopySegment> segments;
+  segments.reserve(idxs.size() + 1);
+  size_t destElement = 0;
+  auto addRun = [&](size_t firstTuple, size_t endTuple) {
+    const size_t endElement = endTuple * m_NumComponents;
+    for(size_t srcElement = firstTuple * m_NumComponents; srcElement < endElement; srcElement += k_EraseSegmentSize)
     {
-      ++j;
+      const size_t count = std::min(k_EraseSegmentSize, endElement - srcElement);
+      segments.push_back({srcElement, destElement, count});
+      destElement += count;
     }
-    else
-    {
-      break;
-    }
-  }
-
-  // Only front elements are being dropped
-  if(k == idxs.size())
+  };
+  size_t runStart = 0;
+  for(const size_t& idx : idxs)
   {
-    auto srcBegin = begin() + (j * m_NumComponents);
-    auto srcEnd = srcBegin + (getNumberOfTuples() - idxs.size()) * m_NumComponents;
-    std::copy(srcBegin, srcEnd, newArray);
-    // We are done copying - delete the current m_Array
-    deallocate();
-    m_Size = newSize;
-    m_Array = newArray;
-    m_OwnsData = true;
-    m_MaxId = newSize - 1;
-    m_IsAllocated = true;
-    return 0;
+    addRun(runStart, idx);
+    runStart = idx + 1;
   }
+  addRun(runStart, getNumberOfTuples());
 
-  comp_dims_type srcIdx(idxs.size() + 1);
-  comp_dims_type destIdx(idxs.size() + 1);
-  comp_dims_type copyElements(idxs.size() + 1);
-  srcIdx[0] = 0;
-  destIdx[0] = 0;
-  copyElements[0] = (idxs[0] - 0) * m_NumComponents;
-
-  for(size_t i = 1; i < srcIdx.size(); ++i)
-  {
-    srcIdx[i] = (idxs[i - 1] + 1) * m_NumComponents;
-
-    if(i < srcIdx.size() - 1)
-    {
-      copyElements[i] = (idxs[i] - idxs[i - 1] - 1) * m_NumComponents;
-    }
-    else
+  // Copy the data
+  const T* src = m_Array;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, segments.size());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); ++i)
     {
-      copyElements[i] = (getNumberOfTuples() - idxs[i - 1] - 1) * m_NumComponents;
+      const CopySegment& segment = segments[i];
+      std::copy(src + segment.src, src + segment.src + segment.count, newArray + segment.dest);
     }
-    destIdx[i] = copyElements[i - 1] + destIdx[i - 1];
-  }
-
-  // Copy the data
-  for(size_t i = 0; i < srcIdx.size(); ++i)
-  {
-    auto srcBegin = begin() + srcIdx[i];
-    auto srcEnd = srcBegin + copyElements[i];
-    auto dstBegin = newArray + destIdx[i];
-    std::copy(srcBegin, srcEnd, dstBegin);
-  }
+  });
 
   // We are done copying - delete the current m_Array
   deallocate();
@@ -854,6 +1024,7 @@ int32_t DataArray<T>::getNumberOfComponents() const
 template <typename T>
 void* DataArray<T>::getVoidPointer(size_t i)
 {
+  ensureLoaded();
   if(i >= m_Size)
   {
     return nullptr;
@@ -866,6 +1037,7 @@ void* DataArray<T>::getVoidPointer(size_t i)
 template <typename T>
 T* DataArray<T>::getPointer(size_t i) const
 {
+  ensureLoaded();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -880,6 +1052,7 @@ template <typename T>
 T DataArray<T>::getValue(size_t i) const
 {
 #ifndef NDEBUG
+  Q_ASSERT(!hasDeferredLoader());
   if(m_Size > 0)
   {
     Q_ASSERT(i < m_Size);
@@ -893,6 +1066,7 @@ template <typename T>
 void DataArray<T>::setValue(size_t i, T value)
 {
 #ifndef NDEBUG
+  Q_ASSERT(!hasDeferredLoader());
   if(m_Size > 0)
   {
     Q_ASSERT(i < m_Size);
@@ -906,6 +1080,7 @@ template <typename T>
 T DataArray<T>::getComponent(size_t i, int32_t j) const
 {
 #ifndef NDEBUG
+  Q_ASSERT(!hasDeferredLoader());
   if(m_Size > 0)
   {
     Q_ASSERT(i * m_NumComponents + static_cast<size_t>(j) < m_Size);
@@ -919,6 +1094,7 @@ template <typename T>
 void DataArray<T>::setComponent(size_t i, int32_t j, T c)
 {
 #ifndef NDEBUG
+  Q_ASSERT(!hasDeferredLoader());
   if(m_Size > 0)
   {
     Q_ASSERT(i * m_NumComponents + static_cast<size_t>(j) < m_Size);
@@ -971,6 +1147,7 @@ void DataArray<T>::initializeTuple(size_t i, const void* p)
 template <typename T>
 void DataArray<T>::fillTuple(size_t i, T value)
 {
+  ensureLoaded();
   if(!m_IsAllocated)
   {
     return;
@@ -988,6 +1165,7 @@ void DataArray<T>::fillTuple(size_t i, T value)
 template <typename T>
 T* DataArray<T>::getTuplePointer(size_t tupleIndex) const
 {
+  ensureLoaded();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -1012,6 +1190,7 @@ void DataArray<T>::resizeTuples(size_t numTuples)
 template <typename T>
 void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
+  ensureLoaded();
   int32_t precision = out.realNumberPrecision();
   if constexpr(std::is_same_v<T, float>)
   {
@@ -1037,6 +1216,7 @@ void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 template <typename T>
 void DataArray<T>::printComponent(QTextStream& out, size_t i, int32_t j) const
 {
+  ensureLoaded();
   out << m_Array[i * m_NumComponents + static_cast<size_t>(j)];
 }
 
@@ -1108,6 +1288,7 @@ QString DataArray<T>::getTypeAsString() const
 template <typename T>
 int32_t DataArray<T>::writeH5Data(hid_t parentId, const comp_dims_type& tDims) const
 {
+  ensureLoaded();
   if(m_Array == nullptr)
   {
     return -85648;
@@ -1117,12 +1298,25 @@ int32_t DataArray<T>::writeH5Data(hid_t parentId, const comp_dims_type& tDims) c
 
 // -----------------------------------------------------------------------------
 template <typename T>
-int32_t DataArray<T>::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
+int32_t DataArray<T>::writeH5Data(hid_t parentId, const comp_dims_type& tDims, const H5DataArrayWriteOptions& options) const
 {
+  ensureLoaded();
   if(m_Array == nullptr)
   {
     return -85648;
   }
+  return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims, options);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
+{
+  // Only the description of the array is written, so a lazily loaded array does not need its values
+  if(m_Array == nullptr && !hasDeferredLoader())
+  {
+    return -85648;
+  }
   QString dimStr;
   int32_t precision = 0;
   QString xdmfTypeName;
@@ -1258,6 +1452,12 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
   // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
   // for deleting the memory
   p->releaseOwnership();
+
+  // The intermediate array used the default backend. Move the data if this array has its own.
+  if(nullptr != m_Storage && setStorage(m_Storage) < 0)
+  {
+    return -1;
+  }
   return err;
 }
 
@@ -1265,6 +1465,7 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
 template <typename T>
 void DataArray<T>::byteSwapElements()
 {
+  ensureLoaded();
   for(auto& value : *this)
   {
     value = byteSwap(value);
@@ -1274,107 +1475,125 @@ void DataArray<T>::byteSwapElements()
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::begin()
 {
+  ensureLoaded();
   return iterator(m_Array);
 }
 
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::end()
 {
+  ensureLoaded();
   return iterator(m_Array + m_Size);
 }
 
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::begin() const
 {
+  ensureLoaded();
   return const_iterator(m_Array);
 }
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::end() const
 {
+  ensureLoaded();
   return const_iterator(m_Array + m_Size);
 }
 
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::cbegin() const
 {
+  ensureLoaded();
   return begin();
 }
 
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::cend() const
 {
+  ensureLoaded();
   return end();
 }
 
 template <typename T>
 typename DataArray<T>::reverse_iterator DataArray<T>::rbegin()
 {
+  ensureLoaded();
   return std::make_reverse_iterator(end());
 }
 
 template <typename T>
 typename DataArray<T>::reverse_iterator DataArray<T>::rend()
 {
+  ensureLoaded();
   return std::make_reverse_iterator(begin());
 }
 
 template <typename T>
 typename DataArray<T>::const_reverse_iterator DataArray<T>::rbegin() const
 {
+  ensureLoaded();
   return std::make_reverse_iterator(end());
 }
 
 template <typename T>
 typename DataArray<T>::const_reverse_iterator DataArray<T>::rend() const
 {
+  ensureLoaded();
   return std::make_reverse_iterator(begin());
 }
 
 template <typename T>
 typename DataArray<T>::const_reverse_iterator DataArray<T>::crbegin() const
 {
+  ensureLoaded();
   return rbegin();
 }
 
 template <typename T>
 typename DataArray<T>::const_reverse_iterator DataArray<T>::crend() const
 {
+  ensureLoaded();
   return rend();
 }
 
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleBegin()
 {
+  ensureLoaded();
   return tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleEnd()
 {
+  ensureLoaded();
   return tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::tupleBegin() const
 {
+  ensureLoaded();
   return const_tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::tupleEnd() const
 {
+  ensureLoaded();
   return const_tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::constTupleBegin() const
 {
+  ensureLoaded();
   return tupleBegin();
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::constTupleEnd() const
 {
+  ensureLoaded();
   return tupleEnd();
 }
 
@@ -1443,6 +1662,7 @@ void DataArray<T>::pop_back()
 template <typename T>
 void DataArray<T>::clear()
 {
+  m_DeferredLoad = nullptr;
   if(nullptr != m_Array && m_OwnsData)
   {
     deallocate();
@@ -1503,7 +1723,7 @@ void DataArray<T>::deallocate()
       }
 #endif
 
-  delete[](m_Array);
+  DataArrayStorage<T>::Deallocate(m_Array);
 
   m_Array = nullptr;
   m_IsAllocated = false;
@@ -1531,6 +1751,10 @@ int32_t DataArray<T>::resizeTotalElements(size_t size)
 template <typename T>
 T* DataArray<T>::resizeAndExtend(size_t size)
 {
+  if(size != 0)
+  {
+    ensureLoaded();
+  }
   T* newArray = nullptr;
   size_t newSize = 0;
   size_t oldSize = 0;
@@ -1550,7 +1774,7 @@ T* DataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
 
-  newArray = new(std::nothrow) T[newSize]();
+  newArray = allocateStorage(newSize);
   if(!newArray)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -36,9 +36,11 @@
 #pragma once
 
 // STL Includes
+#include <atomic>
 #include <cassert>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -48,6 +50,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 
 /**
@@ -295,6 +298,36 @@ public:
    * @return
    */
   bool isAllocated() const override;
+
+  /**
+   * @brief Defers reading the values until they are first accessed through a bulk accessor such as
+   * getPointer(), getVoidPointer(), data() or the iterators, or until loadDeferredValues() is called.
+   * The per element accessors (operator[], at(), getValue(), setValue(), getComponent(), ...) do not
+   * load so they stay as cheap as a plain array access; they assert in debug builds that the values were
+   * loaded. The virtual accessors such as printTuple() and initializeTuple() load. The loader runs at most
+   * once, under a lock, so concurrent first accesses are safe.
+   * @param loader
+   * @return false if the array is already allocated
+   */
+  bool setDeferredLoader(const DeferredLoaderType& loader) override;
+
+  /**
+   * @brief Returns true if the values have not been loaded yet
+   * @return
+   */
+  bool hasDeferredLoader() const override;
+
+  /**
+   * @brief Returns the sticky error of the deferred load without triggering the load
+   * @return
+   */
+  int32_t getDeferredLoadError() const override;
+
+  /**
+   * @brief Loads the values now if they have not been loaded yet
+   * @return The sticky error of the deferred load, 0 if the values are valid
+   */
+  int32_t loadDeferredValues() const override;
   /**
    * @brief Gives this array a human readable name
    * @param name The name of this array
@@ -328,6 +361,28 @@ public:
    */
   int32_t allocate();
 
+  /**
+   * @brief Sets the storage backend used for all future allocations. Any data that is already
+   * allocated is moved into the new backend.
+   * @param storage The backend to use or nullptr to go back to the default chosen by DataArrayStorageSettings
+   * @return 1 on success, -1 if the data could not be moved
+   */
+  int32_t setStorage(const typename DataArrayStorage<T>::Pointer& storage);
+
+  /**
+   * @brief Returns the storage backend that was explicitly set on this array, which is nullptr
+   * when the array uses the default chosen by DataArrayStorageSettings.
+   * @return
+   */
+  typename DataArrayStorage<T>::Pointer getStorage() const;
+
+  /**
+   * @brief Returns the name of the storage backend that holds the current values, or an
+   * empty string if the array is not allocated.
+   * @return
+   */
+  QString getStorageName() const;
+
   /**
    * @brief Sets all the values to zero.
    */
@@ -511,6 +566,15 @@ public:
    */
   int32_t writeH5Data(hid_t parentId, const comp_dims_type& tDims) const override;
 
+  /**
+   * @brief Writes the array as a chunked and/or compressed dataset
+   * @param parentId
+   * @param tDims
+   * @param options
+   * @return
+   */
+  int32_t writeH5Data(hid_t parentId, const comp_dims_type& tDims, const H5DataArrayWriteOptions& options) const override;
+
   /**
    * @brief writeXdmfAttribute
    * @param out
@@ -1086,17 +1150,20 @@ public:
   inline reference operator[](size_type index)
   {
     assert(index < m_Size);
+    assert(!hasDeferredLoader());
     return m_Array[index];
   }
 
   inline const T& operator[](size_type index) const
   {
     assert(index < m_Size);
+    assert(!hasDeferredLoader());
     return m_Array[index];
   }
 
   inline reference at(size_type index)
   {
+    assert(!hasDeferredLoader());
     if(index >= m_Size)
     {
       throw std::out_of_range("DataArray subscript out of range");
@@ -1106,6 +1173,7 @@ public:
 
   inline const T& at(size_type index) const
   {
+    assert(!hasDeferredLoader());
     if(index >= m_Size)
     {
       throw std::out_of_range("DataArray subscript out of range");
@@ -1131,12 +1199,14 @@ public:
     return m_Array[m_MaxId];
   }
 
-  inline T* data() noexcept
+  inline T* data()
   {
+    ensureLoaded();
     return m_Array;
   }
-  inline const T* data() const noexcept
+  inline const T* data() const
   {
+    ensureLoaded();
     return m_Array;
   }
 
@@ -1232,7 +1302,50 @@ protected:
    */
   T* resizeAndExtend(size_t size);
 
+  /**
+   * @brief Allocates a zero initialized block from the explicit storage backend or from
+   * the default backend for a block of that size.
+   * @param numElements
+   * @return
+   */
+  T* allocateStorage(size_t numElements) const;
+
+  /**
+   * @brief Loads the values of a lazily loaded array if that has not happened yet
+   * @return The sticky error of the deferred load, 0 if the values are valid
+   */
+  inline int32_t ensureLoaded() const
+  {
+    if(nullptr == m_DeferredLoad)
+    {
+      return 0;
+    }
+    if(m_DeferredLoad->pending.load(std::memory_order_acquire))
+    {
+      return loadDeferredData();
+    }
+    // The error is written before pending is cleared, so the acquire above orders this read
+    return m_DeferredLoad->error.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Allocates the array and runs the deferred loader. A failure is recorded in the load state
+   * and the values of the array are zeroed.
+   * @return The error of the load
+   */
+  int32_t loadDeferredData() const;
+
 private:
+  struct DeferredLoadState
+  {
+    std::atomic_bool pending{false};
+    std::atomic<int32_t> error{0};
+    std::mutex mutex;
+    DeferredLoaderType loader;
+  };
+
+  typename DataArrayStorage<T>::Pointer m_Storage = nullptr;
+  std::shared_ptr<DeferredLoadState> m_DeferredLoad = nullptr;
   T* m_Array = nullptr;
   size_t m_Size = 0;
   size_t m_MaxId = 0;
@@ -0,0 +1,341 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayStorage.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include <QtCore/QDir>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#if defined(_WIN32)
+struct MappedRegion
+{
+  HANDLE file = INVALID_HANDLE_VALUE;
+  HANDLE mapping = nullptr;
+  void* base = nullptr;
+};
+#else
+struct MappedRegion
+{
+  void* base = nullptr;
+  size_t numBytes = 0;
+};
+#endif
+
+struct StorageState
+{
+  std::mutex mutex;
+  size_t threshold = 0;
+  QString directory;
+  std::map<void*, MappedRegion> regions;
+  // Lets UnmapMemory() skip the lock for the common case of plain heap blocks
+  std::atomic<size_t> numRegions = {0};
+  std::atomic<quint64> nextFileId = {0};
+
+  StorageState()
+  {
+    threshold = qgetenv("SIMPL_MMAP_THRESHOLD").toULongLong();
+    directory = QString::fromLocal8Bit(qgetenv("SIMPL_MMAP_DIR"));
+    if(directory.isEmpty())
+    {
+      directory = QDir::tempPath();
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+StorageState& GetStorageState()
+{
+  static StorageState state;
+  return state;
+}
+
+std::atomic<quint64> s_TotalAllocatedBytes = {0};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorageSettings::SetMemoryMapThreshold(size_t numBytes)
+{
+  StorageState& state = GetStorageState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.threshold = numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayStorageSettings::GetMemoryMapThreshold()
+{
+  StorageState& state = GetStorageState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorageSettings::SetMemoryMapDirectory(const QString& path)
+{
+  StorageState& state = GetStorageState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.directory = path;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayStorageSettings::GetMemoryMapDirectory()
+{
+  StorageState& state = GetStorageState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.directory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayStorageSettings::MapMemory(size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return nullptr;
+  }
+  StorageState& state = GetStorageState();
+  QString directory = GetMemoryMapDirectory();
+
+#if defined(_WIN32)
+  QString filePath = QDir::toNativeSeparators(QDir(directory).filePath(QString("SIMPL_%1_%2.mmap").arg(GetCurrentProcessId()).arg(state.nextFileId++)));
+  HANDLE file = CreateFileW(reinterpret_cast<LPCWSTR>(filePath.utf16()), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+  if(file == INVALID_HANDLE_VALUE)
+  {
+    return nullptr;
+  }
+  LARGE_INTEGER size;
+  size.QuadPart = static_cast<LONGLONG>(numBytes);
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+  if(mapping == nullptr)
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+  void* ptr = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, numBytes);
+  if(ptr == nullptr)
+  {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return nullptr;
+  }
+  MappedRegion region;
+  region.file = file;
+  region.mapping = mapping;
+  region.base = ptr;
+#else
+  QByteArray pathTemplate = QDir(directory).filePath("SIMPL_XXXXXX.mmap").toLocal8Bit();
+  int fd = mkstemps(pathTemplate.data(), 5);
+  if(fd < 0)
+  {
+    return nullptr;
+  }
+  // The mapping keeps the file alive, so it can be removed from the directory right away
+  unlink(pathTemplate.constData());
+  if(ftruncate(fd, static_cast<off_t>(numBytes)) != 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+  void* ptr = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(ptr == MAP_FAILED)
+  {
+    return nullptr;
+  }
+  MappedRegion region;
+  region.base = ptr;
+  region.numBytes = numBytes;
+#endif
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.regions[ptr] = region;
+  state.numRegions = state.regions.size();
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayStorageSettings::MapFile(const QString& filePath, quint64 offset, size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return nullptr;
+  }
+  StorageState& state = GetStorageState();
+
+  // The view has to start on a boundary of the system's allocation granularity
+#if defined(_WIN32)
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  const quint64 granularity = systemInfo.dwAllocationGranularity;
+#else
+  const quint64 granularity = static_cast<quint64>(sysconf(_SC_PAGESIZE));
+#endif
+  const quint64 viewOffset = offset - offset % granularity;
+  const size_t viewBytes = numBytes + static_cast<size_t>(offset - viewOffset);
+
+#if defined(_WIN32)
+  QString nativePath = QDir::toNativeSeparators(filePath);
+  HANDLE file = CreateFileW(reinterpret_cast<LPCWSTR>(nativePath.utf16()), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if(file == INVALID_HANDLE_VALUE)
+  {
+    return nullptr;
+  }
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  if(mapping == nullptr)
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+  ULARGE_INTEGER start;
+  start.QuadPart = viewOffset;
+  void* base = MapViewOfFile(mapping, FILE_MAP_COPY, start.HighPart, start.LowPart, viewBytes);
+  if(base == nullptr)
+  {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return nullptr;
+  }
+  MappedRegion region;
+  region.file = file;
+  region.mapping = mapping;
+  region.base = base;
+#else
+  int fd = open(filePath.toLocal8Bit().constData(), O_RDONLY);
+  if(fd < 0)
+  {
+    return nullptr;
+  }
+  // A private mapping can be written to without the changes reaching the file
+  void* base = mmap(nullptr, viewBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(viewOffset));
+  close(fd);
+  if(base == MAP_FAILED)
+  {
+    return nullptr;
+  }
+  MappedRegion region;
+  region.base = base;
+  region.numBytes = viewBytes;
+#endif
+
+  void* ptr = static_cast<char*>(base) + (offset - viewOffset);
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.regions[ptr] = region;
+  state.numRegions = state.regions.size();
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorageSettings::UnmapMemory(void* ptr)
+{
+  StorageState& state = GetStorageState();
+  // A mapped block is registered before its pointer is handed out, so no mapping can be
+  // released while the count is zero
+  if(state.numRegions == 0)
+  {
+    return false;
+  }
+
+  MappedRegion region;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto iter = state.regions.find(ptr);
+    if(iter == state.regions.end())
+    {
+      return false;
+    }
+    region = iter->second;
+    state.regions.erase(iter);
+    state.numRegions = state.regions.size();
+  }
+
+#if defined(_WIN32)
+  UnmapViewOfFile(region.base);
+  CloseHandle(region.mapping);
+  CloseHandle(region.file);
+#else
+  munmap(region.base, region.numBytes);
+#endif
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorageSettings::IsMappedMemory(const void* ptr)
+{
+  StorageState& state = GetStorageState();
+  if(state.numRegions == 0)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.regions.find(const_cast<void*>(ptr)) != state.regions.end();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorageSettings::AddAllocatedBytes(size_t numBytes)
+{
+  s_TotalAllocatedBytes.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 DataArrayStorageSettings::GetTotalAllocatedBytes()
+{
+  return s_TotalAllocatedBytes.load(std::memory_order_relaxed);
+}
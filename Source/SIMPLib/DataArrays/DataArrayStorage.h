@@ -0,0 +1,262 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <new>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DataArrayStorageSettings class holds the process wide settings that decide which
+ * storage backend a DataArray uses when it has not been given one explicitly. It also owns the
+ * bookkeeping for every memory mapped block so any DataArray can release a block no matter which
+ * backend allocated it.
+ */
+class SIMPLib_EXPORT DataArrayStorageSettings
+{
+public:
+  /**
+   * @brief Sets the allocation size, in bytes, at or above which new arrays are placed in a
+   * memory mapped scratch file instead of on the heap. A value of zero disables memory mapping.
+   * The initial value is read from the SIMPL_MMAP_THRESHOLD environment variable.
+   * @param numBytes
+   */
+  static void SetMemoryMapThreshold(size_t numBytes);
+
+  /**
+   * @brief Returns the allocation size at or above which arrays are memory mapped.
+   * @return
+   */
+  static size_t GetMemoryMapThreshold();
+
+  /**
+   * @brief Sets the directory the memory mapped scratch files are created in. The initial value is
+   * read from the SIMPL_MMAP_DIR environment variable and falls back to the system temp directory.
+   * @param path
+   */
+  static void SetMemoryMapDirectory(const QString& path);
+
+  /**
+   * @brief Returns the directory the memory mapped scratch files are created in.
+   * @return
+   */
+  static QString GetMemoryMapDirectory();
+
+  /**
+   * @brief Maps a zero filled block of the given size onto an anonymous scratch file. The file is
+   * removed from the file system as soon as the mapping exists so nothing is left behind on a crash.
+   * @param numBytes
+   * @return The address of the block or nullptr on failure
+   */
+  static void* MapMemory(size_t numBytes);
+
+  /**
+   * @brief Maps numBytes of an existing file, starting at offset, as a copy-on-write block. The
+   * values are paged in from the file as they are read and writes only touch private copies of
+   * the pages, so the file is never modified. The block is released with UnmapMemory().
+   *
+   * The file must not be truncated or written to by anyone while it is mapped. Reading a page past
+   * the new end of a truncated file raises SIGBUS and crashes the process, and pages that were not
+   * yet copied show whatever the file holds when they are first touched, so outside writes can
+   * silently change or corrupt the array values.
+   * @param filePath
+   * @param offset
+   * @param numBytes
+   * @return The address of the first mapped byte or nullptr on failure
+   */
+  static void* MapFile(const QString& filePath, quint64 offset, size_t numBytes);
+
+  /**
+   * @brief Unmaps a block returned by MapMemory() or MapFile().
+   * @param ptr
+   * @return false if the pointer was not returned by MapMemory()
+   */
+  static bool UnmapMemory(void* ptr);
+
+  /**
+   * @brief Returns true if the block was returned by MapMemory() or MapFile() and is still mapped.
+   * @param ptr
+   * @return
+   */
+  static bool IsMappedMemory(const void* ptr);
+
+  /**
+   * @brief Adds to the running total of bytes allocated for array elements by any backend.
+   * @param numBytes
+   */
+  static void AddAllocatedBytes(size_t numBytes);
+
+  /**
+   * @brief Returns the number of bytes allocated for array elements since the process started.
+   * The total only grows; take the difference of two calls to see what happened in between.
+   * @return
+   */
+  static quint64 GetTotalAllocatedBytes();
+
+public:
+  DataArrayStorageSettings() = delete;
+  DataArrayStorageSettings(const DataArrayStorageSettings&) = delete;            // Copy Constructor Not Implemented
+  DataArrayStorageSettings(DataArrayStorageSettings&&) = delete;                 // Move Constructor Not Implemented
+  DataArrayStorageSettings& operator=(const DataArrayStorageSettings&) = delete; // Copy Assignment Not Implemented
+  DataArrayStorageSettings& operator=(DataArrayStorageSettings&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The DataArrayStorage class is the storage policy behind DataArray<T>. A backend only decides
+ * where a block of elements lives; the DataArray keeps working on a plain T* so getPointer(), data()
+ * and the iterators are unaffected by the backend in use.
+ *
+ * Blocks change hands between arrays (see DataArray::WrapPointer() and releaseOwnership()) so they are
+ * always released through Deallocate(), which recognises the blocks of every backend.
+ */
+template <typename T>
+class DataArrayStorage
+{
+public:
+  using Self = DataArrayStorage<T>;
+  using Pointer = std::shared_ptr<Self>;
+
+  virtual ~DataArrayStorage() = default;
+
+  /**
+   * @brief Allocates a zero initialized block of elements
+   * @param numElements
+   * @return The block or nullptr on failure
+   */
+  virtual T* allocate(size_t numElements) = 0;
+
+  /**
+   * @brief Returns a human readable name for the backend
+   * @return
+   */
+  virtual QString getStorageName() const = 0;
+
+  /**
+   * @brief Releases a block that was allocated by any backend
+   * @param ptr
+   */
+  static void Deallocate(T* ptr)
+  {
+    if(nullptr != ptr && !DataArrayStorageSettings::UnmapMemory(ptr))
+    {
+      delete[](ptr);
+    }
+  }
+
+  /**
+   * @brief Returns the backend an array of the given size should use according to the
+   * current DataArrayStorageSettings.
+   * @param numElements
+   * @return
+   */
+  static Pointer CreateDefault(size_t numElements);
+
+protected:
+  DataArrayStorage() = default;
+};
+
+/**
+ * @brief Keeps the elements on the heap. This is the default backend.
+ */
+template <typename T>
+class InMemoryDataArrayStorage : public DataArrayStorage<T>
+{
+public:
+  using Self = InMemoryDataArrayStorage<T>;
+  using Pointer = std::shared_ptr<Self>;
+
+  static Pointer New()
+  {
+    return Pointer(new Self());
+  }
+
+  ~InMemoryDataArrayStorage() override = default;
+
+  T* allocate(size_t numElements) override
+  {
+    return new(std::nothrow) T[numElements]();
+  }
+
+  QString getStorageName() const override
+  {
+    return "In Memory";
+  }
+
+protected:
+  InMemoryDataArrayStorage() = default;
+};
+
+/**
+ * @brief Keeps the elements in a memory mapped scratch file so arrays larger than physical
+ * memory can be processed with the operating system paging the data in and out as it is touched.
+ */
+template <typename T>
+class MemoryMappedDataArrayStorage : public DataArrayStorage<T>
+{
+public:
+  using Self = MemoryMappedDataArrayStorage<T>;
+  using Pointer = std::shared_ptr<Self>;
+
+  static Pointer New()
+  {
+    return Pointer(new Self());
+  }
+
+  ~MemoryMappedDataArrayStorage() override = default;
+
+  T* allocate(size_t numElements) override
+  {
+    return reinterpret_cast<T*>(DataArrayStorageSettings::MapMemory(numElements * sizeof(T)));
+  }
+
+  QString getStorageName() const override
+  {
+    return "Memory Mapped";
+  }
+
+protected:
+  MemoryMappedDataArrayStorage() = default;
+};
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename DataArrayStorage<T>::Pointer DataArrayStorage<T>::CreateDefault(size_t numElements)
+{
+  size_t threshold = DataArrayStorageSettings::GetMemoryMapThreshold();
+  if(threshold > 0 && numElements * sizeof(T) >= threshold)
+  {
+    return MemoryMappedDataArrayStorage<T>::New();
+  }
+  return InMemoryDataArrayStorage<T>::New();
+}
@@ -35,8 +35,10 @@
 
 #pragma once
 
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include <QtCore/QString>
@@ -44,7 +46,14 @@
 #include "SIMPLib/SIMPLib.h"
 
 /**
- * @brief
+ * @brief DynamicListArray holds a variable length list of K values for each of its entries, such as
+ * the elements that use a vertex or the neighbors of an element.
+ *
+ * All lists live in a single contiguous arena laid out in CSR order: the list of entry i starts at
+ * offset i of a prefix sum over the list sizes. The arena is sized once by allocateLists(), so
+ * building the connectivity of a large mesh costs one allocation instead of one per entry. A list
+ * that is later set to more values than its slot holds is moved out of the arena into its own
+ * allocation.
  */
 template <typename T, typename K>
 class DynamicListArray
@@ -99,22 +108,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "ElementList" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -145,13 +139,14 @@ public:
     {
       linkCounts[ptId] = this->m_Array[ptId].ncells;
     }
-    // Allocate all that in the copy
+    // Allocate all that in the copy and copy each list into its slot of the arena
     copy->allocateLists(linkCounts);
-    // Copy the data from the original to the new
     for(size_t ptId = 0; ptId < m_Size; ptId++)
     {
-      ElementList& elementList = getElementList(ptId);
-      copy->setElementList(ptId, elementList);
+      if(linkCounts[ptId] > 0)
+      {
+        ::memcpy(copy->m_Array[ptId].cells, m_Array[ptId].cells, sizeof(K) * linkCounts[ptId]);
+      }
     }
     return copy;
   }
@@ -190,16 +185,28 @@ public:
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+
+    size_t capacity = m_Offsets[ptId + 1] - m_Offsets[ptId];
+    if(static_cast<size_t>(nCells) <= capacity)
     {
-      delete[] this->m_Array[ptId].cells;
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      // The list fits in its slot of the arena. The source may be the current list so use memmove
+      K* dst = m_Arena.get() + m_Offsets[ptId];
+      if(nCells > 0)
+      {
+        ::memmove(dst, data, sizeof(K) * nCells);
+      }
+      m_Array[ptId].ncells = nCells;
+      m_Array[ptId].cells = (nCells > 0) ? dst : nullptr;
+      m_Overflow.erase(ptId);
+      return true;
     }
-    m_Array[ptId].ncells = nCells;
+
     // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+    std::unique_ptr<K[]> cells(new K[nCells]);
+    ::memcpy(cells.get(), data, sizeof(K) * nCells);
+    m_Array[ptId].ncells = nCells;
+    m_Array[ptId].cells = cells.get();
+    m_Overflow[ptId] = std::move(cells);
     return true;
   }
 
@@ -211,23 +218,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      delete[] this->m_Array[ptId].cells;
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -251,85 +242,160 @@ public:
   }
 
   /**
-   * @brief deserializeLinks
+   * @brief Returns the size in bytes of the serialized form of the first nElements lists. Each list is
+   * stored as its number of values, as a T, followed by its values.
+   * @param nElements
+   * @return
+   */
+  size_t getSerializedSize(size_t nElements) const
+  {
+    size_t total = 0;
+    for(size_t i = 0; i < nElements; i++)
+    {
+      total += static_cast<size_t>(m_Array[i].ncells);
+    }
+    return nElements * sizeof(T) + total * sizeof(K);
+  }
+
+  /**
+   * @brief Writes the serialized form of the first nElements lists into buffer, which must hold at least
+   * getSerializedSize(nElements) bytes.
    * @param buffer
    * @param nElements
    */
-  void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
+  void serializeLinks(uint8_t* buffer, size_t nElements) const
   {
     size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      T ncells = m_Array[i].ncells;
+      ::memcpy(buffer + offset, &ncells, sizeof(T));
+      offset += sizeof(T);
+      if(ncells > 0)
+      {
+        ::memcpy(buffer + offset, m_Array[i].cells, ncells * sizeof(K));
+        offset += ncells * sizeof(K);
+      }
+    }
+  }
 
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
+  /**
+   * @brief Rebuilds nElements lists from their serialized form. The list sizes are gathered first so that the
+   * values are copied straight into a single arena.
+   * @param buffer
+   * @param nElements
+   * @return false if the buffer is too short to hold nElements lists.
+   */
+  bool deserializeLinks(const std::vector<uint8_t>& buffer, size_t nElements)
+  {
+    std::vector<T> linkCounts(nElements, 0);
+    size_t offset = 0;
     for(size_t i = 0; i < nElements; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      if(offset + sizeof(T) > buffer.size())
+      {
+        allocate(0);
+        return false;
+      }
+      T ncells = 0;
+      ::memcpy(&ncells, buffer.data() + offset, sizeof(T));
+      linkCounts[i] = ncells;
+      offset += sizeof(T) + static_cast<size_t>(ncells) * sizeof(K);
+    }
+    if(offset > buffer.size())
+    {
+      allocate(0);
+      return false;
     }
+
+    allocateLists(linkCounts);
+    offset = 0;
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      offset += sizeof(T);
+      if(linkCounts[i] > 0)
+      {
+        ::memcpy(this->m_Array[i].cells, buffer.data() + offset, linkCounts[i] * sizeof(K)); // Copy from the buffer into the arena
+        offset += linkCounts[i] * sizeof(K);
+      }
+    }
+    return true;
   }
 
   /**
-   * @brief
+   * @brief Allocates one list per entry of linkCounts, each sized to hold the given number of values. All the
+   * lists share a single arena allocation.
    * @param linkCounts
    */
   template <typename Container>
   void allocateLists(const Container& linkCounts)
   {
     allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+    for(size_t i = 0; i < m_Size; i++)
+    {
+      m_Offsets[i + 1] = m_Offsets[i] + static_cast<size_t>(linkCounts[i]);
+    }
+    // Default initialization leaves the values uninitialized, which is what the old per list "new K[n]" did
+    m_Arena.reset(m_Offsets[m_Size] > 0 ? new K[m_Offsets[m_Size]] : nullptr);
+    for(size_t i = 0; i < m_Size; i++)
     {
       this->m_Array[i].ncells = linkCounts[i];
-      if(linkCounts[i] > 0)
-      {
-        this->m_Array[i].cells = new K[this->m_Array[i].ncells];
-      }
+      this->m_Array[i].cells = (linkCounts[i] > 0) ? m_Arena.get() + m_Offsets[i] : nullptr;
     }
   }
 
-protected:
-  DynamicListArray() = default;
-
-  //----------------------------------------------------------------------------
-  // This will allocate memory to hold all the NeighborList structures where each
-  // structure is initialized to Zero Entries and a nullptr Pointer
-  void allocate(size_t sz)
+  /**
+   * @brief Replaces all the lists at once. Entry i receives linkCounts[i] values taken in order from values,
+   * which are copied into the arena with a single copy.
+   * @param linkCounts
+   * @param values
+   * @param numValues
+   * @return false if the sum of linkCounts does not match the number of values.
+   */
+  template <typename Container>
+  bool setElementLists(const Container& linkCounts, const K* values, size_t numValues)
   {
-    static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
-
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
+    size_t total = 0;
+    for(size_t i = 0; i < static_cast<size_t>(linkCounts.size()); i++)
     {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
+      total += static_cast<size_t>(linkCounts[i]);
     }
-    // Now delete all the "ElementList" structures
-    if(this->m_Array != nullptr)
+    if(total != numValues)
     {
-      delete[] this->m_Array;
+      return false;
     }
 
-    this->m_Size = sz;
-    // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
-
-    // Initialize each structure to have 0 entries and nullptr pointer.
-    for(size_t i = 0; i < sz; i++)
+    allocateLists(linkCounts);
+    if(numValues > 0)
     {
-      this->m_Array[i] = linkInit;
+      ::memcpy(m_Arena.get(), values, sizeof(K) * numValues);
     }
+    return true;
+  }
+
+protected:
+  DynamicListArray() = default;
+
+  //----------------------------------------------------------------------------
+  // This will allocate memory to hold all the ElementList structures where each
+  // structure is initialized to Zero Entries and a nullptr Pointer. Any previous
+  // lists are released.
+  void allocate(size_t sz)
+  {
+    m_Overflow.clear();
+    m_Arena.reset();
+
+    this->m_Size = sz;
+    // Value initialization sets every structure to 0 entries and a nullptr pointer
+    this->m_Array.reset(new ElementList[sz]());
+    m_Offsets.assign(sz + 1, 0);
   }
 
 private:
-  ElementList* m_Array = nullptr; // pointer to data
+  std::unique_ptr<ElementList[]> m_Array; // One view per entry into the arena or into m_Overflow
+  std::unique_ptr<K[]> m_Arena;           // All the lists, stored back to back
+  std::vector<size_t> m_Offsets = {0};    // Start of the slot of each entry in m_Arena
+  std::unordered_map<size_t, std::unique_ptr<K[]>> m_Overflow; // Lists that outgrew their slot
   size_t m_Size = 0;
 };
 
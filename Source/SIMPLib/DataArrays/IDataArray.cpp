@@ -30,6 +30,46 @@ IDataArray::IDataArray(const QString& name)
 // -----------------------------------------------------------------------------
 IDataArray::~IDataArray() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t IDataArray::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims, const H5DataArrayWriteOptions& options) const
+{
+  return writeH5Data(parentId, tDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::setDeferredLoader(const DeferredLoaderType& loader)
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::hasDeferredLoader() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t IDataArray::getDeferredLoadError() const
+{
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t IDataArray::loadDeferredValues() const
+{
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
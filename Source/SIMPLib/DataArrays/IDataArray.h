@@ -11,6 +11,7 @@
 #pragma once
 
 //-- C++
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,7 @@
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
+struct H5DataArrayWriteOptions;
 
 /**
  * @class IDataArray IDataArray.h PathToHeader/IDataArray.h
@@ -256,6 +258,16 @@ public:
    */
   virtual int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const = 0;
 
+  /**
+   * @brief writeH5Data Writes the array using the chunking and compression settings in options. Arrays
+   * that do not support chunked datasets ignore the options.
+   * @param parentId
+   * @param tDims
+   * @param options
+   * @return
+   */
+  virtual int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims, const H5DataArrayWriteOptions& options) const;
+
   /**
    * @brief readH5Data
    * @param parentId
@@ -263,6 +275,42 @@ public:
    */
   virtual int32_t readH5Data(hid_t parentId) = 0;
 
+  /**
+   * @brief Fills a freshly allocated buffer with the values of a lazily loaded array
+   */
+  using DeferredLoaderType = std::function<bool(void* buffer, size_t numElements, size_t typeSize)>;
+
+  /**
+   * @brief Defers reading the values of an unallocated array until they are first accessed. The array
+   * reports itself as allocated; the first bulk accessor or loadDeferredValues() call allocates the
+   * array and calls the loader.
+   * @param loader
+   * @return false if the array class does not support deferred loading or the array is already allocated
+   */
+  virtual bool setDeferredLoader(const DeferredLoaderType& loader);
+
+  /**
+   * @brief Returns true if the values of the array have not been loaded yet
+   * @return
+   */
+  virtual bool hasDeferredLoader() const;
+
+  /**
+   * @brief Returns the error of a lazily loaded array whose values could not be loaded: -10300 if the
+   * values could not be allocated and -10301 if the loader failed. The error is sticky; it is 0 for
+   * arrays that were never deferred or that loaded successfully.
+   * @return
+   */
+  virtual int32_t getDeferredLoadError() const;
+
+  /**
+   * @brief Loads the values of a lazily loaded array now if that has not happened yet. Bulk accessors
+   * such as getVoidPointer() load on their own, but per element accessors do not, so code that only
+   * uses those must call this first. The prerequisite array lookups of AttributeMatrix do.
+   * @return The sticky error of the deferred load, 0 if the values are valid
+   */
+  virtual int32_t loadDeferredValues() const;
+
   /**
    * @brief writeXdmfAttribute
    * @param out
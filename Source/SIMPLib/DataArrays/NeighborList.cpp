@@ -1,5 +1,7 @@
 #include "NeighborList.hpp"
 
+#include <algorithm>
+
 #include <QtCore/QMap>
 #include <QtCore/QTextStream>
 
@@ -12,6 +14,7 @@ using namespace H5Support;
 #include "SIMPLib/Common/Constants.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -307,6 +310,8 @@ int NeighborList<T>::eraseTuples(const std::vector<size_t>& idxs)
     return 0;
   }
 
+  expandLists();
+
   size_t arraySize = m_Array.size();
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
@@ -347,6 +352,7 @@ int NeighborList<T>::eraseTuples(const std::vector<size_t>& idxs)
 template <typename T>
 int NeighborList<T>::copyTuple(size_t currentPos, size_t newPos)
 {
+  expandLists();
   m_Array[newPos] = m_Array[currentPos];
   return 0;
 }
@@ -359,6 +365,7 @@ bool NeighborList<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
   {
     return false;
   }
+  expandLists();
   if(destTupleOffset >= m_Array.size())
   {
     return false;
@@ -434,6 +441,10 @@ size_t NeighborList<T>::getNumberOfTuples() const
 template <typename T>
 size_t NeighborList<T>::getSize() const
 {
+  if(m_Compact.load(std::memory_order_acquire))
+  {
+    return m_Values.size();
+  }
   size_t total = 0;
   for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
   {
@@ -487,8 +498,7 @@ size_t NeighborList<T>::getTypeSize() const
 template <typename T>
 void NeighborList<T>::initializeWithZeros()
 {
-  m_Array.clear();
-  m_IsAllocated = false;
+  clearAllLists();
 }
 
 // -----------------------------------------------------------------------------
@@ -503,7 +513,11 @@ IDataArray::Pointer NeighborList<T>::deepCopy(bool forceNoAllocate) const
 
   typename NeighborList<T>::Pointer daCopyPtr = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), allocate);
 
-  if(m_IsAllocated && !forceNoAllocate)
+  if(m_IsAllocated && !forceNoAllocate && m_Compact.load(std::memory_order_acquire))
+  {
+    daCopyPtr->setCompactLists(m_Offsets, m_Values);
+  }
+  else if(m_IsAllocated && !forceNoAllocate)
   {
     size_t count = (m_IsAllocated ? getNumberOfTuples() : 0);
     for(size_t i = 0; i < count; i++)
@@ -520,6 +534,25 @@ template <typename T>
 int32_t NeighborList<T>::resizeTotalElements(size_t size)
 {
   // std::cout << "NeighborList::resizeTotalElements(" << size << ")" << std::endl;
+  if(m_Compact.load(std::memory_order_acquire))
+  {
+    // Lists added at the end are empty, lists removed from the end take their values with them
+    size_t oldLists = m_Offsets.empty() ? 0 : m_Offsets.size() - 1;
+    if(size < oldLists)
+    {
+      m_Offsets.resize(size + 1);
+      m_Values.resize(m_Offsets.back());
+    }
+    else
+    {
+      uint64_t last = m_Offsets.empty() ? 0 : m_Offsets.back();
+      m_Offsets.resize(size + 1, last);
+    }
+    m_NumTuples = size;
+    m_IsAllocated = (size != 0);
+    return 1;
+  }
+
   size_t old = m_Array.size();
   m_Array.resize(size);
   m_NumTuples = size;
@@ -551,13 +584,11 @@ void NeighborList<T>::resizeTuples(size_t numTuples)
 template <typename T>
 void NeighborList<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
-  SharedVectorType sharedVec = m_Array[i];
-  VectorType* vec = sharedVec.get();
-  size_t size = vec->size();
-  out << size;
-  for(size_t j = 0; j < size; j++)
+  ConstListView list = getListView(static_cast<int>(i));
+  out << list.size();
+  for(const auto& value : list)
   {
-    out << delimiter << vec->at(j);
+    out << delimiter << value;
   }
 }
 
@@ -571,6 +602,13 @@ void NeighborList<T>::printComponent(QTextStream& out, size_t i, int j) const
 // -----------------------------------------------------------------------------
 template <typename T>
 int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
+{
+  return writeH5Data(parentId, tDims, H5DataArrayWriteOptions());
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims, const H5DataArrayWriteOptions& options) const
 {
   int err = 0;
 
@@ -587,27 +625,27 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
     numNeighborsArrayName = getName() + "_NumNeighbors";
   }
 
-  Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), numNeighborsArrayName, true);
+  const size_t numLists = static_cast<size_t>(getNumberOfLists());
+  Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, numNeighborsArrayName, true);
   int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
-  size_t total = 0;
-  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
   {
-    numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
-    total += m_Array[dIdx]->size();
+    numNeighbors[dIdx] = getListSize(static_cast<int>(dIdx));
   }
+  const size_t total = getSize();
 
   // Check to see if the NumNeighbors is already written to the file
   bool rewrite = false;
   if(!QH5Lite::datasetExists(parentId, numNeighborsArrayName))
   {
     // The NumNeighbors Array is NOT already in the file so write it to the file
-    numNeighborsPtr->writeH5Data(parentId, tDims);
+    numNeighborsPtr->writeH5Data(parentId, tDims, options);
   }
   else
   {
     // The NumNeighbors array is in the dream3d file so read it up into memory and compare with what
     // we have in memory.
-    std::vector<int32_t> fileNumNeigh(m_Array.size());
+    std::vector<int32_t> fileNumNeigh(numLists);
     err = H5Lite::readVectorDataset(parentId, numNeighborsArrayName.toStdString(), fileNumNeigh);
     if(err < 0)
     {
@@ -632,27 +670,29 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
   // the top of the function versus what is in memory
   if(rewrite)
   {
-    numNeighborsPtr->writeH5Data(parentId, tDims);
+    numNeighborsPtr->writeH5Data(parentId, tDims, options);
   }
 
-  // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
-  // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
-  // is complete.
-  QVector<T> flat(total);
-  size_t currentStart = 0;
-  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  // The compact layout is exactly what goes into the file and is written as is. Separate lists are
+  // concatenated into a single array first, which can balloon the memory size temporarily until this
+  // operation is complete.
+  VectorType flatCopy;
+  const T* flat = m_Values.data();
+  if(!m_Compact.load(std::memory_order_acquire))
   {
-    size_t nEle = m_Array[dIdx]->size();
-    if(nEle == 0)
+    flatCopy.resize(total);
+    size_t currentStart = 0;
+    for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
     {
-      continue;
+      size_t nEle = m_Array[dIdx]->size();
+      if(nEle == 0)
+      {
+        continue;
+      }
+      ::memcpy(flatCopy.data() + currentStart, m_Array[dIdx]->data(), nEle * sizeof(T));
+      currentStart += nEle;
     }
-    T* start = m_Array[dIdx]->data(); // get theNeighborList<T>::Pointer to the front of the array
-    //    T* end = start + nEle; // get theNeighborList<T>::Pointer to the end of the array
-    T* dst = flat.data() + currentStart;
-    ::memcpy(dst, start, nEle * sizeof(T));
-
-    currentStart += m_Array[dIdx]->size();
+    flat = flatCopy.data();
   }
 
   // Now we can actually write the actual array data.
@@ -660,7 +700,18 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
   hsize_t dims[1] = {total};
   if(total > 0)
   {
-    err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flat.data());
+    if(options.isChunked())
+    {
+      // The flattened list does not share the tuple dimensions so it always gets an automatic chunk shape
+      H5DataArrayWriteOptions flatOptions = options;
+      flatOptions.chunkDims.clear();
+      std::vector<hsize_t> chunkDims = H5DataArrayWriter::createChunkDims(QVector<hsize_t>(1, total), 1, sizeof(T), flatOptions);
+      err = H5DataArrayWriter::writeChunkedPointerDataset(parentId, getName(), rank, dims, chunkDims.data(), flat, flatOptions);
+    }
+    else
+    {
+      err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flat);
+    }
     if(err < 0)
     {
       return -605;
@@ -771,8 +822,8 @@ QString NeighborList<T>::getInfoString(SIMPL::InfoStringFormat format) const
     QString compDimStr = "(variable)";
 
     ss << "+ Comp. Dims: " << compDimStr << "\n";
-    ss << "+ Total Elements:  " << m_Array.size() << "\n";
-    ss << "+ Minimum Memory: " << (m_Array.size() * sizeof(T)) << "\n";
+    ss << "+ Total Elements:  " << getNumberOfLists() << "\n";
+    ss << "+ Minimum Memory: " << (getSize() * sizeof(T)) << "\n";
   }
   return info;
 }
@@ -783,7 +834,8 @@ int NeighborList<T>::readH5Data(hid_t parentId)
 {
   int err = 0;
 
-  std::vector<T> flat;
+  // The flat dataset is read straight into the compact layout
+  VectorType flat;
   err = QH5Lite::readVectorDataset(parentId, getName(), flat);
   if(err < 0)
   {
@@ -821,32 +873,15 @@ int NeighborList<T>::readH5Data(hid_t parentId)
     return -703;
   }
 
-  // int32_t totalElements = std::accumulate(numNeighbors.begin(), numNeighbors.end(), 0);
-
-  // Loop over all the entries and make new Vectors to hold the incoming data
-  m_Array.resize(numNeighbors.size());
-  m_IsAllocated = true;
-  size_t currentStart = 0;
-  qint32 count = static_cast<qint32>(numNeighbors.size());
-  for(QVector<int32_t>::size_type dIdx = 0; dIdx < count; ++dIdx)
+  OffsetsType offsets(numNeighbors.size() + 1, 0);
+  for(size_t dIdx = 0; dIdx < numNeighbors.size(); ++dIdx)
   {
-    size_t nEle = numNeighbors[dIdx];
-    if(nEle > 0)
-    {
-      m_Array[dIdx] = SharedVectorType(new VectorType(numNeighbors[dIdx]));
-
-      T* dst = m_Array[dIdx]->data(); // get theNeighborList<T>::Pointer to the front of the array
-      //    T* end = start + nEle; // get theNeighborList<T>::Pointer to the end of the array
-      T* start = flat.data() + currentStart;
-      ::memcpy(dst, start, nEle * sizeof(T));
-      currentStart += nEle;
-    }
-    else
-    {
-      m_Array[dIdx] = SharedVectorType(new VectorType(0));
-    }
+    offsets[dIdx + 1] = offsets[dIdx] + static_cast<uint64_t>(std::max(numNeighbors[dIdx], 0));
+  }
+  if(!setCompactLists(std::move(offsets), std::move(flat)))
+  {
+    return -704;
   }
-  m_NumTuples = m_Array.size(); // Sync up the numTuples property with the size of the internal array
   return err;
 }
 
@@ -854,6 +889,7 @@ int NeighborList<T>::readH5Data(hid_t parentId)
 template <typename T>
 void NeighborList<T>::addEntry(int grainId, T value)
 {
+  expandLists();
   if(grainId >= static_cast<int>(m_Array.size()))
   {
     size_t old = m_Array.size();
@@ -874,6 +910,9 @@ template <typename T>
 void NeighborList<T>::clearAllLists()
 {
   m_Array.clear();
+  OffsetsType().swap(m_Offsets);
+  VectorType().swap(m_Values);
+  m_Compact.store(false, std::memory_order_release);
   m_IsAllocated = false;
 }
 
@@ -881,6 +920,7 @@ void NeighborList<T>::clearAllLists()
 template <typename T>
 void NeighborList<T>::setList(int grainId, SharedVectorType neighborList)
 {
+  expandLists();
   if(grainId >= static_cast<int>(m_Array.size()))
   {
     size_t old = m_Array.size();
@@ -899,25 +939,23 @@ void NeighborList<T>::setList(int grainId, SharedVectorType neighborList)
 template <typename T>
 T NeighborList<T>::getValue(int grainId, int index, bool& ok) const
 {
-#ifndef NDEBUG
-  if(m_Array.size() > 0u)
-  {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
-  }
-#endif
-  SharedVectorType vec = m_Array[grainId];
-  if(index < 0 || static_cast<size_t>(index) >= vec->size())
+  ConstListView list = getListView(grainId);
+  if(index < 0 || static_cast<size_t>(index) >= list.size())
   {
     ok = false;
     return -1;
   }
-  return (*vec)[index];
+  return list[index];
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 int NeighborList<T>::getNumberOfLists() const
 {
+  if(m_Compact.load(std::memory_order_acquire))
+  {
+    return m_Offsets.empty() ? 0 : static_cast<int>(m_Offsets.size() - 1);
+  }
   return static_cast<int>(m_Array.size());
 }
 
@@ -925,19 +963,14 @@ int NeighborList<T>::getNumberOfLists() const
 template <typename T>
 int NeighborList<T>::getListSize(int grainId) const
 {
-#ifndef NDEBUG
-  if(m_Array.size() > 0u)
-  {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
-  }
-#endif
-  return static_cast<int>(m_Array[grainId]->size());
+  return static_cast<int>(getListView(grainId).size());
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int grainId) const
 {
+  expandListsLocked();
 #ifndef NDEBUG
   if(m_Array.size() > 0u)
   {
@@ -949,8 +982,9 @@ typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int grai
 
 // -----------------------------------------------------------------------------
 template <typename T>
-typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int grainId) const
+typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int grainId)
 {
+  expandListsLocked();
 #ifndef NDEBUG
   if(m_Array.size() > 0u)
   {
@@ -962,16 +996,27 @@ typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int grainId)
 
 // -----------------------------------------------------------------------------
 template <typename T>
-typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int grainId) const
+typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int grainId) const
 {
+  if(m_Compact.load(std::memory_order_acquire))
+  {
+    return std::make_shared<VectorType>(copyOfList(grainId));
+  }
 #ifndef NDEBUG
   if(m_Array.size() > 0u)
   {
     Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
   }
 #endif
+  return m_Array[grainId];
+}
 
-  VectorType copy(*(m_Array[grainId]));
+// -----------------------------------------------------------------------------
+template <typename T>
+typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int grainId) const
+{
+  ConstListView list = getListView(grainId);
+  VectorType copy(list.begin(), list.end());
   return copy;
 }
 
@@ -979,6 +1024,7 @@ typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int grainId) co
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](int grainId)
 {
+  expandListsLocked();
 #ifndef NDEBUG
   if(m_Array.size() > 0u)
   {
@@ -992,6 +1038,7 @@ typename NeighborList<T>::VectorType& NeighborList<T>::operator[](int grainId)
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](size_t grainId)
 {
+  expandListsLocked();
 #ifndef NDEBUG
   if(m_Array.size() > 0ul)
   {
@@ -1001,6 +1048,121 @@ typename NeighborList<T>::VectorType& NeighborList<T>::operator[](size_t grainId
   return *(m_Array[grainId]);
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+typename NeighborList<T>::ConstListView NeighborList<T>::getListView(int grainId) const
+{
+  if(m_Compact.load(std::memory_order_acquire))
+  {
+    Q_ASSERT(static_cast<size_t>(grainId) + 1 < m_Offsets.size());
+    const uint64_t start = m_Offsets[grainId];
+    return ConstListView(m_Values.data() + start, static_cast<size_t>(m_Offsets[grainId + 1] - start));
+  }
+#ifndef NDEBUG
+  if(m_Array.size() > 0u)
+  {
+    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+  }
+#endif
+  const VectorType& list = *(m_Array[grainId]);
+  return ConstListView(list.data(), list.size());
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool NeighborList<T>::setCompactLists(OffsetsType offsets, VectorType values)
+{
+  if(offsets.empty())
+  {
+    offsets.push_back(0);
+  }
+  if(offsets.front() != 0 || offsets.back() != values.size())
+  {
+    return false;
+  }
+  for(size_t i = 1; i < offsets.size(); i++)
+  {
+    if(offsets[i] < offsets[i - 1])
+    {
+      return false;
+    }
+  }
+
+  m_Array.clear();
+  m_Offsets = std::move(offsets);
+  m_Values = std::move(values);
+  m_NumTuples = m_Offsets.size() - 1;
+  m_IsAllocated = true;
+  m_Compact.store(true, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::compact()
+{
+  if(m_Compact.load(std::memory_order_acquire))
+  {
+    return;
+  }
+
+  OffsetsType offsets(m_Array.size() + 1, 0);
+  for(size_t i = 0; i < m_Array.size(); i++)
+  {
+    offsets[i + 1] = offsets[i] + m_Array[i]->size();
+  }
+  VectorType values(offsets.back());
+  for(size_t i = 0; i < m_Array.size(); i++)
+  {
+    std::copy(m_Array[i]->begin(), m_Array[i]->end(), values.begin() + offsets[i]);
+  }
+  bool allocated = m_IsAllocated;
+  setCompactLists(std::move(offsets), std::move(values));
+  m_IsAllocated = allocated;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool NeighborList<T>::isCompact() const
+{
+  return m_Compact.load(std::memory_order_acquire);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::expandLists()
+{
+  expandListsLocked();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::expandListsLocked() const
+{
+  if(!m_Compact.load(std::memory_order_acquire))
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_ExpandMutex);
+  if(!m_Compact.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  // Other callers of this method wait on the lock and then only read m_Array, which is published by the
+  // release store below. The compact buffers are dropped right away so the lists are not held twice.
+  const size_t numLists = m_Offsets.empty() ? 0 : m_Offsets.size() - 1;
+  std::vector<SharedVectorType> lists(numLists);
+  for(size_t i = 0; i < numLists; i++)
+  {
+    lists[i] = SharedVectorType(new VectorType(m_Values.begin() + m_Offsets[i], m_Values.begin() + m_Offsets[i + 1]));
+  }
+  m_Array = std::move(lists);
+  m_Compact.store(false, std::memory_order_release);
+  OffsetsType().swap(m_Offsets);
+  VectorType().swap(m_Values);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -35,8 +35,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -49,6 +51,16 @@
 /**
  * @class NeighborList NeighborList.hpp DREAM3DLib/Common/NeighborList.hpp
  * @brief Template class for wrapping raw arrays of data.
+ *
+ * The lists are kept in one of two layouts. Lists that are built one entry at a time live in their own
+ * std::vector. Lists read from a file or handed over with setCompactLists() live in a single values array
+ * with an offsets array marking where each list starts, which is also how they are stored on disk. The
+ * compact layout is turned into separate vectors the first time getListReference(), getList() or operator[]
+ * is called and the compact buffers are released as soon as the vectors are built, so the lists are never
+ * held twice. That expansion happens exactly once under a lock, so those methods may be called from several
+ * threads at once. The expansion frees the storage behind every view returned by getListView(), so it must
+ * not run while other threads read the compact layout through getListView(), getListSize() or getValue();
+ * expand the lists first when mixing those readers with reference access.
  * @author mjackson
  * @date July 3, 2008
  * @version 1.0
@@ -157,6 +169,51 @@ public:
 
   using VectorType = std::vector<T>;
   using SharedVectorType = std::shared_ptr<VectorType>;
+  using OffsetsType = std::vector<uint64_t>;
+
+  /**
+   * @brief Read only view of a single list. The view stays valid until the NeighborList is modified or
+   * its layout changes.
+   */
+  class ConstListView
+  {
+  public:
+    ConstListView() = default;
+    ConstListView(const T* data, size_t size)
+    : m_Data(data)
+    , m_Size(size)
+    {
+    }
+
+    const T* data() const
+    {
+      return m_Data;
+    }
+    size_t size() const
+    {
+      return m_Size;
+    }
+    bool empty() const
+    {
+      return m_Size == 0;
+    }
+    const T* begin() const
+    {
+      return m_Data;
+    }
+    const T* end() const
+    {
+      return m_Data + m_Size;
+    }
+    const T& operator[](size_t index) const
+    {
+      return m_Data[index];
+    }
+
+  private:
+    const T* m_Data = nullptr;
+    size_t m_Size = 0;
+  };
 
   // -----------------------------------------------------------------------------
   ~NeighborList() override = default;
@@ -354,6 +411,15 @@ public:
    */
   int writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const override;
 
+  /**
+   * @brief Writes the flattened list and its NumNeighbors array as chunked and/or compressed datasets
+   * @param parentId
+   * @param tDims
+   * @param options
+   * @return
+   */
+  int writeH5Data(hid_t parentId, const std::vector<size_t>& tDims, const H5DataArrayWriteOptions& options) const override;
+
   /**
    * @brief writeXdmfAttribute
    * @param out
@@ -425,10 +491,57 @@ public:
    */
   int getListSize(int grainId) const;
 
+  /**
+   * @brief Returns a mutable reference to the list, expanding the compact layout first
+   * @param grainId
+   * @return
+   */
   VectorType& getListReference(int grainId) const;
 
   /**
-   * @brief getList
+   * @brief Returns a read only view of the list without changing the layout of the lists
+   * @param grainId
+   * @return
+   */
+  ConstListView getListView(int grainId) const;
+
+  /**
+   * @brief Replaces all lists with the compact layout. List i holds values[offsets[i]] up to but not
+   * including values[offsets[i + 1]], so offsets holds one more entry than there are lists. Both vectors are
+   * taken over without a copy.
+   * @param offsets
+   * @param values
+   * @return false if the offsets do not describe the values, in which case nothing is changed
+   */
+  bool setCompactLists(OffsetsType offsets, VectorType values);
+
+  /**
+   * @brief Moves all lists into the compact layout, releasing the separate vectors
+   */
+  void compact();
+
+  /**
+   * @brief Returns true if the lists are currently kept in the compact layout
+   * @return
+   */
+  bool isCompact() const;
+
+  /**
+   * @brief Moves the compact layout into separate vectors and releases the compact buffers. This frees the
+   * buffers behind every view returned by getListView(), so it must not be called while any other thread
+   * reads the lists. getListReference(), getList() and operator[] do the same on first use.
+   */
+  void expandLists();
+
+  /**
+   * @brief Returns the stored list, expanding the compact layout first
+   * @param grainId
+   * @return
+   */
+  SharedVectorType getList(int grainId);
+
+  /**
+   * @brief Returns the list without changing the layout. A list of the compact layout is returned as a copy.
    * @param grainId
    * @return
    */
@@ -463,7 +576,16 @@ protected:
 
 private:
   QString m_NumNeighborsArrayName;
-  std::vector<SharedVectorType> m_Array;
+  mutable std::vector<SharedVectorType> m_Array;
+  mutable OffsetsType m_Offsets;
+  mutable VectorType m_Values;
+  mutable std::atomic_bool m_Compact{false};
+  mutable std::mutex m_ExpandMutex;
+
+  /**
+   * @brief Builds the separate vectors from the compact layout once and releases the compact buffers
+   */
+  void expandListsLocked() const;
   size_t m_NumTuples;
   bool m_IsAllocated;
   T m_InitValue;
@@ -34,6 +34,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "StringDataArray.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
 #include <QtCore/QTextStream>
 
 #include "H5Support/H5Lite.h"
@@ -61,7 +65,7 @@ StringDataArray::StringDataArray(size_t numTuples, const QString& name, bool all
   setName(name);
   if(m_IsAllocated)
   {
-    m_Array.resize(m_NumTuples);
+    m_Entries.resize(m_NumTuples);
   }
 }
 
@@ -195,7 +199,11 @@ void StringDataArray::releaseOwnership()
 // -----------------------------------------------------------------------------
 void* StringDataArray::getVoidPointer(size_t i)
 {
-  return static_cast<void*>(&(m_Array[i]));
+  if(i >= m_Entries.size())
+  {
+    return nullptr;
+  }
+  return static_cast<void*>(m_Buffer.data() + m_Entries[i].offset);
 }
 
 // -----------------------------------------------------------------------------
@@ -205,7 +213,7 @@ size_t StringDataArray::getNumberOfTuples() const
 {
   if(m_IsAllocated)
   {
-    return m_Array.size();
+    return m_Entries.size();
   }
   return m_NumTuples;
 }
@@ -217,7 +225,7 @@ size_t StringDataArray::getSize() const
 {
   if(m_IsAllocated)
   {
-    return m_Array.size();
+    return m_Entries.size();
   }
   return m_NumTuples;
 }
@@ -259,7 +267,7 @@ int StringDataArray::getRank() const
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getTypeSize() const
 {
-  return sizeof(QString);
+  return sizeof(char);
 }
 
 // -----------------------------------------------------------------------------
@@ -287,35 +295,28 @@ int StringDataArray::eraseTuples(const std::vector<size_t>& idxs)
 
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
-  // for(std::vector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+  std::vector<bool> erase(m_Entries.size(), false);
   for(auto& value : idxs)
   {
-    if(value >= static_cast<size_t>(m_Array.size()))
+    if(value >= m_Entries.size())
     {
       return -100;
     }
+    erase[value] = true;
   }
 
-  // Create a new Array to copy into
-  std::vector<QString> newArray;
-  std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  // Keep the entries in a single pass and then drop the bytes of the erased strings
+  size_t numKept = 0;
+  for(size_t i = 0; i < m_Entries.size(); ++i)
   {
-    bool keep = true;
-    for(std::vector<size_t>::size_type j = start; j < idxs.size(); ++j)
-    {
-      if(static_cast<size_t>(i) == idxs[j])
-      {
-        keep = false;
-        break;
-      }
-    }
-    if(keep)
+    if(!erase[i])
     {
-      newArray.push_back(m_Array[i]);
+      m_Entries[numKept++] = m_Entries[i];
     }
   }
-  m_Array = newArray;
+  m_Entries.resize(numKept);
+  m_NumTuples = numKept;
+  compact();
   return err;
 }
 
@@ -328,16 +329,20 @@ int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
   {
     return -1;
   }
-  if(currentPos >= m_Array.size())
+  if(currentPos >= m_Entries.size())
   {
     return -1;
   }
-  if(newPos >= m_Array.size())
+  if(newPos >= m_Entries.size())
   {
     return -1;
   }
-  // QString s = m_Array[currentPos];
-  m_Array[newPos] = m_Array[currentPos];
+  // The tuples share the bytes of the string
+  if(m_Entries[newPos].size > 0)
+  {
+    m_UnusedBytes += m_Entries[newPos].size + 1;
+  }
+  m_Entries[newPos] = m_Entries[currentPos];
   return 0;
 }
 
@@ -350,7 +355,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
   {
     return false;
   }
-  if(destTupleOffset >= m_Array.size())
+  if(destTupleOffset >= m_Entries.size())
   {
     return false;
   }
@@ -369,14 +374,22 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
   {
     return false;
   }
-  if(totalSrcTuples + destTupleOffset > m_Array.size())
+  if(totalSrcTuples + destTupleOffset > m_Entries.size())
   {
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  if(source == this)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    // Copying within the array only moves the entries, which may overlap
+    std::vector<Entry> entries(m_Entries.begin() + srcTupleOffset, m_Entries.begin() + srcTupleOffset + totalSrcTuples);
+    std::copy(entries.begin(), entries.end(), m_Entries.begin() + destTupleOffset);
+    return true;
+  }
+
+  for(size_t i = 0; i < totalSrcTuples; i++)
+  {
+    setValueUtf8(destTupleOffset + i, source->getValueUtf8(srcTupleOffset + i));
   }
   return true;
 }
@@ -386,7 +399,11 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeTuple(size_t pos, const void* value)
 {
-  m_Array[pos] = *(reinterpret_cast<const QString*>(value));
+  if(nullptr == value)
+  {
+    return;
+  }
+  setValueUtf8(pos, std::string_view(reinterpret_cast<const char*>(value)));
 }
 
 // -----------------------------------------------------------------------------
@@ -394,7 +411,7 @@ void StringDataArray::initializeTuple(size_t pos, const void* value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithZeros()
 {
-  m_Array.assign(m_Array.size(), QString(""));
+  initializeWithValue(std::string());
 }
 
 // -----------------------------------------------------------------------------
@@ -402,7 +419,7 @@ void StringDataArray::initializeWithZeros()
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const QString& value)
 {
-  m_Array.assign(m_Array.size(), value);
+  initializeWithValue(value.toStdString());
 }
 
 // -----------------------------------------------------------------------------
@@ -410,7 +427,14 @@ void StringDataArray::initializeWithValue(const QString& value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const std::string& value)
 {
-  m_Array.assign(m_Array.size(), QString::fromStdString(value));
+  // Every tuple points at the same copy of the value
+  m_Buffer.assign(1, '\0');
+  m_Dictionary.clear();
+  m_UnusedBytes = 0;
+  Entry entry;
+  entry.offset = appendString(value);
+  entry.size = value.size();
+  m_Entries.assign(m_Entries.size(), entry);
 }
 
 // -----------------------------------------------------------------------------
@@ -424,12 +448,13 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate) const
     allocate = false;
   }
   StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName(), allocate);
+  daCopy->m_DictionaryEncoded = m_DictionaryEncoded;
   if(m_IsAllocated && !forceNoAllocate)
   {
-    for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-    {
-      daCopy->setValue(i, m_Array[i]);
-    }
+    daCopy->m_Buffer = m_Buffer;
+    daCopy->m_Entries = m_Entries;
+    daCopy->m_Dictionary = m_Dictionary;
+    daCopy->m_UnusedBytes = m_UnusedBytes;
   }
   return daCopy;
 }
@@ -442,7 +467,7 @@ int32_t StringDataArray::resizeTotalElements(size_t size)
   m_NumTuples = size;
   if(m_IsAllocated)
   {
-    m_Array.resize(size);
+    m_Entries.resize(size);
   }
   return 1;
 }
@@ -455,7 +480,7 @@ void StringDataArray::resizeTuples(size_t numTuples)
   m_NumTuples = numTuples;
   if(m_IsAllocated)
   {
-    m_Array.resize(m_NumTuples);
+    m_Entries.resize(m_NumTuples);
   }
 }
 
@@ -464,9 +489,12 @@ void StringDataArray::resizeTuples(size_t numTuples)
 // -----------------------------------------------------------------------------
 void StringDataArray::initialize()
 {
-  if(!m_Array.empty())
+  if(!m_Entries.empty())
   {
-    m_Array.clear();
+    m_Entries.clear();
+    m_Buffer.assign(1, '\0');
+    m_Dictionary.clear();
+    m_UnusedBytes = 0;
     this->_ownsData = true;
   }
 }
@@ -476,7 +504,7 @@ void StringDataArray::initialize()
 // -----------------------------------------------------------------------------
 void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -484,7 +512,7 @@ void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter) con
 // -----------------------------------------------------------------------------
 void StringDataArray::printComponent(QTextStream& out, size_t i, int j) const
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -546,28 +574,77 @@ ToolTipGenerator StringDataArray::getToolTipGenerator() const
 int StringDataArray::readH5Data(hid_t parentId)
 {
   int err = 0;
-  this->resizeTuples(0);
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
+  m_Entries.clear();
+  m_Buffer.assign(1, '\0');
+  m_Dictionary.clear();
+  m_UnusedBytes = 0;
+
+  std::string name = getName().toStdString();
+  hid_t did = H5Dopen(parentId, name.c_str(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    return -1;
+  }
+  hid_t fileType = H5Dget_type(did);
+  bool variableLength = (H5Tget_class(fileType) == H5T_STRING && H5Tis_variable_str(fileType) > 0);
+  H5Tclose(fileType);
 
-  m_Array.resize(strings.size());
-  for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+  if(variableLength)
   {
-    m_Array[i] = QString::fromStdString(strings[i]);
+    // HDF5 hands out a pointer per string, which are copied straight into the buffer
+    hid_t spaceId = H5Dget_space(did);
+    hid_t memType = H5Tcopy(H5T_C_S1);
+    H5Tset_size(memType, H5T_VARIABLE);
+    hssize_t numStrings = H5Sget_simple_extent_npoints(spaceId);
+    std::vector<char*> strings(numStrings > 0 ? static_cast<size_t>(numStrings) : 0, nullptr);
+    if(!strings.empty())
+    {
+      err = H5Dread(did, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, strings.data());
+    }
+    if(err >= 0)
+    {
+      m_Entries.resize(strings.size());
+      size_t bufferSize = m_Buffer.size();
+      for(size_t i = 0; i < strings.size(); i++)
+      {
+        m_Entries[i].size = (nullptr == strings[i]) ? 0 : std::strlen(strings[i]);
+        m_Entries[i].offset = (m_Entries[i].size == 0) ? 0 : bufferSize;
+        bufferSize += (m_Entries[i].size == 0) ? 0 : m_Entries[i].size + 1;
+      }
+      m_Buffer.resize(bufferSize);
+      for(size_t i = 0; i < strings.size(); i++)
+      {
+        if(m_Entries[i].size > 0)
+        {
+          std::memcpy(m_Buffer.data() + m_Entries[i].offset, strings[i], m_Entries[i].size + 1);
+        }
+      }
+      H5Dvlen_reclaim(memType, spaceId, H5P_DEFAULT, strings.data());
+    }
+    H5Tclose(memType);
+    H5Sclose(spaceId);
+    H5Dclose(did);
   }
-#if 0
-  IDataArray::Pointer p = H5DataArrayReader::ReadStringDataArray(parentId, getName());
-  if (p.get() == nullptr)
+  else
   {
-    return -1;
+    H5Dclose(did);
+
+    // Fixed length strings
+    std::vector<std::string> strings;
+    err = H5Lite::readVectorOfStringDataset(parentId, name, strings);
+    m_Entries.resize(strings.size());
+    for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
+    {
+      setValueUtf8(i, strings[i]);
+    }
   }
-  StringDataArray::Pointer srcPtr = std::dynamic_pointer_cast<StringDataArray>(p);
-  size_t count = srcPtr->getNumberOfTuples();
-  for (size_t i = 0; i < count; ++i)
+
+  m_NumTuples = m_Entries.size();
+  m_IsAllocated = true;
+  if(m_DictionaryEncoded)
   {
-    m_Array.push_back( srcPtr->getValue(i) );
+    compact();
   }
-#endif
   return err;
 }
 
@@ -576,7 +653,8 @@ int StringDataArray::readH5Data(hid_t parentId)
 // -----------------------------------------------------------------------------
 void StringDataArray::setValue(size_t i, const QString& value)
 {
-  m_Array[i] = value;
+  QByteArray bytes = value.toUtf8();
+  setValueUtf8(i, std::string_view(bytes.constData(), static_cast<size_t>(bytes.size())));
 }
 
 // -----------------------------------------------------------------------------
@@ -584,7 +662,147 @@ void StringDataArray::setValue(size_t i, const QString& value)
 // -----------------------------------------------------------------------------
 QString StringDataArray::getValue(size_t i) const
 {
-  return m_Array.at(i);
+  const Entry& entry = m_Entries.at(i);
+  return QString::fromUtf8(m_Buffer.data() + entry.offset, static_cast<int>(entry.size));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValueUtf8(size_t i, std::string_view value)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  Entry& entry = m_Entries[i];
+  if(entry.size > 0)
+  {
+    m_UnusedBytes += entry.size + 1;
+  }
+  entry.offset = appendString(value);
+  entry.size = value.size();
+
+  // Overwritten strings are dropped once they take up half of the buffer
+  if(m_UnusedBytes > 65536 && m_UnusedBytes > m_Buffer.size() / 2)
+  {
+    compact();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string_view StringDataArray::getValueUtf8(size_t i) const
+{
+  const Entry& entry = m_Entries[i];
+  return std::string_view(m_Buffer.data() + entry.offset, entry.size);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setDictionaryEncoded(bool value)
+{
+  m_DictionaryEncoded = value;
+  m_Dictionary.clear();
+  if(m_DictionaryEncoded)
+  {
+    // Merges the strings that are already stored twice
+    compact();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool StringDataArray::isDictionaryEncoded() const
+{
+  return m_DictionaryEncoded;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::getBufferSize() const
+{
+  return m_Buffer.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::appendString(std::string_view value)
+{
+  if(value.empty())
+  {
+    return 0;
+  }
+
+  // A value that was taken from this array can point at its own bytes
+  const char* data = m_Buffer.data();
+  if(value.data() >= data && value.data() + value.size() < data + m_Buffer.size())
+  {
+    if(value.data()[value.size()] == '\0')
+    {
+      return static_cast<size_t>(value.data() - data);
+    }
+    return appendString(std::string(value));
+  }
+
+  size_t hash = 0;
+  if(m_DictionaryEncoded)
+  {
+    hash = std::hash<std::string_view>()(value);
+    auto range = m_Dictionary.equal_range(hash);
+    for(auto iter = range.first; iter != range.second; ++iter)
+    {
+      size_t offset = iter->second;
+      if(offset + value.size() < m_Buffer.size() && m_Buffer[offset + value.size()] == '\0' && std::string_view(data + offset, value.size()) == value)
+      {
+        return offset;
+      }
+    }
+  }
+
+  size_t offset = m_Buffer.size();
+  m_Buffer.insert(m_Buffer.end(), value.begin(), value.end());
+  m_Buffer.push_back('\0');
+  if(m_DictionaryEncoded)
+  {
+    m_Dictionary.emplace(hash, offset);
+  }
+  return offset;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::compact()
+{
+  std::vector<char> oldBuffer(1, '\0');
+  oldBuffer.swap(m_Buffer);
+  m_Buffer.reserve(oldBuffer.size() - std::min(m_UnusedBytes, oldBuffer.size() - 1));
+  m_Dictionary.clear();
+  m_UnusedBytes = 0;
+
+  // Tuples that shared a string before still share it afterwards
+  std::unordered_map<size_t, Entry> moved;
+  for(auto& entry : m_Entries)
+  {
+    if(entry.size == 0)
+    {
+      entry.offset = 0;
+      continue;
+    }
+    auto iter = moved.find(entry.offset);
+    if(iter != moved.end() && iter->second.size == entry.size)
+    {
+      entry.offset = iter->second.offset;
+      continue;
+    }
+    size_t offset = appendString(std::string_view(oldBuffer.data() + entry.offset, entry.size));
+    moved[entry.offset] = {offset, entry.size};
+    entry.offset = offset;
+  }
+  m_Buffer.shrink_to_fit();
 }
 
 // -----------------------------------------------------------------------------
@@ -36,7 +36,10 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <QtCore/QString>
@@ -47,7 +50,9 @@
 
 /**
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
- * @brief Stores an array of QString objects
+ * @brief Stores an array of strings. The strings are kept as UTF-8 in a single buffer that
+ * each tuple points into, so tuples with equal values can share their bytes. The values are
+ * handed out as QString by getValue() or without any conversion by getValueUtf8().
  *
  * @date Nov 13, 2012
  * @version 1.0
@@ -175,11 +180,12 @@ public:
    */
   void releaseOwnership() override;
   /**
-   * @brief Returns a void pointer pointing to the index of the array. nullptr
-   * pointers are entirely possible. No checks are performed to make sure
-   * the index is with in the range of the internal data array.
+   * @brief Returns a pointer to the null terminated UTF-8 bytes (a const char*) of the string at the
+   * index, which is what initializeTuple() accepts. The bytes may be shared with other tuples and must
+   * not be modified. The pointer stays valid until the array is modified; setting, erasing or resizing
+   * tuples may move the bytes.
    * @param i The index to have the returned pointer pointing to.
-   * @return Void Pointer. Possibly nullptr.
+   * @return Void Pointer. nullptr if the index is out of range.
    */
   void* getVoidPointer(size_t i) override;
 
@@ -262,7 +268,9 @@ public:
   bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
 
   /**
-   * @brief Does Nothing
+   * @brief Sets the tuple to the null terminated UTF-8 string (a const char*) that value points to,
+   * such as the pointer returned by getVoidPointer() of this or another StringDataArray. The bytes are
+   * copied, so they only need to stay valid for the duration of the call.
    * @param pos The index of the Tuple
    * @param value pointer to value
    */
@@ -371,7 +379,8 @@ public:
   int readH5Data(hid_t parentId) override;
 
   /**
-   * @brief setValue
+   * @brief setValue. Different tuples may be set concurrently, but not while other
+   * threads read from the array.
    * @param i
    * @param value
    */
@@ -383,6 +392,42 @@ public:
    */
   QString getValue(size_t i) const;
 
+  /**
+   * @brief Sets the tuple to the UTF-8 encoded value. Like setValue() this may be called
+   * concurrently for different tuples.
+   * @param i
+   * @param value
+   */
+  void setValueUtf8(size_t i, std::string_view value);
+
+  /**
+   * @brief Returns the UTF-8 bytes of the tuple without making a copy. The view is always
+   * followed by a null character and stays valid until the array is modified.
+   * @param i
+   * @return
+   */
+  std::string_view getValueUtf8(size_t i) const;
+
+  /**
+   * @brief Turns dictionary encoding on or off. While it is on, a value that is already
+   * stored in the array is not stored again, which saves memory for arrays with few
+   * distinct values at the cost of a hash lookup in setValue().
+   * @param value
+   */
+  void setDictionaryEncoded(bool value);
+
+  /**
+   * @brief Returns true if dictionary encoding is on
+   * @return
+   */
+  bool isDictionaryEncoded() const;
+
+  /**
+   * @brief Returns the number of bytes used by the string buffer
+   * @return
+   */
+  size_t getBufferSize() const;
+
 protected:
   /**
    * @brief Protected Constructor
@@ -394,12 +439,40 @@ protected:
   StringDataArray();
 
 private:
+  /**
+   * @brief The location of the bytes of a string in the buffer. The empty string is the
+   * null character at offset 0.
+   */
+  struct Entry
+  {
+    size_t offset = 0;
+    size_t size = 0;
+  };
+
   QString m_InitValue;
-  std::vector<QString> m_Array;
+  std::vector<char> m_Buffer = std::vector<char>(1, '\0');
+  std::vector<Entry> m_Entries;
+  size_t m_UnusedBytes = 0;
+  bool m_DictionaryEncoded = false;
+  std::unordered_multimap<size_t, size_t> m_Dictionary;
+  std::mutex m_Mutex;
   size_t m_NumTuples = 0;
   bool m_IsAllocated = false;
   bool _ownsData;
 
+  /**
+   * @brief Returns the offset of a null terminated copy of the value in the buffer, appending
+   * it if it is not there yet
+   * @param value
+   * @return
+   */
+  size_t appendString(std::string_view value);
+
+  /**
+   * @brief Rebuilds the buffer so that it only holds the strings the tuples point to
+   */
+  void compact();
+
 public:
   StringDataArray(const StringDataArray&) = delete;            // Copy Constructor Not Implemented
   StringDataArray(StringDataArray&&) = delete;                 // Move Constructor Not Implemented
@@ -39,6 +39,7 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <thread>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -51,6 +52,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -681,6 +683,167 @@ public:
     TestNeighborListDeepCopyForType<int8_t>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNeighborListCompact()
+  {
+    using ListType = NeighborList<int32_t>;
+    ListType::Pointer neiList = ListType::CreateArray(0, std::string("NeighborList"), true);
+
+    // Lists {}, {1}, {2,3}, {4,5,6}
+    ListType::OffsetsType offsets = {0, 0, 1, 3, 6};
+    ListType::VectorType values = {1, 2, 3, 4, 5, 6};
+    DREAM3D_REQUIRE_EQUAL(neiList->setCompactLists(offsets, values), true);
+    DREAM3D_REQUIRE_EQUAL(neiList->isCompact(), true);
+    DREAM3D_REQUIRE_EQUAL(neiList->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(neiList->getSize(), 6)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListSize(0), 0)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListSize(3), 3)
+
+    ListType::ConstListView view = neiList->getListView(2);
+    DREAM3D_REQUIRE_EQUAL(view.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(view[0], 2)
+    DREAM3D_REQUIRE_EQUAL(view[1], 3)
+
+    bool ok = true;
+    DREAM3D_REQUIRE_EQUAL(neiList->getValue(3, 2, ok), 6)
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+    neiList->getValue(0, 0, ok);
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+
+    // Malformed offsets are rejected
+    ListType::OffsetsType badOffsets = {0, 2, 1, 6};
+    DREAM3D_REQUIRE_EQUAL(neiList->setCompactLists(badOffsets, values), false);
+    ListType::OffsetsType shortOffsets = {0, 1, 3, 5};
+    DREAM3D_REQUIRE_EQUAL(neiList->setCompactLists(shortOffsets, values), false);
+
+    // Deep copies keep the compact layout
+    ListType::Pointer copy = std::dynamic_pointer_cast<ListType>(neiList->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(copy->isCompact(), true);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(copy->getListView(3)[0], 4)
+
+    // Resizing keeps the compact layout
+    copy->resizeTuples(6);
+    DREAM3D_REQUIRE_EQUAL(copy->isCompact(), true);
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(5), 0)
+    copy->resizeTuples(3);
+    DREAM3D_REQUIRE_EQUAL(copy->getSize(), 3)
+
+    // Const access never changes the layout; compact lists are handed out as copies
+    const ListType& constList = *neiList;
+    ListType::SharedVectorType listCopy = constList.getList(3);
+    DREAM3D_REQUIRE_EQUAL(neiList->isCompact(), true);
+    DREAM3D_REQUIRE_EQUAL(listCopy->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(listCopy->at(2), 6)
+    DREAM3D_REQUIRE(view.begin() == neiList->getListView(2).begin())
+
+    // Mutable access expands the lists and releases the compact buffers, which invalidates the views
+    ListType::VectorType& list = neiList->getListReference(3);
+    DREAM3D_REQUIRE_EQUAL(neiList->isCompact(), false);
+    DREAM3D_REQUIRE_EQUAL(neiList->getSize(), 6)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListView(2)[1], 3)
+    list.push_back(7);
+    neiList->addEntry(0, 8);
+    DREAM3D_REQUIRE_EQUAL(neiList->getSize(), 8)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListView(0)[0], 8)
+
+    neiList->compact();
+    DREAM3D_REQUIRE_EQUAL(neiList->isCompact(), true);
+    DREAM3D_REQUIRE_EQUAL(neiList->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListSize(3), 4)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListView(3)[3], 7)
+    DREAM3D_REQUIRE_EQUAL(neiList->copyOfList(1)[0], 1)
+
+    // Several threads may trigger the expansion at the same time
+    ListType::Pointer sharedList = ListType::CreateArray(0, std::string("NeighborList"), true);
+    const size_t numLists = 1000;
+    ListType::OffsetsType sharedOffsets(numLists + 1, 0);
+    for(size_t i = 0; i < numLists; i++)
+    {
+      sharedOffsets[i + 1] = sharedOffsets[i] + (i % 5);
+    }
+    ListType::VectorType sharedValues(sharedOffsets.back(), 1);
+    DREAM3D_REQUIRE_EQUAL(sharedList->setCompactLists(sharedOffsets, sharedValues), true);
+    const ListType& constShared = *sharedList;
+    ListType& mutableShared = *sharedList;
+    std::vector<size_t> totals(4, 0);
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < totals.size(); t++)
+    {
+      threads.emplace_back([&constShared, &mutableShared, &totals, t, numLists] {
+        for(size_t i = 0; i < numLists; i++)
+        {
+          totals[t] += (t % 2 == 0) ? constShared.getListReference(static_cast<int>(i)).size() : mutableShared[i].size();
+        }
+      });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    for(size_t total : totals)
+    {
+      DREAM3D_REQUIRE_EQUAL(total, sharedValues.size())
+    }
+    DREAM3D_REQUIRE_EQUAL(sharedList->isCompact(), false);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDynamicListArray()
+  {
+    using ListType = DynamicListArray<uint16_t, int64_t>;
+    ListType::Pointer list = ListType::New();
+
+    // Lists {}, {10}, {20, 21}, {30, 31, 32}
+    std::vector<uint16_t> linkCounts = {0, 1, 2, 3};
+    std::vector<int64_t> values = {10, 20, 21, 30, 31, 32};
+    DREAM3D_REQUIRE_EQUAL(list->setElementLists(linkCounts, values.data(), values.size()), true)
+    DREAM3D_REQUIRE_EQUAL(list->setElementLists(linkCounts, values.data(), 5), false)
+    DREAM3D_REQUIRE_EQUAL(list->size(), 4)
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfElements(0), 0)
+    DREAM3D_REQUIRE(list->getElementListPointer(0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(list->getElementList(2).ncells, 2)
+    DREAM3D_REQUIRE_EQUAL(list->getElementList(2).cells[1], 21)
+
+    // All the lists share one contiguous block
+    DREAM3D_REQUIRE(list->getElementListPointer(2) == list->getElementListPointer(1) + 1)
+    DREAM3D_REQUIRE(list->getElementListPointer(3) == list->getElementListPointer(2) + 2)
+
+    // Shorter lists stay in place, longer ones move out of the block
+    int64_t shorter[1] = {33};
+    DREAM3D_REQUIRE_EQUAL(list->setElementList(3, 1, shorter), true)
+    DREAM3D_REQUIRE(list->getElementListPointer(3) == list->getElementListPointer(2) + 2)
+    int64_t longer[3] = {11, 12, 13};
+    DREAM3D_REQUIRE_EQUAL(list->setElementList(1, 3, longer), true)
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfElements(1), 3)
+    DREAM3D_REQUIRE_EQUAL(list->getElementListPointer(1)[2], 13)
+    DREAM3D_REQUIRE_EQUAL(list->getElementListPointer(2)[0], 20)
+    DREAM3D_REQUIRE_EQUAL(list->setElementList(4, 1, shorter), false)
+
+    // Round trip through the serialized form used in the HDF5 files
+    size_t numBytes = list->getSerializedSize(list->size());
+    DREAM3D_REQUIRE_EQUAL(numBytes, 4 * sizeof(uint16_t) + 6 * sizeof(int64_t))
+    std::vector<uint8_t> buffer(numBytes);
+    list->serializeLinks(buffer.data(), list->size());
+    ListType::Pointer readList = ListType::New();
+    DREAM3D_REQUIRE_EQUAL(readList->deserializeLinks(buffer, list->size()), true)
+    DREAM3D_REQUIRE_EQUAL(readList->getNumberOfElements(1), 3)
+    DREAM3D_REQUIRE_EQUAL(readList->getElementListPointer(1)[0], 11)
+    DREAM3D_REQUIRE_EQUAL(readList->getElementListPointer(3)[0], 33)
+    buffer.resize(numBytes - 1);
+    DREAM3D_REQUIRE_EQUAL(readList->deserializeLinks(buffer, list->size()), false)
+
+    ListType::Pointer copy = list->deepCopy();
+    DREAM3D_REQUIRE_EQUAL(copy->size(), 4)
+    DREAM3D_REQUIRE(copy->getElementListPointer(1) != list->getElementListPointer(1))
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(1)[1], 12)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(2)[1], 21)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1482,6 +1645,162 @@ true);
     TestByteSwapElementType<double>(0x412ABE865D841400);
   }
 
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestMemoryMappedStorageForType()
+  {
+    using DataArrayType = DataArray<T>;
+
+    typename DataArrayType::Pointer array = DataArrayType::CreateArray(NUM_TUPLES, QString("Test Array"), false);
+    array->setStorage(MemoryMappedDataArrayStorage<T>::New());
+    DREAM3D_REQUIRE(array->allocate() > 0)
+    DREAM3D_REQUIRE(array->isAllocated())
+    for(size_t i = 0; i < array->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(array->getValue(i), static_cast<T>(0))
+      array->setValue(i, static_cast<T>(i));
+    }
+
+    // Growing the array keeps the existing values and initializes the rest
+    array->resizeTuples(NUM_TUPLES * 2);
+    DREAM3D_REQUIRE_EQUAL(array->getValue(NUM_TUPLES - 1), static_cast<T>(NUM_TUPLES - 1))
+    DREAM3D_REQUIRE_EQUAL(array->getValue(NUM_TUPLES), static_cast<T>(0))
+
+    std::vector<size_t> idxs = {0, 2, 4};
+    DREAM3D_REQUIRE_EQUAL(array->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(0), static_cast<T>(1))
+    DREAM3D_REQUIRE_EQUAL(array->getValue(1), static_cast<T>(3))
+
+    // Copies use the same backend
+    typename DataArrayType::Pointer copy = std::dynamic_pointer_cast<DataArrayType>(array->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE(copy->getStorage() == array->getStorage())
+    DREAM3D_REQUIRE(std::equal(array->begin(), array->end(), copy->begin()))
+
+    // Moving the data back onto the heap keeps the values
+    DREAM3D_REQUIRE(array->setStorage(InMemoryDataArrayStorage<T>::New()) > 0)
+    DREAM3D_REQUIRE(std::equal(array->begin(), array->end(), copy->begin()))
+
+    // Blocks handed to another array are released by that array
+    T* ptr = copy->data();
+    copy->releaseOwnership();
+    typename DataArrayType::Pointer wrapped = DataArrayType::WrapPointer(ptr, copy->getNumberOfTuples(), copy->getComponentDimensions(), QString("Wrapped"), true);
+    copy = nullptr;
+    DREAM3D_REQUIRE(std::equal(array->begin(), array->end(), wrapped->begin()))
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestMemoryMappedStorage()
+  {
+    TestMemoryMappedStorageForType<int8_t>();
+    TestMemoryMappedStorageForType<uint16_t>();
+    TestMemoryMappedStorageForType<int32_t>();
+    TestMemoryMappedStorageForType<uint64_t>();
+    TestMemoryMappedStorageForType<float>();
+    TestMemoryMappedStorageForType<double>();
+
+    // Arrays at or above the threshold pick the memory mapped backend on their own
+    size_t threshold = DataArrayStorageSettings::GetMemoryMapThreshold();
+    DataArrayStorageSettings::SetMemoryMapThreshold(NUM_TUPLES * sizeof(float));
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(NUM_TUPLES, QString("Test Array"), true);
+    FloatArrayType::Pointer smallArray = FloatArrayType::CreateArray(NUM_TUPLES - 1, QString("Small Array"), true);
+    DataArrayStorageSettings::SetMemoryMapThreshold(threshold);
+    DREAM3D_REQUIRE_EQUAL(smallArray->getStorageName(), InMemoryDataArrayStorage<float>::New()->getStorageName())
+    DREAM3D_REQUIRE(array->isAllocated())
+    DREAM3D_REQUIRE(array->getStorage() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(array->getStorageName(), MemoryMappedDataArrayStorage<float>::New()->getStorageName())
+    array->initializeWithValue(5.0f);
+    DREAM3D_REQUIRE_EQUAL(array->getValue(NUM_TUPLES - 1), 5.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDeferredLoader()
+  {
+    int32_t loadCount = 0;
+    IDataArray::DeferredLoaderType loader = [&loadCount](void* buffer, size_t numElements, size_t typeSize) {
+      loadCount++;
+      int32_t* values = reinterpret_cast<int32_t*>(buffer);
+      for(size_t i = 0; i < numElements; i++)
+      {
+        values[i] = static_cast<int32_t>(i);
+      }
+      return typeSize == sizeof(int32_t);
+    };
+
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(NUM_TUPLES, std::vector<size_t>(1, 2), QString("Deferred"), false);
+    DREAM3D_REQUIRE(array->setDeferredLoader(loader))
+    DREAM3D_REQUIRE(array->hasDeferredLoader())
+    DREAM3D_REQUIRE(array->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    // A copy loads the values on its own
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE(copy->hasDeferredLoader())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    // The first bulk access loads the values exactly once, the per element accessors read them afterwards
+    DREAM3D_REQUIRE_VALID_POINTER(array->getPointer(0))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+    DREAM3D_REQUIRE_EQUAL((*array)[NUM_TUPLES * 2 - 1], static_cast<int32_t>(NUM_TUPLES * 2 - 1))
+    DREAM3D_REQUIRE_EQUAL(array->getValue(3), 3)
+    DREAM3D_REQUIRE_EQUAL(array->loadDeferredValues(), 0)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+    DREAM3D_REQUIRE(!array->hasDeferredLoader())
+    DREAM3D_REQUIRE(std::equal(copy->begin(), copy->end(), array->begin()))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 2)
+
+    // The virtual accessors of IDataArray load the values
+    Int32ArrayType::Pointer printed = Int32ArrayType::CreateArray(NUM_TUPLES, std::vector<size_t>(1, 2), QString("Printed"), false);
+    DREAM3D_REQUIRE(printed->setDeferredLoader(loader))
+    IDataArray::Pointer printedArray = printed;
+    QString printedStr;
+    QTextStream printedOut(&printedStr);
+    printedArray->printTuple(printedOut, 1, ',');
+    printedOut.flush();
+    DREAM3D_REQUIRE_EQUAL(printedStr, QString("2,3"))
+    DREAM3D_REQUIRE(!printed->hasDeferredLoader())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 3)
+
+    // An explicit allocation discards the pending load
+    Int32ArrayType::Pointer discarded = Int32ArrayType::CreateArray(NUM_TUPLES, QString("Discarded"), false);
+    DREAM3D_REQUIRE(discarded->setDeferredLoader(loader))
+    DREAM3D_REQUIRE(discarded->allocate() > 0)
+    DREAM3D_REQUIRE_EQUAL(discarded->getValue(NUM_TUPLES - 1), 0)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 3)
+
+    // Allocated arrays can not be deferred
+    DREAM3D_REQUIRE(!discarded->setDeferredLoader(loader))
+
+    // Looking the array up as a filter prerequisite loads it
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, NUM_TUPLES), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer prereq = Int32ArrayType::CreateArray(NUM_TUPLES, std::vector<size_t>(1, 2), QString("Prereq"), false);
+    DREAM3D_REQUIRE(prereq->setDeferredLoader(loader))
+    am->insertOrAssign(prereq);
+    DREAM3D_REQUIRE(am->getPrereqArray<Int32ArrayType>(nullptr, "Prereq", -1, {2}) == prereq)
+    DREAM3D_REQUIRE(!prereq->hasDeferredLoader())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 4)
+    DREAM3D_REQUIRE_EQUAL(prereq->getComponent(NUM_TUPLES - 1, 1), static_cast<int32_t>(NUM_TUPLES * 2 - 1))
+
+    // A failed load is sticky and leaves zeroed values behind
+    IDataArray::DeferredLoaderType failingLoader = [](void* buffer, size_t numElements, size_t typeSize) {
+      std::memset(buffer, 0xFF, numElements * typeSize);
+      return false;
+    };
+    Int32ArrayType::Pointer failed = Int32ArrayType::CreateArray(NUM_TUPLES, QString("Failed"), false);
+    DREAM3D_REQUIRE(failed->setDeferredLoader(failingLoader))
+    DREAM3D_REQUIRE_EQUAL(failed->getDeferredLoadError(), 0)
+    DREAM3D_REQUIRE_EQUAL(failed->loadDeferredValues(), -10301)
+    DREAM3D_REQUIRE_EQUAL(failed->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(failed->getDeferredLoadError(), -10301)
+    DREAM3D_REQUIRE_EQUAL(failed->getValue(NUM_TUPLES - 1), 0)
+    DREAM3D_REQUIRE_EQUAL(failed->getDeferredLoadError(), -10301)
+    DREAM3D_REQUIRE_EQUAL(failed->deepCopy()->getDeferredLoadError(), -10301)
+    DREAM3D_REQUIRE_EQUAL(array->getDeferredLoadError(), 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1503,10 +1822,14 @@ true);
     DREAM3D_REGISTER_TEST(TestcopyTuples())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
     DREAM3D_REGISTER_TEST(TestNeighborList())
+    DREAM3D_REGISTER_TEST(TestNeighborListCompact())
+    DREAM3D_REGISTER_TEST(TestDynamicListArray())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
     DREAM3D_REGISTER_TEST(TestSetTuple())
     DREAM3D_REGISTER_TEST(TestByteSwapElements())
+    DREAM3D_REGISTER_TEST(TestMemoryMappedStorage())
+    DREAM3D_REGISTER_TEST(TestDeferredLoader())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
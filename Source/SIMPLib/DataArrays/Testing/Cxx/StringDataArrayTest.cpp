@@ -44,6 +44,7 @@
 #include "SIMPLib/Geometry/MeshStructs.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 /**
 Funtions to test:
@@ -378,6 +379,101 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStringStorage()
+  {
+    const size_t numTuples = 100000;
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(numTuples, kArrayName, true);
+
+    // Tuples that were never set are empty
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(5), QString(""))
+    DREAM3D_REQUIRE(strings->getValueUtf8(5).empty())
+
+    // Different tuples can be set concurrently
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numTuples);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        strings->setValue(i, QString("Value %1").arg(i));
+      }
+    });
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(strings->getValue(i), QString("Value %1").arg(i))
+    }
+
+    // Overwriting every value several times drops the old bytes from the buffer
+    for(size_t pass = 0; pass < 4; pass++)
+    {
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        strings->setValue(i, QString("Pass %1 \u00C5ngstr\u00F6m %2").arg(pass).arg(i));
+      }
+    }
+    size_t bytesPerValue = QString("Pass 3 \u00C5ngstr\u00F6m %1").arg(numTuples).toUtf8().size() + 1;
+    DREAM3D_REQUIRE(strings->getBufferSize() <= 2 * numTuples * bytesPerValue)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      QString expected = QString("Pass 3 \u00C5ngstr\u00F6m %1").arg(i);
+      DREAM3D_REQUIRE_EQUAL(strings->getValue(i), expected)
+      std::string_view view = strings->getValueUtf8(i);
+      DREAM3D_REQUIRE(view == expected.toUtf8().constData())
+      DREAM3D_REQUIRE_EQUAL(view.data()[view.size()], '\0')
+    }
+
+    // getVoidPointer() and initializeTuple() both work on the UTF-8 bytes, so values can be copied through IDataArray
+    IDataArray::Pointer source = strings;
+    DREAM3D_REQUIRE(std::string_view(reinterpret_cast<const char*>(source->getVoidPointer(9))) == strings->getValueUtf8(9))
+    source->initializeTuple(8, source->getVoidPointer(9));
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(8), QString("Pass 3 \u00C5ngstr\u00F6m 9"))
+    DREAM3D_REQUIRE(nullptr == source->getVoidPointer(numTuples))
+    strings->setValue(8, QString("Pass 3 \u00C5ngstr\u00F6m 8"));
+
+    // Copies, erasing and deep copies keep the values
+    DREAM3D_REQUIRE_EQUAL(strings->copyTuple(7, 3), 0)
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(3), strings->getValue(7))
+    std::vector<size_t> idxs = {0, 2, 4};
+    DREAM3D_REQUIRE_EQUAL(strings->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(strings->getNumberOfTuples(), numTuples - 3)
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(0), QString("Pass 3 \u00C5ngstr\u00F6m 1"))
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(1), QString("Pass 3 \u00C5ngstr\u00F6m 7"))
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(2), QString("Pass 3 \u00C5ngstr\u00F6m 5"))
+    StringDataArray::Pointer copy = std::dynamic_pointer_cast<StringDataArray>(strings->deepCopy());
+    for(size_t i = 0; i < copy->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE(copy->getValueUtf8(i) == strings->getValueUtf8(i))
+    }
+
+    // A dictionary encoded array stores each distinct value once
+    StringDataArray::Pointer labels = StringDataArray::CreateArray(numTuples, kArrayName, true);
+    labels->setDictionaryEncoded(true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      labels->setValue(i, (i % 3 == 0) ? ::_0 : (i % 3 == 1) ? ::_1 : ::_2);
+    }
+    DREAM3D_REQUIRE(labels->getBufferSize() < 64)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      QString expected = (i % 3 == 0) ? ::_0 : (i % 3 == 1) ? ::_1 : ::_2;
+      DREAM3D_REQUIRE_EQUAL(labels->getValue(i), expected)
+    }
+
+    // Turning it on merges the values that are already stored
+    copy->initializeWithZeros();
+    for(size_t i = 0; i < 1000; i++)
+    {
+      copy->setValue(i, (i % 2 == 0) ? ::_3 : ::_4);
+    }
+    copy->setDictionaryEncoded(true);
+    DREAM3D_REQUIRE(copy->getBufferSize() < 64)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(998), ::_3)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(999), ::_4)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(1000), QString(""))
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -396,6 +492,7 @@ public:
     DREAM3D_REGISTER_TEST(TestTupleCopy())
     DREAM3D_REGISTER_TEST(TestTupleErase())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestStringStorage())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -36,8 +36,11 @@
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 
 // C++ Includes
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <numeric>
 
 // HDF5 Includes
 #include <hdf5.h>
@@ -52,15 +55,161 @@ using namespace H5Support;
 
 // DREAM3D Includes
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriteOptions.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
+namespace
+{
+/**
+ * @brief Describes how the NeighborLists that share one NumNeighbors array are compacted when features are
+ * removed. Offsets index the flattened lists, keepEntry holds one flag per entry of the old lists.
+ */
+struct NeighborListRemap
+{
+  NeighborList<int32_t>::OffsetsType oldOffsets;
+  NeighborList<int32_t>::OffsetsType newOffsets;
+  std::vector<uint8_t> keepEntry;
+};
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Func>
+bool ApplyIfNeighborList(IDataArray* array, Func& func)
+{
+  auto* list = dynamic_cast<NeighborList<T>*>(array);
+  if(nullptr == list)
+  {
+    return false;
+  }
+  func(*list);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Func>
+bool ApplyToNeighborList(IDataArray* array, Func func)
+{
+  return ApplyIfNeighborList<int8_t>(array, func) || ApplyIfNeighborList<uint8_t>(array, func) || ApplyIfNeighborList<int16_t>(array, func) ||
+         ApplyIfNeighborList<uint16_t>(array, func) || ApplyIfNeighborList<int32_t>(array, func) || ApplyIfNeighborList<uint32_t>(array, func) ||
+         ApplyIfNeighborList<int64_t>(array, func) || ApplyIfNeighborList<uint64_t>(array, func) || ApplyIfNeighborList<float>(array, func) ||
+         ApplyIfNeighborList<double>(array, func) || ApplyIfNeighborList<char>(array, func) || ApplyIfNeighborList<size_t>(array, func);
+}
+
+/**
+ * @brief Treats the values of ids as feature ids and works out which entries survive the removal. Returns
+ * false if the list does not have one list per feature or holds a value that is not a valid feature id.
+ */
+bool BuildNeighborListRemap(const NeighborList<int32_t>& ids, const std::vector<uint8_t>& featureKept, const std::vector<size_t>& keptTuples, NeighborListRemap& remap)
+{
+  const size_t numLists = featureKept.size();
+  if(static_cast<size_t>(ids.getNumberOfLists()) != numLists)
+  {
+    return false;
+  }
+
+  remap.oldOffsets.assign(numLists + 1, 0);
+  for(size_t i = 0; i < numLists; i++)
+  {
+    remap.oldOffsets[i + 1] = remap.oldOffsets[i] + ids.getListView(static_cast<int>(i)).size();
+  }
+  remap.keepEntry.assign(remap.oldOffsets.back(), 0);
+  remap.newOffsets.assign(keptTuples.size() + 1, 0);
+
+  std::atomic_bool valid(true);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numLists);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      NeighborList<int32_t>::ConstListView view = ids.getListView(static_cast<int>(i));
+      uint8_t* keep = remap.keepEntry.data() + remap.oldOffsets[i];
+      for(size_t e = 0; e < view.size(); e++)
+      {
+        if(view[e] < 0 || static_cast<size_t>(view[e]) >= numLists)
+        {
+          valid = false;
+          return;
+        }
+        keep[e] = featureKept[view[e]];
+      }
+    }
+  });
+  if(!valid)
+  {
+    return false;
+  }
+
+  for(size_t k = 0; k < keptTuples.size(); k++)
+  {
+    const size_t tuple = keptTuples[k];
+    auto first = remap.keepEntry.begin() + remap.oldOffsets[tuple];
+    auto last = remap.keepEntry.begin() + remap.oldOffsets[tuple + 1];
+    remap.newOffsets[k + 1] = remap.newOffsets[k] + std::accumulate(first, last, uint64_t(0));
+  }
+  return true;
+}
+
+/**
+ * @brief Keeps the lists of the kept tuples and, inside them, the entries flagged in the remap. Values of the
+ * list the remap was built from are translated to the new feature ids. Returns false if the list does not have
+ * the same shape as the list the remap was built from.
+ */
+template <typename T>
+bool CompactNeighborList(NeighborList<T>& list, const NeighborListRemap& remap, const std::vector<size_t>& keptTuples, const std::vector<int32_t>* newIds)
+{
+  const size_t numLists = remap.oldOffsets.size() - 1;
+  if(static_cast<size_t>(list.getNumberOfLists()) != numLists)
+  {
+    return false;
+  }
+  for(size_t i = 0; i < numLists; i++)
+  {
+    if(list.getListView(static_cast<int>(i)).size() != remap.oldOffsets[i + 1] - remap.oldOffsets[i])
+    {
+      return false;
+    }
+  }
+
+  typename NeighborList<T>::VectorType values(remap.newOffsets.back());
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, keptTuples.size());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t k = range.min(); k < range.max(); k++)
+    {
+      const size_t tuple = keptTuples[k];
+      typename NeighborList<T>::ConstListView view = list.getListView(static_cast<int>(tuple));
+      const uint8_t* keep = remap.keepEntry.data() + remap.oldOffsets[tuple];
+      size_t dest = remap.newOffsets[k];
+      for(size_t e = 0; e < view.size(); e++)
+      {
+        if(keep[e] == 0)
+        {
+          continue;
+        }
+        if constexpr(std::is_same_v<T, int32_t>)
+        {
+          values[dest] = (nullptr != newIds) ? (*newIds)[view[e]] : view[e];
+        }
+        else
+        {
+          values[dest] = view[e];
+        }
+        dest++;
+      }
+    }
+  });
+  return list.setCompactLists(remap.newOffsets, std::move(values));
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -306,7 +455,7 @@ bool AttributeMatrix::validateAttributeArraySizes() const
 {
   int64_t arraySize = 0;
   int64_t matrixSize = getNumberOfTuples();
-  const AttributeMatrix::Container_t& dataArrays = getChildren();
+  const AttributeMatrix::Container_t& dataArrays = getChildrenWithoutDetaching();
   for(const auto& dataArray : dataArrays)
   {
     arraySize = dataArray->getNumberOfTuples();
@@ -411,7 +560,7 @@ size_t AttributeMatrix::getNumberOfTuples() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds)
+bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds, const QStringList& neighborIdListNames, AbstractFilter* filter)
 {
   bool acceptableMatrix = false;
   // Only valid for feature or ensemble type matrices
@@ -422,59 +571,178 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects,
     acceptableMatrix = true;
   }
   size_t totalTuples = getNumberOfTuples();
-  if(static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix)
+  if(static_cast<size_t>(activeObjects.size()) != totalTuples || !acceptableMatrix)
+  {
+    return false;
+  }
+
+  // Build the table of new ids once. Feature 0 is always kept and removed features map to 0.
+  std::vector<int32_t> newNames(totalTuples, 0);
+  std::vector<uint8_t> featureKept(totalTuples, 0);
+  std::vector<size_t> keptTuples;
+  std::vector<size_t> removeList;
+  if(totalTuples > 0)
+  {
+    featureKept[0] = 1;
+    keptTuples.push_back(0);
+  }
+  for(size_t i = 1; i < totalTuples; i++)
+  {
+    if(activeObjects[static_cast<int>(i)])
+    {
+      newNames[i] = static_cast<int32_t>(keptTuples.size());
+      featureKept[i] = 1;
+      keptTuples.push_back(i);
+    }
+    else
+    {
+      removeList.push_back(i);
+    }
+  }
+  if(removeList.empty())
+  {
+    return true;
+  }
+
+  // NeighborLists that are linked to the same NumNeighbors array hold one entry per neighbor in the same order,
+  // e.g. the neighbor ids and the shared surface areas. The group is remapped through the id list the caller named:
+  // entries that point at a removed feature are dropped from every list in the group and the ids are renumbered.
+  // Lists that cannot be tied to such an id list are removed, since their entries can not be remapped.
+  struct NeighborListGroup
+  {
+    QString numNeighborsName;
+    std::vector<IDataArray::Pointer> lists;
+    NeighborList<int32_t>* idList = nullptr;
+    NeighborListRemap remap;
+  };
+  std::vector<NeighborListGroup> neighborListGroups;
+  std::vector<IDataArray::Pointer> dataArrays;
+  for(const auto& header : getAttributeArrayNames())
   {
-    size_t goodcount = 1;
-    std::vector<size_t> newNames(totalTuples, 0);
-    std::vector<size_t> removeList;
+    IDataArray::Pointer p = getAttributeArray(header);
+    QString numNeighborsName;
+    if(!ApplyToNeighborList(p.get(), [&](auto& list) { numNeighborsName = list.getNumNeighborsArrayName(); }))
+    {
+      dataArrays.push_back(p);
+      continue;
+    }
+    auto group = std::find_if(neighborListGroups.begin(), neighborListGroups.end(),
+                              [&](const NeighborListGroup& g) { return !numNeighborsName.isEmpty() && g.numNeighborsName == numNeighborsName; });
+    if(group == neighborListGroups.end())
+    {
+      group = neighborListGroups.insert(neighborListGroups.end(), NeighborListGroup());
+      group->numNeighborsName = numNeighborsName;
+    }
+    group->lists.push_back(p);
+  }
+
+  auto removeNeighborList = [&](const IDataArray::Pointer& p, int code, const QString& reason) {
+    removeAttributeArray(p->getName());
+    if(nullptr != filter)
+    {
+      QString ss = QObject::tr("AttributeMatrix:'%1' The NeighborList '%2' was removed because %3").arg(getName()).arg(p->getName()).arg(reason);
+      filter->setWarningCondition(code, ss);
+    }
+  };
 
-    for(qint32 i = 1; i < activeObjects.size(); i++)
+  for(auto& group : neighborListGroups)
+  {
+    std::vector<NeighborList<int32_t>*> idLists;
+    if(!group.numNeighborsName.isEmpty())
     {
-      if(!activeObjects[i])
+      for(const auto& p : group.lists)
       {
-        removeList.push_back(i);
-        newNames[i] = 0;
+        auto* ids = dynamic_cast<NeighborList<int32_t>*>(p.get());
+        if(nullptr != ids && neighborIdListNames.contains(p->getName()))
+        {
+          idLists.push_back(ids);
+        }
       }
-      else
+    }
+
+    QString reason;
+    if(idLists.size() == 1 && BuildNeighborListRemap(*idLists[0], featureKept, keptTuples, group.remap))
+    {
+      group.idList = idLists[0];
+      continue;
+    }
+    if(group.numNeighborsName.isEmpty())
+    {
+      reason = QObject::tr("it is not linked to a NumNeighbors array");
+    }
+    else if(idLists.empty())
+    {
+      reason = QObject::tr("none of the NeighborLists linked to '%1' is a list of ids of this matrix").arg(group.numNeighborsName);
+    }
+    else if(idLists.size() > 1)
+    {
+      reason = QObject::tr("more than one of the NeighborLists linked to '%1' is a list of ids of this matrix").arg(group.numNeighborsName);
+    }
+    else
+    {
+      reason = QObject::tr("the id list '%1' does not hold one list per object with valid ids").arg(idLists[0]->getName());
+    }
+    for(const auto& p : group.lists)
+    {
+      removeNeighborList(p, -10020, reason);
+    }
+  }
+
+  // Every other array is compacted with the same remove list, each in its own task
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, dataArrays.size());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      dataArrays[i]->eraseTuples(removeList);
+    }
+  });
+
+  for(auto& group : neighborListGroups)
+  {
+    if(nullptr == group.idList)
+    {
+      continue;
+    }
+    for(const auto& p : group.lists)
+    {
+      bool compacted = false;
+      const std::vector<int32_t>* newIds = (p.get() == group.idList) ? &newNames : nullptr;
+      ApplyToNeighborList(p.get(), [&](auto& list) { compacted = CompactNeighborList(list, group.remap, keptTuples, newIds); });
+      if(!compacted)
       {
-        newNames[i] = goodcount;
-        goodcount++;
+        removeNeighborList(p, -10021, QObject::tr("its lists do not match the id list '%1'").arg(group.idList->getName()));
       }
     }
 
-    if(!removeList.empty())
+    // Keep the linked NumNeighbors array in step with the compacted lists
+    Int32ArrayType::Pointer numNeighbors = getAttributeArrayAs<Int32ArrayType>(group.numNeighborsName);
+    if(nullptr != numNeighbors && numNeighbors->getNumberOfTuples() == keptTuples.size() && numNeighbors->getNumberOfComponents() == 1)
     {
-      QList<QString> headers = getAttributeArrayNames();
-      for(const auto& header : headers)
+      for(size_t k = 0; k < keptTuples.size(); k++)
       {
-        IDataArray::Pointer p = getAttributeArray(header);
-        if(p->getNameOfClass() == "NeighborList<T>")
-        {
-          removeAttributeArray(header);
-        }
-        else
-        {
-          p->eraseTuples(removeList);
-        }
+        numNeighbors->setValue(k, static_cast<int32_t>(group.remap.newOffsets[k + 1] - group.remap.newOffsets[k]));
       }
-      std::vector<size_t> tDims(1, (totalTuples - removeList.size()));
-      setTupleDimensions(tDims);
+    }
+  }
+
+  std::vector<size_t> tDims(1, keptTuples.size());
+  setTupleDimensions(tDims);
 
-      // Loop over all the points and correct all the feature names
-      size_t totalPoints = featureIds->getNumberOfTuples();
-      int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
+  // Loop over all the points and correct all the feature names
+  if(nullptr != featureIds)
+  {
+    int32_t* featureIdPtr = featureIds->getPointer(0);
+    dataAlg.setRange(0, featureIds->getNumberOfTuples());
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
+        if(featureIdPtr[i] >= 0 && static_cast<size_t>(featureIdPtr[i]) < newNames.size())
         {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
+          featureIdPtr[i] = newNames[featureIdPtr[i]];
         }
       }
-    }
-  }
-  else
-  {
-    return false;
+    });
   }
   return true;
 }
@@ -531,7 +799,7 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate) const
 {
   AttributeMatrix::Pointer newAttrMat = AttributeMatrix::New(getTupleDimensions(), getName(), getType());
 
-  const auto& dataArrays = getChildren();
+  const auto& dataArrays = getChildrenWithoutDetaching();
   for(const auto& d : dataArrays)
   {
     IDataArray::Pointer new_d = d->deepCopy(forceNoAllocate);
@@ -544,17 +812,43 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate) const
 
   return newAttrMat;
 }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer AttributeMatrix::createSnapshot() const
+{
+  AttributeMatrix::Pointer newAttrMat = AttributeMatrix::New(getTupleDimensions(), getName(), getType());
+  newAttrMat->shareChildren(*this);
+  return newAttrMat;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer AttributeMatrix::createDetachedChild(const IDataArray::Pointer& child) const
+{
+  return child->deepCopy(false);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId) const
+{
+  return writeAttributeArraysToHDF5(parentId, H5DataArrayWriteOptions());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId, const H5DataArrayWriteOptions& options) const
 {
   int err = 0;
 
-  const auto& dataArrays = getChildren();
+  const auto& dataArrays = getChildrenWithoutDetaching();
   for(const auto& d : dataArrays)
   {
-    err = d->writeH5Data(parentId, m_TupleDims);
+    err = d->writeH5Data(parentId, m_TupleDims, options);
     if(err < 0)
     {
       return err;
@@ -628,40 +922,13 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 {
   int err = 0;
   AttributeMatrixProxy::StorageType dasToRead = attrMatProxy->getDataArrays();
-  QString classType;
   for(const auto& daToRead : dasToRead)
   {
     if(daToRead.getFlag() == SIMPL::Unchecked)
     {
       continue;
     }
-    QH5Lite::readStringAttribute(amGid, daToRead.getName(), SIMPL::HDF5::ObjectType, classType);
-    //   qDebug() << groupName << " Array: " << *iter << " with C++ ClassType of " << classType << "\n";
-    IDataArray::Pointer dPtr = IDataArray::NullPointer();
-
-    if(classType.startsWith("DataArray"))
-    {
-      dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), preflight);
-    }
-    else if(classType.compare("StringDataArray") == 0)
-    {
-      dPtr = H5DataArrayReader::ReadStringDataArray(amGid, daToRead.getName(), preflight);
-    }
-    else if(classType.compare("vector") == 0)
-    {
-    }
-    else if(classType.compare("NeighborList<T>") == 0)
-    {
-      dPtr = H5DataArrayReader::ReadNeighborListData(amGid, daToRead.getName(), preflight);
-    }
-    else if(classType.compare("Statistics") == 0)
-    {
-      StatsDataArray::Pointer statsData = StatsDataArray::New();
-      statsData->setName(daToRead.getName());
-      statsData->readH5Data(amGid);
-      dPtr = statsData;
-    }
-
+    IDataArray::Pointer dPtr = ReadAttributeArrayFromHDF5(amGid, daToRead.getName(), preflight);
     if(nullptr != dPtr.get())
     {
       addOrReplaceAttributeArray(dPtr);
@@ -671,6 +938,41 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer AttributeMatrix::ReadAttributeArrayFromHDF5(hid_t amGid, const QString& name, bool preflight)
+{
+  QString classType;
+  QH5Lite::readStringAttribute(amGid, name, SIMPL::HDF5::ObjectType, classType);
+  //   qDebug() << groupName << " Array: " << *iter << " with C++ ClassType of " << classType << "\n";
+  IDataArray::Pointer dPtr = IDataArray::NullPointer();
+
+  if(classType.startsWith("DataArray"))
+  {
+    dPtr = H5DataArrayReader::ReadIDataArray(amGid, name, preflight);
+  }
+  else if(classType.compare("StringDataArray") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadStringDataArray(amGid, name, preflight);
+  }
+  else if(classType.compare("vector") == 0)
+  {
+  }
+  else if(classType.compare("NeighborList<T>") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadNeighborListData(amGid, name, preflight);
+  }
+  else if(classType.compare("Statistics") == 0)
+  {
+    StatsDataArray::Pointer statsData = StatsDataArray::New();
+    statsData->setName(name);
+    statsData->readH5Data(amGid);
+    dPtr = statsData;
+  }
+  return dPtr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1033,6 +1335,15 @@ IDataArray::Pointer AttributeMatrix::getPrereqIDataArray(AbstractFilter* filter,
   {
     ss = QObject::tr("Unable to cast input array %1 to the necessary type.").arg(attributeArrayName);
     filter->setErrorCondition(err, ss);
+    return attributeArray;
+  }
+
+  // The per element accessors of a lazily loaded array do not load it, so load it before the filter uses it
+  int32_t loadErr = attributeArray->loadDeferredValues();
+  if(loadErr < 0 && filter)
+  {
+    ss = QObject::tr("The values of the DataArray '%1' in the AttributeMatrix '%2' could not be loaded").arg(attributeArrayName).arg(getName());
+    filter->setErrorCondition(loadErr, ss);
   }
 
   return attributeArray;
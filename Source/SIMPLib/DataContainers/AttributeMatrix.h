@@ -45,6 +45,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QVector>
 
 //-- DREAM3D Includes
@@ -373,6 +374,16 @@ public:
                .arg(attributeArrayName);
       filter->setErrorCondition(err, ss);
     }
+    if(nullptr != attributeArray.get())
+    {
+      // The per element accessors of a lazily loaded array do not load it, so load it before the filter uses it
+      int32_t loadErr = attributeArray->loadDeferredValues();
+      if(loadErr < 0 && filter)
+      {
+        ss = QObject::tr("The values of the DataArray '%1' in the AttributeMatrix '%2' could not be loaded").arg(attributeArrayName).arg(getName());
+        filter->setErrorCondition(loadErr, ss);
+      }
+    }
     return attributeArray;
   }
 
@@ -559,10 +570,18 @@ public:
 
   /**
   * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
-    (only valid for feature or ensemble type matrices)
-  * @param size The new size of the array
+    (only valid for feature or ensemble type matrices). All arrays are compacted in parallel with one remap table and
+    featureIds is relabeled to the new ids. NeighborLists that share a NumNeighbors array are kept when exactly one of
+    them is named in neighborIdListNames: entries that point at removed objects are dropped from every list of the group
+    and the ids in the named list are renumbered. Any other NeighborList is removed and a warning is set on the filter.
+  * @param activeObjects One flag per tuple, object 0 is always kept
+  * @param featureIds The element level ids that point into this matrix
+  * @param neighborIdListNames Names of the Int32 NeighborLists that hold ids of objects in this matrix
+  * @param filter Receives a warning for every NeighborList that is removed, may be nullptr
+  * @return false if the matrix type or the number of flags is not valid
   */
-  bool removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds);
+  bool removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds, const QStringList& neighborIdListNames = QStringList(SIMPL::FeatureData::NeighborList),
+                             AbstractFilter* filter = nullptr);
 
   /**
    * @brief Sets the Tuple Dimensions for the Attribute Matrix
@@ -589,6 +608,13 @@ public:
    */
   virtual AttributeMatrix::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Creates a copy-on-write snapshot of the attribute matrix.  The attribute arrays are shared
+   * with this attribute matrix and only copied when they are accessed through the snapshot.
+   * @return
+   */
+  virtual AttributeMatrix::Pointer createSnapshot() const;
+
   /**
    * @brief writeAttributeArraysToHDF5
    * @param parentId
@@ -596,6 +622,14 @@ public:
    */
   virtual int writeAttributeArraysToHDF5(hid_t parentId) const;
 
+  /**
+   * @brief writeAttributeArraysToHDF5
+   * @param parentId
+   * @param options Chunking and compression settings for the datasets
+   * @return
+   */
+  virtual int writeAttributeArraysToHDF5(hid_t parentId, const H5DataArrayWriteOptions& options) const;
+
   /**
    * @brief addAttributeArrayFromHDF5Path
    * @param gid
@@ -614,6 +648,16 @@ public:
    */
   virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
 
+  /**
+   * @brief Reads a single attribute array of any of the supported array classes from an
+   * AttributeMatrix group. The array is not added to any AttributeMatrix.
+   * @param amGid
+   * @param name
+   * @param preflight
+   * @return The array or a null pointer if the array could not be read
+   */
+  static IDataArray::Pointer ReadAttributeArrayFromHDF5(hid_t amGid, const QString& name, bool preflight);
+
   /**
    * @brief generateXdmfText
    * @param centering
@@ -642,6 +686,13 @@ public:
 protected:
   AttributeMatrix(const std::vector<size_t>& tDims, const QString& name, AttributeMatrix::Type attrType);
 
+  /**
+   * @brief Creates the private copy of an attribute array shared with the attribute matrix this snapshot was created from
+   * @param child
+   * @return
+   */
+  IDataArrayShPtrType createDetachedChild(const IDataArrayShPtrType& child) const override;
+
   /**
    * @brief writeXdmfAttributeData
    * @param array
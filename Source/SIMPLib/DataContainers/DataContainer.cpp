@@ -53,6 +53,7 @@
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayWriteOptions.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
@@ -232,6 +233,14 @@ DataContainer::NameList DataContainer::getAttributeMatrixNames() const
 //
 // -----------------------------------------------------------------------------
 int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId) const
+{
+  return writeAttributeMatricesToHDF5(parentId, H5DataArrayWriteOptions());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId, const H5DataArrayWriteOptions& options) const
 {
   int err;
   hid_t attributeMatrixId;
@@ -260,7 +269,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId) const
     {
       return err;
     }
-    err = attrMat->writeAttributeArraysToHDF5(attributeMatrixId);
+    err = attrMat->writeAttributeArraysToHDF5(attributeMatrixId, options);
     if(err < 0)
     {
       return err;
@@ -342,7 +351,7 @@ DataContainer::Pointer DataContainer::deepCopy(bool forceNoAllocate) const
     dcCopy->setGeometry(geomCopy);
   }
 
-  const auto attrMatrices = getChildren();
+  const auto& attrMatrices = getChildrenWithoutDetaching();
   for(const auto& am : attrMatrices)
   {
     AttributeMatrix::Pointer attrMat = am->deepCopy(forceNoAllocate);
@@ -352,6 +361,31 @@ DataContainer::Pointer DataContainer::deepCopy(bool forceNoAllocate) const
   return dcCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer DataContainer::createSnapshot() const
+{
+  DataContainer::Pointer dcCopy = DataContainer::New(getName());
+
+  if(m_Geometry.get() != nullptr)
+  {
+    IGeometry::Pointer geomCopy = m_Geometry->deepCopy(false);
+    dcCopy->setGeometry(geomCopy);
+  }
+
+  dcCopy->shareChildren(*this);
+  return dcCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer DataContainer::createDetachedChild(const AttributeMatrix::Pointer& child) const
+{
+  return child->createSnapshot();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -727,7 +761,7 @@ int DataContainer::readMeshDataFromHDF5(hid_t dcGid, bool preflight)
 QVector<DataArrayPath> DataContainer::getAllDataArrayPaths() const
 {
   QVector<DataArrayPath> paths;
-  const auto attributeMatrices = getChildren();
+  const auto& attributeMatrices = getChildrenWithoutDetaching();
   for(const auto& am : attributeMatrices)
   {
     QString amName = am->getName();
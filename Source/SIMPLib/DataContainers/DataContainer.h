@@ -397,6 +397,14 @@ public:
    */
   virtual int writeAttributeMatricesToHDF5(hid_t parentId) const;
 
+  /**
+   * @brief Writes all the Attribute Matrices to HDF5 file
+   * @param parentId
+   * @param options Chunking and compression settings for the datasets
+   * @return
+   */
+  virtual int writeAttributeMatricesToHDF5(hid_t parentId, const H5DataArrayWriteOptions& options) const;
+
   /**
    * @brief Reads desired Attribute Matrices from HDF5 file
    * @return
@@ -409,6 +417,13 @@ public:
    */
   virtual DataContainer::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Creates a copy-on-write snapshot of the DataContainer.  The Geometry is copied but the
+   * AttributeMatrices are shared with this DataContainer until they are accessed through the snapshot.
+   * @return
+   */
+  virtual DataContainer::Pointer createSnapshot() const;
+
   /**
    * @brief writeMeshToHDF5
    * @param dcGid
@@ -435,6 +450,13 @@ public:
 protected:
   virtual void writeXdmfFooter(QTextStream& xdmf) const;
 
+  /**
+   * @brief Creates the private copy of an AttributeMatrix shared with the DataContainer this snapshot was created from
+   * @param child
+   * @return
+   */
+  AttributeMatrixShPtr createDetachedChild(const AttributeMatrixShPtr& child) const override;
+
   DataContainer();
   explicit DataContainer(const QString& name);
 
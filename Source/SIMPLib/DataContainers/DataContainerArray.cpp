@@ -674,7 +674,7 @@ void DataContainerArray::setMontageTileFromDataContainerName(AbstractFilter* fil
 DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate) const
 {
   DataContainerArray::Pointer dcaCopy = DataContainerArray::New();
-  const Container dcs = getDataContainers();
+  const Container& dcs = getChildrenWithoutDetaching();
   for(const auto& dc : dcs)
   {
     DataContainer::Pointer dcCopy = dc->deepCopy(forceNoAllocate);
@@ -694,6 +694,32 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate) c
   return dcaCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerArray::createSnapshot() const
+{
+  DataContainerArray::Pointer dcaCopy = DataContainerArray::New();
+  dcaCopy->shareChildren(*this);
+
+  const MontageCollection montageCollection = getMontageCollection();
+  for(const auto& montage : montageCollection)
+  {
+    AbstractMontage::Pointer montageCopy = montage->propagate(dcaCopy);
+    dcaCopy->addMontage(montageCopy);
+  }
+
+  return dcaCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer DataContainerArray::createDetachedChild(const DataContainer::Pointer& child) const
+{
+  return child->createSnapshot();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
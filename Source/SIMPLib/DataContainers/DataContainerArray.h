@@ -661,9 +661,26 @@ public:
    */
   DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Creates a copy-on-write snapshot of the DataContainerArray.  The snapshot shares
+   * its DataContainers with this instance and only copies a DataContainer, AttributeMatrix
+   * or DataArray the first time it is accessed through the snapshot, so creating it costs
+   * O(number of DataContainers).  This instance must be treated as read-only while the
+   * snapshot is alive.
+   * @return
+   */
+  DataContainerArray::Pointer createSnapshot() const;
+
 protected:
   DataContainerArray();
 
+  /**
+   * @brief Creates the private copy of a DataContainer shared with the array this snapshot was created from
+   * @param child
+   * @return
+   */
+  DataContainerShPtr createDetachedChild(const DataContainerShPtr& child) const override;
+
 private:
   QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
   MontageCollection m_MontageCollection;
@@ -59,9 +59,127 @@ public:
   using NameList = QList<QString>;
 
 private:
-  ChildCollection m_ChildrenNodes;
+  /**
+   * Children are normally owned by this container (their parent node is this).  A
+   * copy-on-write snapshot may also hold children that are still owned by the container
+   * it was created from.  Every accessor that hands out a child, const or not, replaces
+   * those with a private copy first, so a shared child can never be modified through the
+   * snapshot.  A container without shared children is never modified by const access, so
+   * concurrent readers of it are safe; a snapshot must be used from one thread at a time.
+   */
+  mutable ChildCollection m_ChildrenNodes;
+
+  /**
+   * @brief Returns true if the child is borrowed from another container through
+   * shareChildren() and has not been detached yet.
+   * @param child
+   * @return
+   */
+  bool isSharedChild(const ChildShPtr& child) const
+  {
+    return child != nullptr && child->getParentNode() != this;
+  }
+
+  /**
+   * @brief Replaces a shared child with a private copy owned by this container.
+   * @param child
+   */
+  void detachChild(ChildShPtr& child) const
+  {
+    if(!isSharedChild(child))
+    {
+      return;
+    }
+    ChildShPtr copy = createDetachedChild(child);
+    if(copy == nullptr)
+    {
+      return;
+    }
+    child = copy;
+    createParentConnection(child.get(), const_cast<Self*>(this));
+  }
+
+  /**
+   * @brief Detaches every shared child.  Called before the whole collection is handed out for writing.
+   */
+  void detachChildren() const
+  {
+    for(auto& child : m_ChildrenNodes)
+    {
+      detachChild(child);
+    }
+  }
+
+  /**
+   * @brief Returns an iterator to the child with the given name without detaching it.
+   * @param name
+   * @return
+   */
+  const_iterator findChildNode(const QString& name) const
+  {
+    const auto hash = CreateStringHash(name);
+    for(auto iter = m_ChildrenNodes.cbegin(); iter != m_ChildrenNodes.cend(); iter++)
+    {
+      if((*iter)->checkNameHash(hash))
+      {
+        return iter;
+      }
+    }
+    return m_ChildrenNodes.cend();
+  }
+
+  /**
+   * @brief Returns an iterator to the child with the given name without detaching it.
+   * @param name
+   * @return
+   */
+  iterator findChildNode(const QString& name)
+  {
+    const_iterator iter = static_cast<const Self*>(this)->findChildNode(name);
+    return m_ChildrenNodes.begin() + (iter - m_ChildrenNodes.cbegin());
+  }
 
 protected:
+  /**
+   * @brief Creates the private copy used when a shared child is detached.  Containers that
+   * support copy-on-write snapshots override this.  Returning nullptr keeps the shared child.
+   * @param child
+   * @return
+   */
+  virtual ChildShPtr createDetachedChild(const ChildShPtr& child) const
+  {
+    (void)child;
+    return nullptr;
+  }
+
+  /**
+   * @brief Returns the children collection without detaching shared children.  Only for read
+   * only use inside the containers, such as writing or deep copying them, where detaching
+   * would copy the children for nothing.
+   * @return
+   */
+  const ChildCollection& getChildrenWithoutDetaching() const
+  {
+    return m_ChildrenNodes;
+  }
+
+  /**
+   * @brief Appends all children of the source container without taking ownership of them.
+   * The children stay attached to the source and are only copied into this container when
+   * they are first accessed.  The source must not be modified while the copy is alive.
+   * @param source
+   */
+  void shareChildren(const Self& source)
+  {
+    for(const auto& child : source.m_ChildrenNodes)
+    {
+      if(findChildNode(child->getName()) == m_ChildrenNodes.end())
+      {
+        m_ChildrenNodes.push_back(child);
+      }
+    }
+  }
+
 public:
   IDataStructureContainerNode(const QString& name = "")
   : AbstractDataStructureContainer(name)
@@ -77,11 +195,12 @@ public:
   }
 
   /**
-   * @brief Returns a copy of the children collection.
+   * @brief Returns the children collection after replacing every shared child with a private copy.
    * @return
    */
-  constexpr const ChildCollection& getChildren() const
+  const ChildCollection& getChildren() const
   {
+    detachChildren();
     return m_ChildrenNodes;
   }
 
@@ -121,6 +240,42 @@ public:
     return paths;
   }
 
+  /**
+   * @brief Returns the paths of the children this snapshot owns, which are the children that were accessed
+   * through it and replaced with private copies or that were added to it. Children still shared with the
+   * source were never accessed and are skipped. A private child container is returned as a whole while all
+   * of its own children are shared and by its private descendants otherwise.
+   * @return
+   */
+  DataArrayPathList getPrivateDescendantPaths() const override
+  {
+    DataArrayPathList paths;
+
+    for(const auto& child : m_ChildrenNodes)
+    {
+      if(isSharedChild(child))
+      {
+        continue;
+      }
+      DataArrayPathList childPaths;
+      auto childContainer = std::dynamic_pointer_cast<AbstractDataStructureContainer>(child);
+      if(nullptr != childContainer)
+      {
+        childPaths = childContainer->getPrivateDescendantPaths();
+      }
+      if(childPaths.empty())
+      {
+        paths.push_back(child->getDataArrayPath());
+      }
+      else
+      {
+        paths.splice(paths.end(), childPaths);
+      }
+    }
+
+    return paths;
+  }
+
   /**
    * @brief Returns a list of DataArrayPaths from both itself and all its descendants.
    * @return
@@ -136,26 +291,31 @@ public:
    * @brief Returns an iterator pointing to the start of the children collection.
    * @return
    */
-  constexpr iterator begin() noexcept
+  iterator begin()
   {
+    detachChildren();
     return m_ChildrenNodes.begin();
   }
 
   /**
-   * @brief Returns a const iterator pointing to the start of the children collection.
+   * @brief Returns a const iterator pointing to the start of the children collection after
+   * replacing every shared child with a private copy.
    * @return
    */
-  constexpr const_iterator begin() const noexcept
+  const_iterator begin() const
   {
-    return m_ChildrenNodes.begin();
+    detachChildren();
+    return m_ChildrenNodes.cbegin();
   }
 
   /**
-   * @brief Returns a const iterator pointing to the start of the children collection.
+   * @brief Returns a const iterator pointing to the start of the children collection after
+   * replacing every shared child with a private copy.
    * @return
    */
-  constexpr const_iterator cbegin() const noexcept
+  const_iterator cbegin() const
   {
+    detachChildren();
     return m_ChildrenNodes.cbegin();
   }
 
@@ -208,17 +368,17 @@ public:
    * @brief Clears the children collection.  Items are not deleted unless this
    * was the last shared_ptr referencing them.
    */
-  constexpr void clear() noexcept
+  void clear()
   {
-    auto children = getChildren();
+    ChildCollection children = m_ChildrenNodes;
+    m_ChildrenNodes.clear();
     for(auto& child : children)
     {
-      if(child != nullptr)
+      if(child != nullptr && !isSharedChild(child))
       {
         destroyParentConnection(child.get());
       }
     }
-    m_ChildrenNodes.clear();
   }
 
   /**
@@ -227,18 +387,14 @@ public:
    * @param name
    * @return
    */
-  constexpr iterator find(const QString& name)
+  iterator find(const QString& name)
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
+    auto iter = findChildNode(name);
+    if(iter != m_ChildrenNodes.end())
     {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
+      detachChild(*iter);
     }
-
-    return end();
+    return iter;
   }
 
   /**
@@ -247,39 +403,30 @@ public:
    * @param name
    * @return
    */
-  constexpr const_iterator find(const QString& name) const
+  const_iterator find(const QString& name) const
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
+    const_iterator iter = findChildNode(name);
+    if(iter != m_ChildrenNodes.cend())
     {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
+      detachChild(m_ChildrenNodes[iter - m_ChildrenNodes.cbegin()]);
     }
-
-    return cend();
+    return iter;
   }
 
   /**
-   * @brief Returns the child with the given name as a shared_ptr.
-   * If no child is found, return nullptr.
+   * @brief Returns the child with the given name as a shared_ptr after replacing it with a private
+   * copy if it is shared.  If no child is found, return nullptr.
    * @param name
    * @return
    */
-  constexpr ChildShPtr getChildByName(const QString& name) const
+  ChildShPtr getChildByName(const QString& name) const
   {
-    HashType nameHash = CreateStringHash(name);
-
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    auto iter = find(name);
+    if(iter == cend())
     {
-      if(child->checkNameHash(nameHash))
-      {
-        return child;
-      }
+      return nullptr;
     }
-    return nullptr;
+    return *iter;
   }
 
   /**
@@ -288,9 +435,9 @@ public:
    * @param name
    * @return
    */
-  constexpr bool contains(const QString& name) const
+  bool contains(const QString& name) const
   {
-    return getChildByName(name) != nullptr;
+    return findChildNode(name) != m_ChildrenNodes.end();
   }
 
   /**
@@ -299,10 +446,9 @@ public:
    * @param obj
    * @return
    */
-  constexpr bool contains(const ChildShPtr& obj) const
+  bool contains(const ChildShPtr& obj) const
   {
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    for(const auto& child : m_ChildrenNodes)
     {
       if(child == obj)
       {
@@ -318,14 +464,14 @@ public:
    * @param name
    * @return
    */
-  constexpr int64_t getIndex(const QString& name) const
+  int64_t getIndex(const QString& name) const
   {
-    auto iter = find(name);
-    if(iter == cend())
+    auto iter = findChildNode(name);
+    if(iter == m_ChildrenNodes.end())
     {
       return -1;
     }
-    return iter - begin();
+    return iter - m_ChildrenNodes.begin();
   }
 
   /**
@@ -334,7 +480,7 @@ public:
    * @param index
    * @return
    */
-  constexpr ChildShPtr& operator[](size_t index)
+  ChildShPtr& operator[](size_t index)
   {
     if(index < 0 || index > m_ChildrenNodes.size())
     {
@@ -342,6 +488,7 @@ public:
       throw std::out_of_range(msg);
     }
 
+    detachChild(m_ChildrenNodes[index]);
     return m_ChildrenNodes[index];
   }
 
@@ -351,7 +498,7 @@ public:
    * @param name
    * @return
    */
-  constexpr ChildShPtr& operator[](const QString& name)
+  ChildShPtr& operator[](const QString& name)
   {
     return operator[](getIndex(name));
   }
@@ -404,8 +551,8 @@ public:
       return false;
     }
 
-    auto iter = find(node->getName());
-    if(iter != end())
+    auto iter = findChildNode(node->getName());
+    if(iter != m_ChildrenNodes.end())
     {
       if((*iter) != node)
       {
@@ -430,7 +577,11 @@ public:
   {
     ChildShPtr child = (*iter);
     m_ChildrenNodes.erase(iter);
-    destroyParentConnection(child.get());
+    // Shared children still belong to the container the snapshot was created from
+    if(!isSharedChild(child))
+    {
+      destroyParentConnection(child.get());
+    }
   }
 
   /**
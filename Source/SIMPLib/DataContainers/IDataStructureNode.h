@@ -209,6 +209,13 @@ public:
    */
   virtual IDataStructureNode::Pointer removeChildNode(const IDataStructureNode* rmChild) = 0;
 
+  /**
+   * @brief Returns the paths of the descendants a copy-on-write snapshot owns itself instead of sharing
+   * them with the container it was created from.
+   * @return
+   */
+  virtual DataArrayPathList getPrivateDescendantPaths() const = 0;
+
 protected:
   /**
    * @brief Sets the child's parent container.  This does not add the child to the parent's collection.
@@ -0,0 +1,170 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class AttributeMatrixTest
+{
+public:
+  AttributeMatrixTest() = default;
+  virtual ~AttributeMatrixTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    // Feature 0 is the background, features 2 and 4 are removed
+    std::vector<size_t> tDims = {5};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellFeatureData", AttributeMatrix::Type::CellFeature);
+
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(tDims, {2}, "Volumes", true);
+    for(size_t i = 0; i < 5; i++)
+    {
+      volumes->setComponent(i, 0, static_cast<float>(i));
+      volumes->setComponent(i, 1, static_cast<float>(i * 10));
+    }
+    am->insertOrAssign(volumes);
+
+    // Neighbor ids with a parallel list of shared areas, both linked to one NumNeighbors array
+    std::vector<std::vector<int32_t>> neighbors = {{}, {2, 3}, {1, 3, 4}, {1, 2}, {2}};
+    Int32NeighborListType::Pointer neighborList = Int32NeighborListType::CreateArray(5, QString("NeighborList"), true);
+    FloatNeighborListType::Pointer areaList = FloatNeighborListType::CreateArray(5, QString("SharedSurfaceAreaList"), true);
+    Int32ArrayType::Pointer numNeighbors = Int32ArrayType::CreateArray(tDims, {1}, "NumNeighbors", true);
+    for(size_t i = 0; i < neighbors.size(); i++)
+    {
+      for(const auto& n : neighbors[i])
+      {
+        neighborList->addEntry(static_cast<int>(i), n);
+        areaList->addEntry(static_cast<int>(i), static_cast<float>(10 * i + n));
+      }
+      numNeighbors->setValue(i, static_cast<int32_t>(neighbors[i].size()));
+    }
+    neighborList->setNumNeighborsArrayName("NumNeighbors");
+    areaList->setNumNeighborsArrayName("NumNeighbors");
+    am->insertOrAssign(neighborList);
+    am->insertOrAssign(areaList);
+    am->insertOrAssign(numNeighbors);
+
+    // An Int32 list in the same group whose values also look like feature ids is compacted but not renumbered,
+    // since only the named list holds ids
+    Int32NeighborListType::Pointer otherList = Int32NeighborListType::CreateArray(5, QString("OtherValues"), true);
+    for(size_t i = 0; i < neighbors.size(); i++)
+    {
+      for(const auto& n : neighbors[i])
+      {
+        otherList->addEntry(static_cast<int>(i), n);
+      }
+    }
+    otherList->setNumNeighborsArrayName("NumNeighbors");
+    am->insertOrAssign(otherList);
+
+    // A list that can not be tied to feature ids is dropped
+    FloatNeighborListType::Pointer unlinked = FloatNeighborListType::CreateArray(5, QString("Unlinked"), true);
+    unlinked->addEntry(1, 1.0f);
+    am->insertOrAssign(unlinked);
+
+    std::vector<size_t> cellDims = {6};
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(cellDims, {1}, "FeatureIds", true);
+    std::vector<int32_t> cellValues = {0, 1, 2, 3, 4, 3};
+    std::copy(cellValues.begin(), cellValues.end(), featureIds->begin());
+
+    AbstractFilter::Pointer filter = AbstractFilter::New();
+    QVector<bool> activeObjects = {true, true, false, true, false};
+    DREAM3D_REQUIRE(am->removeInactiveObjects(activeObjects, featureIds.get(), QStringList("NeighborList"), filter.get()))
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 3)
+
+    std::vector<float> expectedVolumes = {0.0f, 0.0f, 1.0f, 10.0f, 3.0f, 30.0f};
+    DREAM3D_REQUIRE_EQUAL(volumes->getSize(), expectedVolumes.size())
+    DREAM3D_REQUIRE(std::equal(expectedVolumes.begin(), expectedVolumes.end(), volumes->begin()))
+
+    std::vector<int32_t> expectedIds = {0, 1, 0, 2, 0, 2};
+    DREAM3D_REQUIRE(std::equal(expectedIds.begin(), expectedIds.end(), featureIds->begin()))
+
+    // Old feature 3 is now feature 2 and the entries that pointed at removed features are gone
+    DREAM3D_REQUIRE(am->doesAttributeArrayExist("NeighborList"))
+    DREAM3D_REQUIRE(am->doesAttributeArrayExist("SharedSurfaceAreaList"))
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("Unlinked"), false)
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -10020)
+    DREAM3D_REQUIRE_EQUAL(neighborList->getNumberOfLists(), 3)
+    DREAM3D_REQUIRE_EQUAL(neighborList->getListSize(0), 0)
+    DREAM3D_REQUIRE_EQUAL(neighborList->getListSize(1), 1)
+    DREAM3D_REQUIRE_EQUAL(neighborList->getListSize(2), 1)
+    DREAM3D_REQUIRE_EQUAL(neighborList->getListView(1)[0], 2)
+    DREAM3D_REQUIRE_EQUAL(neighborList->getListView(2)[0], 1)
+    DREAM3D_REQUIRE_EQUAL(areaList->getNumberOfLists(), 3)
+    DREAM3D_REQUIRE_EQUAL(areaList->getListView(1)[0], 13.0f)
+    DREAM3D_REQUIRE_EQUAL(areaList->getListView(2)[0], 31.0f)
+    DREAM3D_REQUIRE_EQUAL(otherList->getNumberOfLists(), 3)
+    DREAM3D_REQUIRE_EQUAL(otherList->getListView(1)[0], 3)
+    DREAM3D_REQUIRE_EQUAL(otherList->getListView(2)[0], 1)
+    DREAM3D_REQUIRE_EQUAL(numNeighbors->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(numNeighbors->getValue(1), 1)
+    DREAM3D_REQUIRE_EQUAL(numNeighbors->getValue(2), 1)
+
+    // Without a named id list the group can not be remapped and is removed with a warning
+    filter->clearWarningCode();
+    DREAM3D_REQUIRE(am->removeInactiveObjects(QVector<bool>({true, true, false}), featureIds.get(), QStringList(), filter.get()))
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 2)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("NeighborList"), false)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("SharedSurfaceAreaList"), false)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("OtherValues"), false)
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -10020)
+
+    // Nothing to remove leaves the matrix alone, a mismatched active list or a cell matrix is rejected
+    DREAM3D_REQUIRE(am->removeInactiveObjects(QVector<bool>(2, true), featureIds.get()))
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 2)
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(QVector<bool>(5, true), featureIds.get()), false)
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(cellDims, "CellData", AttributeMatrix::Type::Cell);
+    DREAM3D_REQUIRE_EQUAL(cellAm->removeInactiveObjects(QVector<bool>(6, true), featureIds.get()), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### AttributeMatrixTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects())
+  }
+
+private:
+  AttributeMatrixTest(const AttributeMatrixTest&); // Copy Constructor Not Implemented
+  void operator=(const AttributeMatrixTest&);      // Move assignment Not Implemented
+};
@@ -0,0 +1,205 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataContainerArrayTest
+{
+public:
+  DataContainerArrayTest() = default;
+  virtual ~DataContainerArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateDataContainerArray()
+  {
+    std::vector<size_t> tDims = {10, 20, 30};
+    std::vector<size_t> cDims = {3};
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    for(int i = 0; i < 2; i++)
+    {
+      DataContainer::Pointer dc = DataContainer::New(QString("DC %1").arg(i));
+      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellAttributeMatrix", AttributeMatrix::Type::Cell);
+      am->insertOrAssign(FloatArrayType::CreateArray(tDims, cDims, "Float Array", true));
+      am->insertOrAssign(Int32ArrayType::CreateArray(tDims, cDims, "Int32 Array", false));
+      dc->addOrReplaceAttributeMatrix(am);
+      dca->addOrReplaceDataContainer(dc);
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotStructure()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    DataContainerArray::Pointer snapshot = dca->createSnapshot();
+
+    DREAM3D_REQUIRE_EQUAL(snapshot->getNumDataContainers(), 2)
+    DREAM3D_REQUIRE(snapshot->doesAttributeArrayExist(DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array")))
+    DREAM3D_REQUIRE(snapshot->doesAttributeArrayExist(DataArrayPath("DC 1", "CellAttributeMatrix", "Int32 Array")))
+
+    // Accessing a node through the snapshot hands out a private copy owned by the snapshot
+    DataContainer::Pointer dc = snapshot->getDataContainer("DC 0");
+    DREAM3D_REQUIRE(dc != dca->getDataContainer("DC 0"))
+    DREAM3D_REQUIRE(dc->getParentNode() == snapshot.get())
+
+    IDataArray::Pointer array = snapshot->getAttributeMatrix(DataArrayPath("DC 0", "CellAttributeMatrix", ""))->getAttributeArray("Float Array");
+    DREAM3D_REQUIRE_VALID_POINTER(array)
+    DREAM3D_REQUIRE(array->getDataArrayPath() == DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array"))
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), 6000)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotConstAccess()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    DataContainerArray::Pointer snapshot = dca->createSnapshot();
+    const DataContainerArray& constSnapshot = *snapshot;
+
+    // Const access hands out private copies too, so a shared node can never be modified through the snapshot
+    DataContainer::ConstPointer dc = constSnapshot.getDataContainer("DC 0");
+    DREAM3D_REQUIRE(dc != dca->getDataContainer("DC 0"))
+    DREAM3D_REQUIRE(dc->getParentNode() == snapshot.get())
+    for(const auto& child : constSnapshot.getDataContainers())
+    {
+      DREAM3D_REQUIRE(child->getParentNode() == snapshot.get())
+    }
+
+    FloatArrayType::Pointer array = constSnapshot.getPrereqArrayFromPath<FloatArrayType>(nullptr, DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array"), {3});
+    DREAM3D_REQUIRE_VALID_POINTER(array)
+    array->resizeTuples(5);
+    DREAM3D_REQUIRE_EQUAL(dca->getAttributeMatrix(DataArrayPath("DC 0", "CellAttributeMatrix", ""))->getAttributeArray("Float Array")->getNumberOfTuples(), 6000)
+
+    // Deep copying the snapshot reads the shared nodes without detaching them
+    DataContainerArray::Pointer other = dca->createSnapshot();
+    DataContainerArray::Pointer copy = other->deepCopy(true);
+    DREAM3D_REQUIRE(copy->doesAttributeArrayExist(DataArrayPath("DC 1", "CellAttributeMatrix", "Int32 Array")))
+    for(const auto& child : dca->getDataContainers())
+    {
+      DREAM3D_REQUIRE(child->getParentNode() == dca.get())
+    }
+  }
+    DREAM3D_REQUIRE_VALID_POINTER(constSnapshot.getPrereqIDataArrayFromPath(nullptr, DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array")))
+    DREAM3D_REQUIRE(constSnapshot.getDataContainer("DC 0") == dca->getDataContainer("DC 0"))
+
+    // Non-const access only copies the node it hands out
+    DataContainer::Pointer privateDc = snapshot->getDataContainer("DC 0");
+    DREAM3D_REQUIRE(privateDc != dca->getDataContainer("DC 0"))
+    DREAM3D_REQUIRE(constSnapshot.getDataContainer("DC 1") == dca->getDataContainer("DC 1"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotPrivatePaths()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    DataContainerArray::Pointer snapshot = dca->createSnapshot();
+    DREAM3D_REQUIRE(snapshot->getPrivateDescendantPaths().empty())
+
+    // Only the nodes accessed through the snapshot are private, at the deepest level they were accessed
+    const DataContainerArray& constSnapshot = *snapshot;
+    DREAM3D_REQUIRE_VALID_POINTER(constSnapshot.getPrereqIDataArrayFromPath(nullptr, DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array")))
+    DREAM3D_REQUIRE_VALID_POINTER(snapshot->getDataContainer("DC 1"))
+    DataContainerArray::DataArrayPathList paths = snapshot->getPrivateDescendantPaths();
+    DREAM3D_REQUIRE_EQUAL(paths.size(), static_cast<size_t>(2))
+    DREAM3D_REQUIRE(paths.front() == DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array"))
+    DREAM3D_REQUIRE(paths.back() == DataArrayPath("DC 1", "", ""))
+    DREAM3D_REQUIRE(dca->createSnapshot()->getPrivateDescendantPaths().empty())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotIsolation()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray();
+    DataContainerArray::Pointer snapshot = dca->createSnapshot();
+
+    // Structural edits in the snapshot must not leak into the original
+    AttributeMatrix::Pointer am = snapshot->getAttributeMatrix(DataArrayPath("DC 0", "CellAttributeMatrix", ""));
+    am->removeAttributeArray("Float Array");
+    am->insertOrAssign(UInt8ArrayType::CreateArray(6000, QString("Mask"), false));
+    snapshot->getAttributeMatrix(DataArrayPath("DC 1", "CellAttributeMatrix", ""))->getAttributeArray("Int32 Array")->resizeTuples(5);
+    snapshot->renameDataContainer("DC 1", "Renamed");
+    snapshot->removeDataContainer("DC 0");
+
+    DREAM3D_REQUIRE_EQUAL(dca->getNumDataContainers(), 2)
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC 0", "CellAttributeMatrix", "Float Array")))
+    DREAM3D_REQUIRE(!dca->doesAttributeArrayExist(DataArrayPath("DC 0", "CellAttributeMatrix", "Mask")))
+    DREAM3D_REQUIRE(dca->doesDataContainerExist("DC 1"))
+    DREAM3D_REQUIRE_EQUAL(dca->getAttributeMatrix(DataArrayPath("DC 1", "CellAttributeMatrix", ""))->getAttributeArray("Int32 Array")->getNumberOfTuples(), 6000)
+
+    DREAM3D_REQUIRE_EQUAL(snapshot->getNumDataContainers(), 1)
+    DREAM3D_REQUIRE(snapshot->doesDataContainerExist("Renamed"))
+    DREAM3D_REQUIRE_EQUAL(snapshot->getAttributeMatrix(DataArrayPath("Renamed", "CellAttributeMatrix", ""))->getAttributeArray("Int32 Array")->getNumberOfTuples(), 5)
+
+    // Snapshots of snapshots keep working once the intermediate copy goes away
+    DataContainerArray::Pointer second = snapshot->createSnapshot();
+    snapshot = DataContainerArray::NullPointer();
+    DREAM3D_REQUIRE(second->doesAttributeArrayExist(DataArrayPath("Renamed", "CellAttributeMatrix", "Int32 Array")))
+    DREAM3D_REQUIRE_EQUAL(second->getDataContainer("Renamed")->getParentNode(), second.get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataContainerArrayTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestSnapshotStructure())
+    DREAM3D_REGISTER_TEST(TestSnapshotConstAccess())
+    DREAM3D_REGISTER_TEST(TestSnapshotPrivatePaths())
+    DREAM3D_REGISTER_TEST(TestSnapshotIsolation())
+  }
+
+private:
+  DataContainerArrayTest(const DataContainerArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const DataContainerArrayTest&);         // Move assignment Not Implemented
+};
@@ -52,6 +52,7 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/HDF5/H5GlobalLock.h"
 #include "SIMPLib/Messages/PipelineErrorMessage.h"
 
 // -----------------------------------------------------------------------------
@@ -192,6 +193,7 @@ FilterPipeline::Pointer H5FilterParametersReader::readPipelineFromFile(hid_t fid
 // -----------------------------------------------------------------------------
 FilterPipeline::Pointer H5FilterParametersReader::readPipelineFromFile(QString filePath, IObserver* obs)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   hid_t fid = -1;
   fid = QH5Utilities::openFile(filePath);
   if(fid < 0)
@@ -210,6 +212,7 @@ FilterPipeline::Pointer H5FilterParametersReader::readPipelineFromFile(QString f
 // -----------------------------------------------------------------------------
 QString H5FilterParametersReader::getJsonFromFile(QString filePath, IObserver* obs)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   hid_t fid = -1;
   fid = QH5Utilities::openFile(filePath);
   if(fid < 0)
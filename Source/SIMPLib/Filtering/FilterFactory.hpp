@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/IFilterFactory.hpp"
@@ -116,6 +118,8 @@ public:
 
   QString getFilterHtmlSummary() const override
   {
+    // Only the GUI shows the summary, so it is generated on first use instead of at registration
+    std::call_once(m_HtmlSummaryFlag, [this]() { m_HtmlSummary = T::New()->generateHtmlSummary(); });
     return m_HtmlSummary;
   }
 
@@ -124,6 +128,11 @@ public:
     return m_Uuid;
   }
 
+  QString getFilterVersion() const override
+  {
+    return m_FilterVersion;
+  }
+
 protected:
   FilterFactory()
   {
@@ -135,7 +144,7 @@ protected:
     m_BrandingString = w->getBrandingString();
     m_CompiledLibraryName = w->getCompiledLibraryName();
     m_Uuid = w->getUuid();
-    m_HtmlSummary = w->generateHtmlSummary();
+    m_FilterVersion = w->getFilterVersion();
   }
 
 private:
@@ -145,7 +154,9 @@ private:
   QString m_HumanName;
   QString m_BrandingString;
   QString m_CompiledLibraryName;
-  QString m_HtmlSummary;
+  QString m_FilterVersion;
+  mutable QString m_HtmlSummary;
+  mutable std::once_flag m_HtmlSummaryFlag;
   QUuid m_Uuid;
 
 public:
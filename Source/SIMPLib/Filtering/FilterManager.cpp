@@ -101,6 +101,7 @@ void FilterManager::RegisterKnownFilters(FilterManager* /* fm */)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories() const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   return m_Factories;
 }
 
@@ -109,6 +110,7 @@ FilterManager::Collection FilterManager::getFactories() const
 // -----------------------------------------------------------------------------
 void FilterManager::printFactoryNames() const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   QList<QString> keys = m_Factories.keys();
   for(const auto& key : keys)
   {
@@ -121,6 +123,7 @@ void FilterManager::printFactoryNames() const
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   FilterManager::Collection groupFactories;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -139,6 +142,7 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactoriesForPluginName(const QString& pluginName)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   FilterManager::Collection groupFactories;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -157,6 +161,7 @@ FilterManager::Collection FilterManager::getFactoriesForPluginName(const QString
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName, const QString& subGroupName)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   FilterManager::Collection groupFactories;
   for(FilterManager::Collection::iterator factoryIter = m_Factories.begin(); factoryIter != m_Factories.end(); ++factoryIter)
   {
@@ -172,6 +177,7 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName,
 // -----------------------------------------------------------------------------
 bool FilterManager::contains(const QUuid& uuid) const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   return m_UuidFactories.contains(uuid);
 }
 
@@ -180,6 +186,7 @@ bool FilterManager::contains(const QUuid& uuid) const
 // -----------------------------------------------------------------------------
 void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointer factory)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   // std::cout << this << " - Registering Filter: " << name.toStdString() << std::endl;
   QUuid uuid = factory->getUuid();
 
@@ -193,6 +200,12 @@ void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointe
     throw std::runtime_error("Attempted to add a filter with an empty name");
   }
 
+  // A plugin that was loaded on demand registers the factories its placeholders stood in for
+  if(m_UuidFactories.contains(uuid) && m_UuidFactories[uuid]->isPlaceholder() && m_UuidFactories[uuid]->getFilterClassName() == name)
+  {
+    removeFilterFactory(uuid);
+  }
+
   if(m_UuidFactories.contains(uuid))
   {
     IFilterFactory::Pointer existingFactory = m_UuidFactories[uuid];
@@ -211,6 +224,14 @@ void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointe
 
   m_Factories[name] = factory;
   m_UuidFactories[uuid] = factory;
+
+  // Several filters may share a human label. The lookup returns the one whose class name sorts first.
+  QString humanName = factory->getFilterHumanLabel();
+  auto humanNameIter = m_HumanNameFactories.find(humanName);
+  if(humanNameIter == m_HumanNameFactories.end() || name < humanNameIter.value()->getFilterClassName())
+  {
+    m_HumanNameFactories[humanName] = factory;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -283,11 +304,8 @@ QSet<QString> FilterManager::getSubGroupNames(const QString& groupName)
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& filterName) const
 {
-  if(m_Factories.contains(filterName))
-  {
-    return m_Factories[filterName];
-  }
-  return IFilterFactory::NullPointer();
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  return m_Factories.value(filterName, IFilterFactory::NullPointer());
 }
 
 // -----------------------------------------------------------------------------
@@ -295,11 +313,8 @@ IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& fi
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) const
 {
-  if(m_UuidFactories.contains(uuid))
-  {
-    return m_UuidFactories[uuid];
-  }
-  return IFilterFactory::NullPointer();
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  return m_UuidFactories.value(uuid, IFilterFactory::NullPointer());
 }
 
 // -----------------------------------------------------------------------------
@@ -307,18 +322,8 @@ IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) con
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromHumanName(const QString& humanName)
 {
-  IFilterFactory::Pointer Factory;
-
-  for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
-  {
-    IFilterFactory::Pointer filterFactory = factory.value();
-    if(nullptr != filterFactory.get() && filterFactory->getFilterHumanLabel().compare(humanName) == 0)
-    {
-      Factory = filterFactory;
-      break;
-    }
-  }
-  return Factory;
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  return m_HumanNameFactories.value(humanName, IFilterFactory::NullPointer());
 }
 
 // -----------------------------------------------------------------------------
@@ -329,18 +334,17 @@ QJsonArray FilterManager::toJsonArray() const
   QJsonArray filterArray;
 
   FilterManager::Collection factories = getFactories();
-  for(auto factory : factories)
+  for(const auto& factory : factories)
   {
-    AbstractFilter::Pointer filter = factory->create();
     QJsonObject filtJson;
 
-    filtJson[SIMPL::JSON::Name] = filter->getHumanLabel();
-    filtJson[SIMPL::JSON::ClassName] = filter->getNameOfClass();
-    filtJson[SIMPL::JSON::Uuid] = filter->getUuid().toString();
-    filtJson[SIMPL::JSON::PluginName] = filter->getCompiledLibraryName();
-    filtJson[SIMPL::JSON::Version] = filter->getFilterVersion();
-    filtJson[SIMPL::JSON::GroupName] = filter->getGroupName();
-    filtJson[SIMPL::JSON::SubGroupName] = filter->getSubGroupName();
+    filtJson[SIMPL::JSON::Name] = factory->getFilterHumanLabel();
+    filtJson[SIMPL::JSON::ClassName] = factory->getFilterClassName();
+    filtJson[SIMPL::JSON::Uuid] = factory->getUuid().toString();
+    filtJson[SIMPL::JSON::PluginName] = factory->getCompiledLibraryName();
+    filtJson[SIMPL::JSON::Version] = factory->getFilterVersion();
+    filtJson[SIMPL::JSON::GroupName] = factory->getFilterGroup();
+    filtJson[SIMPL::JSON::SubGroupName] = factory->getFilterSubGroup();
 
     filterArray.append(filtJson);
   }
@@ -362,15 +366,32 @@ QString FilterManager::ClassName()
 // -----------------------------------------------------------------------------
 bool FilterManager::removeFilterFactory(const QUuid& uuid)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   if(!m_UuidFactories.contains(uuid))
   {
     return false;
   }
 
-  QString filterName = m_UuidFactories[uuid]->getFilterClassName();
+  IFilterFactory::Pointer factory = m_UuidFactories[uuid];
+  QString filterName = factory->getFilterClassName();
 
   m_Factories.remove(filterName);
   m_UuidFactories.remove(uuid);
+
+  QString humanName = factory->getFilterHumanLabel();
+  if(m_HumanNameFactories.value(humanName) == factory)
+  {
+    m_HumanNameFactories.remove(humanName);
+    for(const auto& otherFactory : m_Factories)
+    {
+      if(otherFactory->getFilterHumanLabel() == humanName)
+      {
+        // m_Factories is sorted by class name, so this is the first match
+        m_HumanNameFactories[humanName] = otherFactory;
+        break;
+      }
+    }
+  }
 #ifdef SIMPL_EMBED_PYTHON
   m_PythonUuids.remove(uuid);
 #endif
@@ -382,12 +403,14 @@ bool FilterManager::removeFilterFactory(const QUuid& uuid)
 // -----------------------------------------------------------------------------
 QSet<QUuid> FilterManager::pythonFilterUuids() const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   return m_PythonUuids;
 }
 
 // -----------------------------------------------------------------------------
 void FilterManager::addPythonFilterFactory(const QString& name, IFilterFactory::Pointer factory)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   addFilterFactory(name, factory);
   m_PythonUuids.insert(factory->getUuid());
 }
@@ -395,6 +418,7 @@ void FilterManager::addPythonFilterFactory(const QString& name, IFilterFactory::
 // -----------------------------------------------------------------------------
 void FilterManager::clearPythonFilterFactories()
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   QSet<QUuid> pythonUuids = m_PythonUuids;
   for(const QUuid& uuid : pythonUuids)
   {
@@ -405,6 +429,7 @@ void FilterManager::clearPythonFilterFactories()
 // -----------------------------------------------------------------------------
 bool FilterManager::isPythonFilter(const QUuid& uuid) const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   return m_PythonUuids.contains(uuid);
 }
 #endif
@@ -35,6 +35,9 @@
 
 #pragma once
 
+#include <mutex>
+
+#include <QtCore/QHash>
 #include <QtCore/QJsonArray>
 #include <QtCore/QMap>
 #include <QtCore/QMapIterator>
@@ -52,6 +55,10 @@
  * @brief The FilterManager class manages instances of filters and is mainly used to instantiate
  * an instance of a filter given its human label or class name. This class uses the Factory design
  * pattern.
+ *
+ * Plugins that are loaded on demand register their factories from whichever thread first needs one of
+ * their filters, so every access to the registered factories is serialized by one lock and the getters
+ * return copies.
  */
 class SIMPLib_EXPORT FilterManager
 {
@@ -131,7 +138,8 @@ public:
   bool contains(const QUuid& uuid) const;
 
   /**
-   * @brief Adds a Factory that creates QFilters
+   * @brief Adds a Factory that creates QFilters. A placeholder factory with the same name and UUID
+   * is replaced by the new one.
    * @param name
    * @param factory
    */
@@ -180,7 +188,7 @@ public:
 
   /**
    * @brief This will return a QJsonArray object that contains information about
-   * all available filters
+   * all available filters. The information comes from the factories, no filter is instantiated.
    * @return
    */
   QJsonArray toJsonArray() const;
@@ -216,8 +224,10 @@ protected:
   FilterManager();
 
 private:
+  mutable std::recursive_mutex m_Mutex;
   Collection m_Factories;
   UuidCollection m_UuidFactories;
+  QHash<QString, IFilterFactory::Pointer> m_HumanNameFactories;
 
 #ifdef SIMPL_EMBED_PYTHON
   QSet<QUuid> m_PythonUuids;
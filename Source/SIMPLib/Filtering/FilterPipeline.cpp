@@ -35,17 +35,37 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+#include <thread>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMetaProperty>
 #include <QtCore/QTextStream>
 #include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+
+#include <hdf5.h>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
+#include "SIMPLib/CoreFilters/ImportHDF5Dataset.h"
+#include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/RenameDataPath.h"
+#include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiInputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
 #include "SIMPLib/Filtering/BadFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/IGeometry.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
@@ -55,6 +75,9 @@
 #include "SIMPLib/Messages/PipelineProgressMessage.h"
 #include "SIMPLib/Messages/PipelineStatusMessage.h"
 #include "SIMPLib/Messages/PipelineWarningMessage.h"
+#include "SIMPLib/Utilities/FilePathGenerator.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+#include "SIMPLib/Utilities/ProcessResourceUsage.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
 #define RENAME_ENABLED 1
@@ -367,6 +390,12 @@ void FilterPipeline::cancel()
   {
     m_CurrentFilter->setCancel(true);
   }
+
+  std::lock_guard<std::mutex> lock(m_RunningFiltersMutex);
+  for(const auto& filter : m_RunningFilters)
+  {
+    filter->setCancel(true);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -524,6 +553,7 @@ bool FilterPipeline::clear()
     filter->setNextFilter(AbstractFilter::NullPointer());
   }
   m_Pipeline.clear();
+  m_PreflightCache.clear();
   Q_EMIT pipelineWasEdited();
   return true;
 }
@@ -763,20 +793,52 @@ int FilterPipeline::preflightPipeline()
 
   clearErrorCode();
   int preflightError = 0;
+  m_PreflightCanceled = false;
 
   DataArrayPath::RenameContainer renamedPaths;
 
+  // Filters at the front of the pipeline that are unchanged since the last preflight, and whose
+  // upstream is unchanged, do not need to be checked again. Resume from the last structure cached
+  // for that prefix.
+  std::vector<PreflightCacheEntry> preflightCache;
+  preflightCache.reserve(m_Pipeline.size());
+  QByteArray cacheKey;
+  bool resumingFromCache = true;
+
   // Start looping through each filter in the Pipeline and preflight everything
   for(const auto& filter : m_Pipeline)
   {
+    if(m_PreflightCanceled)
+    {
+      preflightError = -209;
+      break;
+    }
+
+    if(resumingFromCache && preflightCache.size() < m_PreflightCache.size())
+    {
+      const PreflightCacheEntry& entry = m_PreflightCache[preflightCache.size()];
+      QByteArray filterKey = CreatePreflightCacheKey(filter, cacheKey);
+      if(entry.reusable && entry.key == filterKey && entry.filter.lock() == filter)
+      {
+        cacheKey = filterKey;
+        renamedPaths = entry.renamedPaths;
+        dca = entry.dca->createSnapshot();
+        preflightCache.push_back(entry);
+        continue;
+      }
+    }
+    resumingFromCache = false;
+    std::vector<DataArrayPath> accessedPaths;
+
     // Do not preflight disabled filters
     if(filter->getEnabled())
     {
-      filter->setDataContainerArray(dca->deepCopy(true));
 #if RENAME_ENABLED
       // Avoid renaming filters as soon as they are added to the pipeline
       if(filter->property("HasRenameValues").toBool())
       {
+        // The rename pass preflights the filter against a throw away copy-on-write snapshot
+        filter->setDataContainerArray(dca->createSnapshot());
         filter->renameDataArrayPaths(renamedPaths);
         RenameDataPath::CalculateRenamedPaths(filter, renamedPaths);
       }
@@ -789,12 +851,27 @@ int FilterPipeline::preflightPipeline()
       setCurrentFilter(filter);
       connectFilterNotifications(filter.get());
       filter->clearRenamedPaths();
+      setRunningFilters({filter});
       filter->preflight();
+      setRunningFilters({});
       disconnectFilterNotifications(filter.get());
 
+      // Everything the filter looked at through its snapshot was replaced with a private copy, so the
+      // private nodes record the data the filter accessed, whether or not its properties name it.
+      const DataContainerArray::DataArrayPathList privatePaths = dca->getPrivateDescendantPaths();
+      accessedPaths.assign(privatePaths.begin(), privatePaths.end());
+
       filter->setCancel(false); // Reset the cancel flag
+      if(m_PreflightCanceled)
+      {
+        // The structure of a canceled filter is incomplete and must not be cached
+        preflightError = -209;
+        break;
+      }
       preflightError |= filter->getErrorCode();
-      filter->setDataContainerArray(dca->deepCopy(false));
+      // The filter keeps the structure it produced. Downstream filters continue on a copy-on-write
+      // snapshot so only the nodes they touch get copied.
+      dca = dca->createSnapshot();
 #if RENAME_ENABLED
       // Check if an existing renamed path was deleted by this filter
       const std::list<DataArrayPath> deletedPaths = filter->getDeletedPaths();
@@ -836,7 +913,8 @@ int FilterPipeline::preflightPipeline()
     else
     {
       // Some widgets require the updated path to be valid before it can be set in the widget
-      filter->setDataContainerArray(dca->deepCopy(false));
+      filter->setDataContainerArray(dca);
+      dca = dca->createSnapshot();
       filter->renameDataArrayPaths(renamedPaths);
 
       // Undo filter renaming
@@ -850,12 +928,710 @@ int FilterPipeline::preflightPipeline()
       }
     }
 #endif
+
+    // Keep a frozen snapshot of the structure after this filter. Filters that reported issues are
+    // always checked again so their messages are sent to the message receivers on every preflight.
+    cacheKey = CreatePreflightCacheKey(filter, cacheKey);
+    PreflightCacheEntry entry;
+    entry.key = cacheKey;
+    entry.filter = filter;
+    entry.dca = dca;
+    entry.renamedPaths = renamedPaths;
+    entry.accessedPaths = accessedPaths;
+    entry.reusable = !filter->getEnabled() || (filter->getErrorCode() == 0 && filter->getWarningCode() == 0);
+    preflightCache.push_back(entry);
+    dca = dca->createSnapshot();
   }
   setCurrentFilter(AbstractFilter::NullPointer());
 
+  m_PreflightCache = std::move(preflightCache);
+
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::clearPreflightCache()
+{
+  m_PreflightCache.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::cancelPreflight()
+{
+  m_PreflightCanceled = true;
+
+  std::lock_guard<std::mutex> lock(m_RunningFiltersMutex);
+  for(const auto& filter : m_RunningFilters)
+  {
+    filter->setCancel(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setReleaseUnusedArrays(bool value)
+{
+  m_ReleaseUnusedArrays = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getReleaseUnusedArrays() const
+{
+  return m_ReleaseUnusedArrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setExecuteConcurrently(bool value)
+{
+  m_ExecuteConcurrently = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getExecuteConcurrently() const
+{
+  return m_ExecuteConcurrently;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setMaxConcurrentFilters(int value)
+{
+  m_MaxConcurrentFilters = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::getMaxConcurrentFilters() const
+{
+  return m_MaxConcurrentFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setProfilingEnabled(bool value)
+{
+  m_ProfilingEnabled = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getProfilingEnabled() const
+{
+  return m_ProfilingEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::CheckDeferredLoadErrors(const AbstractFilter::Pointer& filter)
+{
+  DataContainerArray::ConstPointer dca = filter->getDataContainerArray();
+  if(nullptr == dca || filter->getErrorCode() < 0)
+  {
+    return;
+  }
+  for(const auto& dc : dca->getDataContainers())
+  {
+    DataContainer::ConstPointer constDc = dc;
+    for(const auto& am : constDc->getAttributeMatrices())
+    {
+      AttributeMatrix::ConstPointer constAm = am;
+      for(const auto& array : *constAm)
+      {
+        int32_t err = array->getDeferredLoadError();
+        if(err < 0)
+        {
+          DataArrayPath path(dc->getName(), am->getName(), array->getName());
+          QString ss = QObject::tr("The values of the array '%1' could not be loaded from the file they were read from").arg(path.serialize("/"));
+          filter->setErrorCondition(err, ss);
+          return;
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::Pointer FilterPipeline::executeFilter(const AbstractFilter::Pointer& filter, int threadIndex, bool concurrent) const
+{
+  if(!m_ProfilingEnabled)
+  {
+    filter->execute();
+    CheckDeferredLoadErrors(filter);
+    return PipelineProfileMessage::NullPointer();
+  }
+
+  ProcessResourceUsage before;
+  quint64 threadCpuTimeBefore = 0;
+  if(concurrent)
+  {
+    threadCpuTimeBefore = ProcessResourceUsage::SampleThreadCpuTime();
+  }
+  else
+  {
+    before = ProcessResourceUsage::Sample();
+  }
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  filter->execute();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  // Every counter only grows, so the differences are what was used while the filter executed. The process
+  // counters include every thread, so while other filters may execute at the same time only the CPU time of
+  // the executing thread belongs to this filter and the process wide counters are left at zero.
+  ProcessResourceUsage used;
+  if(concurrent)
+  {
+    used.cpuTime = ProcessResourceUsage::SampleThreadCpuTime() - threadCpuTimeBefore;
+  }
+  else
+  {
+    // The peak resident size is the high-water mark of the whole process: its difference is only how far
+    // the process peak rose during the filter, not the memory the filter used.
+    ProcessResourceUsage after = ProcessResourceUsage::Sample();
+    used.cpuTime = after.cpuTime - before.cpuTime;
+    used.peakResidentBytes = after.peakResidentBytes - before.peakResidentBytes;
+    used.bytesRead = after.bytesRead - before.bytesRead;
+    used.bytesWritten = after.bytesWritten - before.bytesWritten;
+    used.bytesAllocated = after.bytesAllocated - before.bytesAllocated;
+  }
+  CheckDeferredLoadErrors(filter);
+
+  PipelineProfileMessage::Pointer profile = PipelineProfileMessage::New(getName(), filter->getHumanLabel(), filter->getPipelineIndex());
+  profile->setFilterClassName(filter->getNameOfClass());
+  profile->setThreadIndex(threadIndex);
+  profile->setExecutedConcurrently(concurrent);
+  profile->setStartTime(static_cast<quint64>(std::chrono::duration_cast<std::chrono::microseconds>(start - m_ExecutionStart).count()));
+  profile->setWallTime(static_cast<quint64>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+  profile->setResourceUsage(used);
+  return profile;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::FilterDataReferences FilterPipeline::GetFilterDataReferences(const AbstractFilter::Pointer& filter, const std::vector<DataArrayPath>& accessedPaths,
+                                                                             const DataContainerArrayShPtrType& structure)
+{
+  FilterDataReferences references;
+  references.enabled = filter->getEnabled();
+  if(!references.enabled)
+  {
+    return references;
+  }
+
+  const QMetaObject* metaObject = filter->metaObject();
+  for(int i = 0; i < metaObject->propertyCount(); i++)
+  {
+    QVariant value = metaObject->property(i).read(filter.get());
+    if(value.userType() == qMetaTypeId<DataArrayPath>())
+    {
+      references.paths.push_back(value.value<DataArrayPath>());
+    }
+    else if(value.userType() == qMetaTypeId<DataArrayPathVec>())
+    {
+      DataArrayPathVec paths = value.value<DataArrayPathVec>();
+      references.paths.insert(references.paths.end(), paths.begin(), paths.end());
+    }
+  }
+
+  // The writer names no inputs but only writes what exists when it runs, which is its preflight structure.
+  // Empty AttributeMatrices and DataContainers are named themselves so they are still locked while it runs.
+  if(references.paths.empty() && nullptr != std::dynamic_pointer_cast<DataContainerWriter>(filter) && nullptr != structure)
+  {
+    for(const auto& dc : structure->getDataContainers())
+    {
+      if(dc->getAttributeMatrices().empty())
+      {
+        references.paths.push_back(DataArrayPath(dc->getName(), "", ""));
+      }
+      for(const auto& am : dc->getAttributeMatrices())
+      {
+        const auto arrayNames = am->getAttributeArrayNames();
+        if(arrayNames.empty())
+        {
+          references.paths.push_back(DataArrayPath(dc->getName(), am->getName(), ""));
+        }
+        for(const auto& arrayName : arrayNames)
+        {
+          references.paths.push_back(DataArrayPath(dc->getName(), am->getName(), arrayName));
+        }
+      }
+    }
+    return references;
+  }
+
+  // Filters that do not name their inputs may touch anything
+  references.referencesEverything = references.paths.empty();
+
+  // Filters may also look up data their properties do not name, such as every array of a selected
+  // AttributeMatrix or arrays found by a fixed name
+  references.paths.insert(references.paths.end(), accessedPaths.begin(), accessedPaths.end());
+  return references;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::releaseUnusedArrays(const std::vector<FilterDataReferences>& references, int filterIndex)
+{
+  std::vector<DataArrayPath> laterPaths;
+  bool laterFilterEnabled = false;
+  for(size_t i = filterIndex + 1; i < references.size(); i++)
+  {
+    if(references[i].referencesEverything)
+    {
+      return;
+    }
+    laterFilterEnabled = laterFilterEnabled || references[i].enabled;
+    laterPaths.insert(laterPaths.end(), references[i].paths.begin(), references[i].paths.end());
+  }
+  if(!laterFilterEnabled)
+  {
+    return;
+  }
+
+  auto isReferenced = [&laterPaths](const DataArrayPath& arrayPath) {
+    for(const auto& path : laterPaths)
+    {
+      if(path.getDataContainerName() != arrayPath.getDataContainerName())
+      {
+        continue;
+      }
+      if(path.getAttributeMatrixName().isEmpty() || (path.getAttributeMatrixName() == arrayPath.getAttributeMatrixName() &&
+                                                     (path.getDataArrayName().isEmpty() || path.getDataArrayName() == arrayPath.getDataArrayName())))
+      {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  size_t numReleased = 0;
+  size_t bytesReleased = 0;
+  for(const auto& dc : m_Dca->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& arrayName : am->getAttributeArrayNames())
+      {
+        if(isReferenced(DataArrayPath(dc->getName(), am->getName(), arrayName)))
+        {
+          continue;
+        }
+        IDataArray::Pointer array = am->removeAttributeArray(arrayName);
+        if(nullptr != array && !array->hasDeferredLoader())
+        {
+          bytesReleased += array->getSize() * array->getTypeSize();
+        }
+        numReleased++;
+      }
+    }
+  }
+
+  if(numReleased > 0)
+  {
+    QString ss = QObject::tr("Released %1 arrays (%2 MB) that no later filter uses").arg(numReleased).arg(static_cast<double>(bytesReleased) / (1024.0 * 1024.0), 0, 'f', 1);
+    notifyStatusMessage(ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<FilterPipeline::FilterExecutionLocks> FilterPipeline::createExecutionLocks(const std::vector<FilterDataReferences>& references)
+{
+  // Unstructured geometries build their connectivity and neighbor lists the first time a filter asks for
+  // them, so two filters working on different AttributeMatrices of such a DataContainer still share state.
+  std::set<QString> topologyOnDemand;
+  for(const auto& entry : m_PreflightCache)
+  {
+    for(const auto& dc : entry.dca->getDataContainers())
+    {
+      IGeometry::Pointer geom = dc->getGeometry();
+      if(nullptr != geom && geom->getGeometryType() != IGeometry::Type::Image && geom->getGeometryType() != IGeometry::Type::RectGrid)
+      {
+        topologyOnDemand.insert(dc->getName());
+      }
+    }
+  }
+
+  std::vector<FilterExecutionLocks> locks(references.size());
+  int filterIndex = 0;
+  for(const auto& filter : m_Pipeline)
+  {
+    const FilterDataReferences& filterReferences = references[filterIndex];
+    FilterExecutionLocks& filterLocks = locks[filterIndex];
+    filterIndex++;
+    if(!filterReferences.enabled)
+    {
+      continue;
+    }
+    if(filterReferences.referencesEverything)
+    {
+      filterLocks.everything = true;
+      continue;
+    }
+#ifndef H5_HAVE_THREADSAFE
+    // Only the filters of SIMPLib are known to take H5GlobalLock around their HDF5 calls. A plugin filter
+    // may call HDF5 directly, which is not safe next to any other filter with this build of HDF5.
+    if(filter->getCompiledLibraryName() != Core::CoreBaseName)
+    {
+      filterLocks.everything = true;
+      continue;
+    }
+#endif
+
+    // Adding, removing or renaming a node changes the container that holds it, so those paths lock one level higher
+    auto addPath = [&](const DataArrayPath& path, bool changesParent) {
+      const QString dcName = path.getDataContainerName();
+      if(dcName.isEmpty())
+      {
+        return;
+      }
+      if(path.getAttributeMatrixName().isEmpty())
+      {
+        if(changesParent)
+        {
+          filterLocks.everything = true;
+        }
+        else
+        {
+          filterLocks.dataContainers.insert(dcName);
+        }
+      }
+      else if((changesParent && path.getDataArrayName().isEmpty()) || topologyOnDemand.count(dcName) > 0)
+      {
+        filterLocks.dataContainers.insert(dcName);
+      }
+      else
+      {
+        filterLocks.attributeMatrices.insert(std::make_pair(dcName, path.getAttributeMatrixName()));
+      }
+    };
+
+    for(const auto& path : filterReferences.paths)
+    {
+      addPath(path, false);
+    }
+    for(const auto& path : filter->getCreatedPaths())
+    {
+      addPath(path, true);
+    }
+    for(const auto& path : filter->getDeletedPaths())
+    {
+      addPath(path, true);
+    }
+    for(const auto& rename : filter->getRenamedPaths())
+    {
+      addPath(rename.first, true);
+      addPath(rename.second, true);
+    }
+  }
+
+  return locks;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::LocksConflict(const FilterExecutionLocks& first, const FilterExecutionLocks& second)
+{
+  if(first.everything || second.everything)
+  {
+    return true;
+  }
+
+  for(const auto& dcName : first.dataContainers)
+  {
+    if(second.dataContainers.count(dcName) > 0)
+    {
+      return true;
+    }
+    for(const auto& amName : second.attributeMatrices)
+    {
+      if(amName.first == dcName)
+      {
+        return true;
+      }
+    }
+  }
+  for(const auto& amName : first.attributeMatrices)
+  {
+    if(second.dataContainers.count(amName.first) > 0 || second.attributeMatrices.count(amName) > 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setRunningFilters(const std::vector<AbstractFilter::Pointer>& filters)
+{
+  std::lock_guard<std::mutex> lock(m_RunningFiltersMutex);
+  m_RunningFilters = filters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::executeFiltersConcurrently(const std::vector<FilterDataReferences>& references, const std::vector<FilterExecutionLocks>& locks)
+{
+  const std::vector<AbstractFilter::Pointer> filters(m_Pipeline.begin(), m_Pipeline.end());
+  const size_t numFilters = filters.size();
+
+  // Every filter depends on the earlier filters it conflicts with. Disabled filters have nothing to run.
+  std::vector<std::vector<size_t>> dependencies(numFilters);
+  std::vector<bool> executed(numFilters, false);
+  for(size_t i = 0; i < numFilters; i++)
+  {
+    executed[i] = !references[i].enabled;
+    for(size_t j = 0; j < i && references[i].enabled; j++)
+    {
+      if(references[j].enabled && LocksConflict(locks[i], locks[j]))
+      {
+        dependencies[i].push_back(j);
+      }
+    }
+  }
+
+  std::vector<std::vector<AbstractMessage::Pointer>> filterMessages(numFilters);
+  std::vector<PipelineProfileMessage::Pointer> filterProfiles(numFilters);
+
+  ParallelTaskAlgorithm taskAlg;
+  taskAlg.setMaxThreads(m_MaxConcurrentFilters > 0 ? static_cast<uint32_t>(m_MaxConcurrentFilters) : std::thread::hardware_concurrency());
+
+  size_t nextToReport = 0;
+  while(nextToReport < numFilters)
+  {
+    // The filter at nextToReport always belongs to the wave because everything before it has been reported
+    std::vector<size_t> wave;
+    for(size_t i = nextToReport; i < numFilters; i++)
+    {
+      if(executed[i])
+      {
+        continue;
+      }
+      bool ready = true;
+      for(const auto& dependency : dependencies[i])
+      {
+        ready = ready && executed[dependency];
+      }
+      if(ready)
+      {
+        wave.push_back(i);
+      }
+    }
+
+    std::vector<AbstractFilter::Pointer> waveFilters;
+    std::vector<QMetaObject::Connection> connections;
+    for(const auto& index : wave)
+    {
+      const AbstractFilter::Pointer& filt = filters[index];
+      std::vector<AbstractMessage::Pointer>& messages = filterMessages[index];
+      connections.push_back(connect(filt.get(), &AbstractFilter::messageGenerated, [&messages](const AbstractMessage::Pointer& msg) { messages.push_back(msg); }));
+      filt->setDataContainerArray(m_Dca);
+      waveFilters.push_back(filt);
+    }
+    if(!wave.empty())
+    {
+      setCurrentFilter(filters[wave.front()]);
+    }
+    setRunningFilters(waveFilters);
+
+    const int maxThreads = static_cast<int>(std::max(taskAlg.getMaxThreads(), 1U));
+    for(size_t i = 0; i < wave.size(); i++)
+    {
+      const AbstractFilter::Pointer filt = waveFilters[i];
+      PipelineProfileMessage::Pointer& profile = filterProfiles[wave[i]];
+      const int threadIndex = static_cast<int>(i) % maxThreads;
+      taskAlg.execute([this, filt, &profile, threadIndex]() { profile = executeFilter(filt, threadIndex, true); });
+    }
+    taskAlg.wait();
+
+    setRunningFilters({});
+    setCurrentFilter(AbstractFilter::NullPointer());
+    for(const auto& connection : connections)
+    {
+      disconnect(connection);
+    }
+    for(const auto& index : wave)
+    {
+      filters[index]->setDataContainerArray(DataContainerArray::NullPointer());
+      executed[index] = true;
+    }
+
+    if(m_State == FilterPipeline::State::Canceling)
+    {
+      // Clear cancel filter state
+      for(const auto& filt : waveFilters)
+      {
+        filt->setCancel(false);
+      }
+      return true;
+    }
+
+    // Send the messages of every finished filter that has no unfinished filter before it
+    while(nextToReport < numFilters && executed[nextToReport])
+    {
+      const AbstractFilter::Pointer& filt = filters[nextToReport];
+      int filtIndex = filt->getPipelineIndex();
+      QString ss = QObject::tr("[%4] [%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel()).arg(::CreateDateTimeStamp());
+      notifyStatusMessage(ss);
+
+      Q_EMIT filt->filterInProgress(filt.get());
+
+      if(filt->getEnabled())
+      {
+        connectFilterNotifications(filt.get());
+        for(const auto& msg : filterMessages[nextToReport])
+        {
+          Q_EMIT filt->messageGenerated(msg);
+        }
+        disconnectFilterNotifications(filt.get());
+        filterMessages[nextToReport].clear();
+        if(nullptr != filterProfiles[nextToReport])
+        {
+          Q_EMIT messageGenerated(filterProfiles[nextToReport]);
+        }
+
+        int err = filt->getErrorCode();
+        if(err < 0)
+        {
+          ss = QObject::tr("[%4] [%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel().arg(::CreateDateTimeStamp()));
+          setErrorCondition(err, ss);
+
+          notifyProgressMessage(100, "");
+
+          Q_EMIT filt->filterCompleted(filt.get());
+          Q_EMIT pipelineFinished();
+          disconnectSignalsSlots();
+          m_State = FilterPipeline::State::Idle;
+          m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+          return false;
+        }
+      }
+
+      if(m_ReleaseUnusedArrays)
+      {
+        releaseUnusedArrays(references, static_cast<int>(nextToReport));
+      }
+
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      Q_EMIT filt->filterCompleted(filt.get());
+
+      notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+      nextToReport++;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray FilterPipeline::CreatePreflightCacheKey(const AbstractFilter::Pointer& filter, const QByteArray& previousKey)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(previousKey);
+  hash.addData(QJsonDocument(filter->toJson()).toJson(QJsonDocument::Compact));
+
+  // Reader filters produce the structure stored in their input files, so an entry must not be
+  // reused once one of those files changed on disk
+  QStringList inputPaths;
+  const FilterParameterVectorType parameters = filter->getFilterParameters();
+  for(const auto& parameter : parameters)
+  {
+    if(auto inputFile = std::dynamic_pointer_cast<InputFileFilterParameter>(parameter))
+    {
+      if(inputFile->getGetterCallback())
+      {
+        inputPaths.push_back(inputFile->getGetterCallback()());
+      }
+    }
+    else if(auto inputPath = std::dynamic_pointer_cast<InputPathFilterParameter>(parameter))
+    {
+      if(inputPath->getGetterCallback())
+      {
+        inputPaths.push_back(inputPath->getGetterCallback()());
+      }
+    }
+    else if(auto multiInputFile = std::dynamic_pointer_cast<MultiInputFileFilterParameter>(parameter))
+    {
+      if(multiInputFile->getGetterCallback())
+      {
+        for(const auto& path : multiInputFile->getGetterCallback()())
+        {
+          inputPaths.push_back(QString::fromStdString(path));
+        }
+      }
+    }
+    else if(auto readerParameter = std::dynamic_pointer_cast<DataContainerReaderFilterParameter>(parameter))
+    {
+      inputPaths.push_back(filter->property(readerParameter->getInputFileProperty().toLatin1().constData()).toString());
+    }
+    else if(auto asciiParameter = std::dynamic_pointer_cast<ReadASCIIDataFilterParameter>(parameter))
+    {
+      inputPaths.push_back(filter->property(asciiParameter->getPropertyName().toLatin1().constData()).value<ASCIIWizardData>().inputFilePath);
+    }
+    else if(auto datasetParameter = std::dynamic_pointer_cast<ImportHDF5DatasetFilterParameter>(parameter))
+    {
+      if(nullptr != datasetParameter->getFilter())
+      {
+        inputPaths.push_back(datasetParameter->getFilter()->getHDF5FilePath());
+      }
+    }
+    else if(auto fileListParameter = std::dynamic_pointer_cast<FileListInfoFilterParameter>(parameter))
+    {
+      // Every file of the stack, so the entry is not reused once any slice changed
+      StackFileListInfo info = fileListParameter->getGetterCallback() ? fileListParameter->getGetterCallback()() : StackFileListInfo();
+      if(info.IncrementIndex > 0)
+      {
+        bool hasMissingFiles = false;
+        QVector<QString> fileList = FilePathGenerator::GenerateFileList(info.StartIndex, info.EndIndex, info.IncrementIndex, hasMissingFiles, true, info.InputPath, info.FilePrefix, info.FileSuffix,
+                                                                        info.FileExtension, info.PaddingDigits);
+        for(const auto& path : fileList)
+        {
+          inputPaths.push_back(path);
+        }
+      }
+    }
+  }
+
+  for(const auto& inputPath : inputPaths)
+  {
+    QFileInfo fi(inputPath);
+    hash.addData(inputPath.toUtf8());
+    if(fi.exists())
+    {
+      hash.addData(QByteArray::number(fi.size()));
+      hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+    }
+  }
+
+  return hash.result();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -881,6 +1657,30 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
   int err = 0;
 
+  // The concurrent schedule and the released arrays are built from what the filters accessed, created,
+  // deleted and renamed during preflight. A pipeline that does not preflight cleanly runs serially,
+  // keeps all of its arrays and reports its errors there.
+  bool preflighted = (m_ExecuteConcurrently || m_ReleaseUnusedArrays) && preflightPipeline() >= 0;
+  bool executeConcurrently = m_ExecuteConcurrently && preflighted;
+  bool releaseArrays = m_ReleaseUnusedArrays && preflighted;
+  std::vector<FilterDataReferences> dataReferences;
+  if(preflighted)
+  {
+    for(int i = 0; i < m_Pipeline.size(); i++)
+    {
+      dataReferences.push_back(GetFilterDataReferences(m_Pipeline[i], m_PreflightCache[i].accessedPaths, m_PreflightCache[i].dca));
+    }
+  }
+  std::vector<FilterExecutionLocks> executionLocks;
+  if(executeConcurrently)
+  {
+    executionLocks = createExecutionLocks(dataReferences);
+  }
+
+  // Executing replaces the DataContainerArray of every filter, so the cached preflight structures
+  // no longer match what the filters hold.
+  m_PreflightCache.clear();
+
   connectSignalsSlots();
 
   m_ExecutionResult = FilterPipeline::ExecutionResult::Invalid;
@@ -888,60 +1688,82 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   m_State = FilterPipeline::State::Executing;
 
   m_Dca = dca;
+  m_ExecutionStart = std::chrono::steady_clock::now();
 
   QDateTime now = QDateTime::currentDateTime();
   QString msg;
   QTextStream out(&msg);
   out << "Pipeline Start: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
-  // Start looping through the Pipeline
-  for(const auto& filt : m_Pipeline)
+
+  if(executeConcurrently)
   {
-    int filtIndex = filt->getPipelineIndex();
-    QString ss = QObject::tr("[%4] [%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel()).arg(::CreateDateTimeStamp());
-    notifyStatusMessage(ss);
+    if(!executeFiltersConcurrently(dataReferences, executionLocks))
+    {
+      return m_Dca;
+    }
+  }
+  else
+  {
+    // Start looping through the Pipeline
+    int pipelineIndex = 0;
+    for(const auto& filt : m_Pipeline)
+    {
+      int filtIndex = filt->getPipelineIndex();
+      QString ss = QObject::tr("[%4] [%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel()).arg(::CreateDateTimeStamp());
+      notifyStatusMessage(ss);
 
-    Q_EMIT filt->filterInProgress(filt.get());
+      Q_EMIT filt->filterInProgress(filt.get());
 
-    // Do not execute disabled filters
-    if(filt->getEnabled())
-    {
-      //      filt->setMessagePrefix(ss);
-      connectFilterNotifications(filt.get());
-      filt->setDataContainerArray(m_Dca);
-      setCurrentFilter(filt);
-      filt->execute();
-      disconnectFilterNotifications(filt.get());
-      filt->setDataContainerArray(DataContainerArray::NullPointer());
-      err = filt->getErrorCode();
-      if(err < 0)
+      // Do not execute disabled filters
+      if(filt->getEnabled())
       {
-        ss = QObject::tr("[%4] [%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel().arg(::CreateDateTimeStamp()));
-        setErrorCondition(err, ss);
+        //      filt->setMessagePrefix(ss);
+        connectFilterNotifications(filt.get());
+        filt->setDataContainerArray(m_Dca);
+        setCurrentFilter(filt);
+        PipelineProfileMessage::Pointer profile = executeFilter(filt, 0, false);
+        disconnectFilterNotifications(filt.get());
+        filt->setDataContainerArray(DataContainerArray::NullPointer());
+        if(nullptr != profile)
+        {
+          Q_EMIT messageGenerated(profile);
+        }
+        err = filt->getErrorCode();
+        if(err < 0)
+        {
+          ss = QObject::tr("[%4] [%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel().arg(::CreateDateTimeStamp()));
+          setErrorCondition(err, ss);
 
-        notifyProgressMessage(100, "");
+          notifyProgressMessage(100, "");
 
-        Q_EMIT filt->filterCompleted(filt.get());
-        Q_EMIT pipelineFinished();
-        disconnectSignalsSlots();
-        m_State = FilterPipeline::State::Idle;
-        m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
-        return m_Dca;
+          Q_EMIT filt->filterCompleted(filt.get());
+          Q_EMIT pipelineFinished();
+          disconnectSignalsSlots();
+          m_State = FilterPipeline::State::Idle;
+          m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+          return m_Dca;
+        }
       }
-      
-    }
 
-    if(m_State == FilterPipeline::State::Canceling)
-    {
-      // Clear cancel filter state
-      filt->setCancel(false);
-      break;
-    }
+      if(m_State == FilterPipeline::State::Canceling)
+      {
+        // Clear cancel filter state
+        filt->setCancel(false);
+        break;
+      }
+
+      if(releaseArrays)
+      {
+        releaseUnusedArrays(dataReferences, pipelineIndex);
+      }
+      pipelineIndex++;
 
-    // Emit that the filter is completed for those objects that care, even the disabled ones.
-    Q_EMIT filt->filterCompleted(filt.get());
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      Q_EMIT filt->filterCompleted(filt.get());
 
-    notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+      notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+    }
   }
   now = QDateTime::currentDateTime();
   msg.clear();
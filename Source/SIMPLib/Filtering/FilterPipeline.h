@@ -35,8 +35,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
 
+#include <QtCore/QByteArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QObject>
@@ -46,6 +53,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Messages/PipelineProfileMessage.h"
 
 class IObserver;
 class FilterPipelineMessageHandler;
@@ -200,6 +208,91 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief Discards the structures cached by previous preflights so the next call to
+   * preflightPipeline() re-checks every filter. Call this when something outside of the
+   * filter parameters, such as a file on disk, may have changed.
+   */
+  void clearPreflightCache();
+
+  /**
+   * @brief Stops a preflightPipeline() that is running on another thread. The filter being checked
+   * is asked to cancel, no further filters are checked and preflightPipeline() returns -209. The
+   * structures cached for the filters that finished before the cancel are kept.
+   */
+  void cancelPreflight();
+
+  /**
+   * @brief When enabled, execute() removes every attribute array from the DataContainerArray as soon as
+   * no later enabled filter references it. The pipeline is preflighted first; a filter references the data
+   * named by its DataArrayPath properties and the data it accessed during that preflight. A path to a
+   * DataContainer or AttributeMatrix keeps everything below it alive and a filter without any DataArrayPath
+   * property, such as DataContainerWriter, keeps everything alive. Nothing is released if the pipeline does
+   * not preflight cleanly. Disabled by default because the DataContainerArray returned by execute() then
+   * only holds the arrays referenced by the last filters of the pipeline.
+   * @param value
+   */
+  void setReleaseUnusedArrays(bool value);
+
+  /**
+   * @brief Returns true if execute() removes arrays after their last use
+   * @return
+   */
+  bool getReleaseUnusedArrays() const;
+
+  /**
+   * @brief When enabled, execute() runs filters that do not touch the same data at the same time. The
+   * pipeline is preflighted first and every filter is ordered after each earlier filter it shares data with.
+   * A filter shares the data named by its DataArrayPath properties and the data it accessed during that
+   * preflight, so a filter must not execute on data its preflight did not touch. Filters that change the
+   * structure above the data they name, such as creating a DataContainer, or that do not name their data
+   * at all wait for everything before them and block everything after them. The messages of every filter
+   * are held back and sent in pipeline order once the filter and all filters before it have finished, so
+   * observers see the same sequence as a serial execution.
+   *
+   * HDF5 is only safe to call from several threads when every caller takes H5GlobalLock. The filters of
+   * SIMPLib do; filters from plugins may call HDF5 directly, so unless the HDF5 library was built thread
+   * safe they wait for everything before them and block everything after them as well.
+   * @param value
+   */
+  void setExecuteConcurrently(bool value);
+
+  /**
+   * @brief Returns true if execute() runs independent filters at the same time
+   * @return
+   */
+  bool getExecuteConcurrently() const;
+
+  /**
+   * @brief Sets the maximum number of filters execute() runs at the same time when executing concurrently.
+   * A value of zero uses the number of hardware threads.
+   * @param value
+   */
+  void setMaxConcurrentFilters(int value);
+
+  /**
+   * @brief Returns the maximum number of filters that run at the same time
+   * @return
+   */
+  int getMaxConcurrentFilters() const;
+
+  /**
+   * @brief When enabled, execute() measures the wall time, CPU time, peak resident size, array allocations
+   * and file I/O of every filter it runs and sends them as a PipelineProfileMessage once the filter finishes.
+   * When the filters execute one after another the CPU time, peak resident size, allocation and I/O counters
+   * are differences of the process wide counters. When they execute concurrently only the CPU time of the
+   * thread that ran the filter is measured; the process wide counters are left at zero and the message is
+   * marked as executed concurrently.
+   * @param value
+   */
+  void setProfilingEnabled(bool value);
+
+  /**
+   * @brief Returns true if execute() sends a PipelineProfileMessage for every filter
+   * @return
+   */
+  bool getProfilingEnabled() const;
+
   /**
    * @brief
    */
@@ -367,12 +460,137 @@ private:
 
   DataContainerArrayShPtrType m_Dca;
 
+  /**
+   * @brief Structure produced by a single filter during the last preflight. The key
+   * chains the hash of the filter's JSON with the key of the previous entry, so a
+   * matching key means neither the filter nor anything upstream of it has changed.
+   */
+  struct PreflightCacheEntry
+  {
+    QByteArray key;
+    std::weak_ptr<AbstractFilter> filter;
+    DataContainerArrayShPtrType dca;
+    DataArrayPath::RenameContainer renamedPaths;
+    std::vector<DataArrayPath> accessedPaths;
+    bool reusable = false;
+  };
+  std::vector<PreflightCacheEntry> m_PreflightCache;
+  std::atomic_bool m_PreflightCanceled = {false};
+
+  /**
+   * @brief The data a filter may touch when it executes
+   */
+  struct FilterDataReferences
+  {
+    std::vector<DataArrayPath> paths;
+    bool enabled = false;
+    bool referencesEverything = false;
+  };
+  bool m_ReleaseUnusedArrays = false;
+
+  /**
+   * @brief The parts of the DataContainerArray a filter needs to itself while it executes. Locking a
+   * DataContainer also covers all of its AttributeMatrices.
+   */
+  struct FilterExecutionLocks
+  {
+    std::set<QString> dataContainers;
+    std::set<std::pair<QString, QString>> attributeMatrices;
+    bool everything = false;
+  };
+  bool m_ExecuteConcurrently = false;
+  int m_MaxConcurrentFilters = 0;
+  std::vector<AbstractFilter::Pointer> m_RunningFilters;
+  std::mutex m_RunningFiltersMutex;
+
+  bool m_ProfilingEnabled = false;
+  std::chrono::steady_clock::time_point m_ExecutionStart;
+
   int m_ErrorCode = 0;
   int m_WarningCode = 0;
 
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Computes the preflight cache key for the filter given the key of the entry before it. The key covers
+   * the filter parameters and the size and modification time of every input file or directory of the filter,
+   * including the files named by the ASCII import wizard data, the HDF5 dataset import and file list parameters.
+   * @param filter
+   * @param previousKey
+   * @return
+   */
+  static QByteArray CreatePreflightCacheKey(const AbstractFilter::Pointer& filter, const QByteArray& previousKey);
+
+  /**
+   * @brief Collects the values of the DataArrayPath properties of the filter and the paths it accessed
+   * during the last preflight. A DataContainerWriter references the arrays of the structure it writes.
+   * @param filter
+   * @param accessedPaths
+   * @param structure The preflight structure after the filter
+   * @return
+   */
+  static FilterDataReferences GetFilterDataReferences(const AbstractFilter::Pointer& filter, const std::vector<DataArrayPath>& accessedPaths, const DataContainerArrayShPtrType& structure);
+
+  /**
+   * @brief Removes the arrays that none of the filters after filterIndex references. Nothing is removed
+   * after the last enabled filter; whatever is left is the result of the pipeline.
+   * @param references The references of every filter in the pipeline
+   * @param filterIndex The index of the filter that just executed
+   */
+  void releaseUnusedArrays(const std::vector<FilterDataReferences>& references, int filterIndex);
+
+  /**
+   * @brief Determines what each filter has to lock from its data references and the paths it created,
+   * deleted or renamed during the last preflight. DataContainers whose geometry builds its
+   * topology on demand are locked as a whole by every filter that touches them. Filters from plugins
+   * lock everything unless HDF5 was built thread safe.
+   * @param references The references of every filter in the pipeline
+   * @return
+   */
+  std::vector<FilterExecutionLocks> createExecutionLocks(const std::vector<FilterDataReferences>& references);
+
+  /**
+   * @brief Returns true if the two filters may not run at the same time
+   * @param first
+   * @param second
+   * @return
+   */
+  static bool LocksConflict(const FilterExecutionLocks& first, const FilterExecutionLocks& second);
+
+  /**
+   * @brief Runs the enabled filters in waves. Each wave holds every filter whose conflicting predecessors
+   * have finished. Returns false if a filter failed, after the pipeline has been reset to idle.
+   * @param references The references of every filter in the pipeline
+   * @param locks The execution locks of every filter in the pipeline
+   * @return
+   */
+  bool executeFiltersConcurrently(const std::vector<FilterDataReferences>& references, const std::vector<FilterExecutionLocks>& locks);
+
+  /**
+   * @brief Tells the pipeline which filters are currently executing so cancel() can reach them
+   * @param filters
+   */
+  void setRunningFilters(const std::vector<AbstractFilter::Pointer>& filters);
+
+  /**
+   * @brief Sets an error on the filter if the values of a lazily loaded array in its DataContainerArray
+   * could not be loaded while it executed. Arrays that are still pending are not loaded.
+   * @param filter
+   */
+  static void CheckDeferredLoadErrors(const AbstractFilter::Pointer& filter);
+
+  /**
+   * @brief Executes the filter and reports lazily loaded arrays that failed to load as filter errors.
+   * When profiling, returns what the filter used, otherwise a null pointer.
+   * @param filter
+   * @param threadIndex The lane the filter is drawn in when several filters execute at the same time
+   * @param concurrent True if other filters may execute at the same time. Only the CPU time of the
+   * executing thread is then profiled because the process wide counters would include the other filters.
+   * @return
+   */
+  PipelineProfileMessage::Pointer executeFilter(const AbstractFilter::Pointer& filter, int threadIndex, bool concurrent) const;
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
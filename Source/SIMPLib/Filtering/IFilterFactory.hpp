@@ -130,6 +130,22 @@ public:
    */
   virtual QUuid getUuid() const = 0;
 
+  /**
+   * @brief getFilterVersion
+   * @return
+   */
+  virtual QString getFilterVersion() const = 0;
+
+  /**
+   * @brief Returns true if this factory only stands in for one a plugin registers once it is loaded.
+   * The FilterManager replaces it when the plugin registers the real factory.
+   * @return
+   */
+  virtual bool isPlaceholder() const
+  {
+    return false;
+  }
+
 protected:
   IFilterFactory() = default;
 
@@ -33,6 +33,13 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <QtCore/QDateTime>
 #include <QtCore/QFile>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
@@ -51,7 +58,16 @@
 #include "SIMPLib/TestFilters/ThresholdExample.h"
 #endif
 
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/ReadASCIIData.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Messages/PipelineProfileMessage.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
@@ -84,6 +100,10 @@ public:
   {
     return UnitTest::TestTempDir + QString("/FilterPipelineTest.dream3d");
   }
+  QString outputCSVFile()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTest.csv");
+  }
 
   // -----------------------------------------------------------------------------
   //
@@ -92,6 +112,7 @@ public:
   {
 #if REMOVE_TEST_FILES
     QFile::remove(outputDREAM3DFile());
+    QFile::remove(outputCSVFile());
 #endif
   }
 
@@ -151,6 +172,392 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflight()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    QVector<CreateDataContainer::Pointer> filters;
+    for(const QString& name : {QString("DC A"), QString("DC B"), QString("DC C")})
+    {
+      CreateDataContainer::Pointer filter = CreateDataContainer::New();
+      filter->setDataContainerName(DataArrayPath(name, "", ""));
+      pipeline->pushBack(filter);
+      filters.push_back(filter);
+    }
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    QVector<DataContainerArray::Pointer> firstPass;
+    for(const auto& filter : filters)
+    {
+      firstPass.push_back(filter->getDataContainerArray());
+    }
+    DREAM3D_REQUIRE_EQUAL(firstPass[2]->getNumDataContainers(), 3)
+
+    // Nothing changed so no filter is preflighted again
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    for(int i = 0; i < filters.size(); i++)
+    {
+      DREAM3D_REQUIRE(filters[i]->getDataContainerArray() == firstPass[i])
+    }
+
+    // Editing the second filter only re-checks it and the filters after it
+    filters[1]->setDataContainerName(DataArrayPath("DC D", "", ""));
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE(filters[0]->getDataContainerArray() == firstPass[0])
+    DREAM3D_REQUIRE(filters[1]->getDataContainerArray() != firstPass[1])
+    DREAM3D_REQUIRE(filters[2]->getDataContainerArray() != firstPass[2])
+
+    DataContainerArray::Pointer dca = filters[2]->getDataContainerArray();
+    DREAM3D_REQUIRE(dca->doesDataContainerExist("DC D"))
+    DREAM3D_REQUIRE(!dca->doesDataContainerExist("DC B"))
+    DREAM3D_REQUIRE(firstPass[2]->doesDataContainerExist("DC B"))
+
+    // Clearing the cache forces a full preflight
+    pipeline->clearPreflightCache();
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE(filters[0]->getDataContainerArray() != firstPass[0])
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteDataContainerFile(const QString& dcName)
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath(dcName, "", ""));
+    pipeline->pushBack(createDc);
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setOutputFile(outputDREAM3DFile());
+    writer->setWriteXdmfFile(false);
+    pipeline->pushBack(writer);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPreflightCacheInputFile()
+  {
+    WriteDataContainerFile("DC A");
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(outputDREAM3DFile());
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(outputDREAM3DFile()));
+    pipeline->pushBack(reader);
+
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DataContainerArray::Pointer firstPass = reader->getDataContainerArray();
+    DREAM3D_REQUIRE(firstPass->doesDataContainerExist("DC A"))
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DREAM3D_REQUIRE(reader->getDataContainerArray() == firstPass)
+
+    // Rewriting the input file invalidates the cached structure of the reader. The modification time is
+    // moved past the last read explicitly since the file system may only store whole seconds.
+    WriteDataContainerFile("DC With A Longer Name");
+    QFile rewrittenFile(outputDREAM3DFile());
+    DREAM3D_REQUIRE(rewrittenFile.open(QIODevice::ReadWrite))
+    DREAM3D_REQUIRE(rewrittenFile.setFileTime(QDateTime::currentDateTime().addSecs(2), QFileDevice::FileModificationTime))
+    rewrittenFile.close();
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(reader->getDataContainerArray() != firstPass)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteCSVFile(const QString& contents)
+  {
+    QFile csvFile(outputCSVFile());
+    DREAM3D_REQUIRE(csvFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    csvFile.write(contents.toLatin1());
+    csvFile.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  // The ASCII reader names its input file in the wizard data rather than in an input file parameter
+  // -----------------------------------------------------------------------------
+  void TestPreflightCacheWizardInputFile()
+  {
+    WriteCSVFile("Values\n1\n2\n3\n");
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath("DC", "", ""));
+    pipeline->pushBack(createDc);
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DC", "AM", ""));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, 3.0))));
+    pipeline->pushBack(createAm);
+
+    ASCIIWizardData wizardData;
+    wizardData.inputFilePath = outputCSVFile();
+    wizardData.dataHeaders = QStringList("Values");
+    wizardData.dataTypes = QStringList(SIMPL::TypeNames::Int32);
+    wizardData.delimiters = QList<char>({','});
+    wizardData.beginIndex = 2;
+    wizardData.numberOfLines = 3;
+    wizardData.tupleDims = std::vector<size_t>(1, 3);
+    wizardData.selectedPath = DataArrayPath("DC", "AM", "");
+    ReadASCIIData::Pointer reader = ReadASCIIData::New();
+    reader->setWizardData(wizardData);
+    pipeline->pushBack(reader);
+
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DataContainerArray::Pointer firstPass = reader->getDataContainerArray();
+    DREAM3D_REQUIRE(firstPass->doesAttributeArrayExist(DataArrayPath("DC", "AM", "Values")))
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DREAM3D_REQUIRE(reader->getDataContainerArray() == firstPass)
+
+    WriteCSVFile("Values\n4\n5\n6\n7\n");
+    QFile rewrittenFile(outputCSVFile());
+    DREAM3D_REQUIRE(rewrittenFile.open(QIODevice::ReadWrite))
+    DREAM3D_REQUIRE(rewrittenFile.setFileTime(QDateTime::currentDateTime().addSecs(2), QFileDevice::FileModificationTime))
+    rewrittenFile.close();
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(reader->getDataContainerArray() != firstPass)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer CreateReleasePipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath("DC", "", ""));
+    pipeline->pushBack(createDc);
+
+    for(const QString& amName : {QString("AM A"), QString("AM B")})
+    {
+      CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+      createAm->setCreatedAttributeMatrix(DataArrayPath("DC", amName, ""));
+      createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, 10.0))));
+      pipeline->pushBack(createAm);
+    }
+
+    for(const DataArrayPath& path : {DataArrayPath("DC", "AM A", "First"), DataArrayPath("DC", "AM A", "Second"), DataArrayPath("DC", "AM B", "Third")})
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setNumberOfComponents(1);
+      createArray->setNewArray(path);
+      pipeline->pushBack(createArray);
+    }
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReleaseUnusedArrays()
+  {
+    FilterPipeline::Pointer pipeline = CreateReleasePipeline();
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "First")))
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "Second")))
+
+    // The arrays of "AM A" are released once the only filter left works on "AM B"
+    pipeline = CreateReleasePipeline();
+    pipeline->setReleaseUnusedArrays(true);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(dca->doesAttributeMatrixExist(DataArrayPath("DC", "AM A", "")))
+    DREAM3D_REQUIRE(!dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "First")))
+    DREAM3D_REQUIRE(!dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "Second")))
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM B", "Third")))
+  }
+
+  // -----------------------------------------------------------------------------
+  // The writer at the end only references the arrays it writes, which must all still be there when it runs
+  // -----------------------------------------------------------------------------
+  void TestReleaseUnusedArraysWithWriter()
+  {
+    FilterPipeline::Pointer pipeline = CreateReleasePipeline();
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setOutputFile(outputDREAM3DFile());
+    writer->setWriteXdmfFile(false);
+    pipeline->pushBack(writer);
+    pipeline->setReleaseUnusedArrays(true);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "First")))
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "Second")))
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM B", "Third")))
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(outputDREAM3DFile());
+    DREAM3D_REQUIRE(proxy.getDataContainers().contains("DC"))
+    const DataContainerProxy& dcProxy = proxy.getDataContainers()["DC"];
+    DREAM3D_REQUIRE(dcProxy.getAttributeMatricies().contains("AM A"))
+    DREAM3D_REQUIRE(dcProxy.getAttributeMatricies().contains("AM B"))
+    DREAM3D_REQUIRE(dcProxy.getAttributeMatricies()["AM A"].getDataArrays().contains("First"))
+    DREAM3D_REQUIRE(dcProxy.getAttributeMatricies()["AM A"].getDataArrays().contains("Second"))
+    DREAM3D_REQUIRE(dcProxy.getAttributeMatricies()["AM B"].getDataArrays().contains("Third"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentExecution()
+  {
+    // The arrays of "AM A" and "AM B" are created independently of each other
+    FilterPipeline::Pointer pipeline = CreateReleasePipeline();
+    pipeline->setExecuteConcurrently(true);
+    pipeline->setMaxConcurrentFilters(2);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+    for(const DataArrayPath& path : {DataArrayPath("DC", "AM A", "First"), DataArrayPath("DC", "AM A", "Second"), DataArrayPath("DC", "AM B", "Third")})
+    {
+      IDataArray::Pointer array = dca->getPrereqIDataArrayFromPath(nullptr, path);
+      DREAM3D_REQUIRE_VALID_POINTER(array.get())
+      DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), 10)
+    }
+
+    // Two calculators on different AttributeMatrices must be executing at the same time. Each one waits
+    // inside its execute() for the other to arrive; run one after the other the first gives up after a timeout.
+    pipeline = FilterPipeline::New();
+    pipeline->setExecuteConcurrently(true);
+    pipeline->setMaxConcurrentFilters(2);
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath("DC", "", ""));
+    pipeline->pushBack(createDc);
+    for(const QString& amName : {QString("AM A"), QString("AM B")})
+    {
+      CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+      createAm->setCreatedAttributeMatrix(DataArrayPath("DC", amName, ""));
+      createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, 10.0))));
+      pipeline->pushBack(createAm);
+    }
+    // The arrays and then the calculators of both AttributeMatrices each form one wave
+    for(const DataArrayPath& path : {DataArrayPath("DC", "AM A", "First"), DataArrayPath("DC", "AM B", "Third")})
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setNumberOfComponents(1);
+      createArray->setNewArray(path);
+      pipeline->pushBack(createArray);
+    }
+
+    // The pipeline re-emits the buffered messages of each filter later, so only the first one counts
+    std::mutex mutex;
+    std::condition_variable arrived;
+    std::set<AbstractFilter*> arrivedFilters;
+    int executing = 0;
+    bool overlapped = false;
+    auto rendezvous = [&](AbstractFilter* filter, const AbstractMessage::Pointer& msg) {
+      if(!msg->getMessageText().startsWith("Computing"))
+      {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(mutex);
+      if(!arrivedFilters.insert(filter).second)
+      {
+        return;
+      }
+      overlapped = overlapped || executing > 0;
+      executing++;
+      arrived.notify_all();
+      arrived.wait_for(lock, std::chrono::seconds(5), [&]() { return arrivedFilters.size() > 1; });
+      executing--;
+    };
+
+    for(const auto& names : {std::make_pair(QString("AM A"), QString("First")), std::make_pair(QString("AM B"), QString("Third"))})
+    {
+      ArrayCalculator::Pointer calculator = ArrayCalculator::New();
+      calculator->setSelectedAttributeMatrix(DataArrayPath("DC", names.first, ""));
+      calculator->setInfixEquation(names.second + " * 2");
+      calculator->setCalculatedArray(DataArrayPath("DC", names.first, "Doubled"));
+      calculator->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+      AbstractFilter* filter = calculator.get();
+      QObject::connect(filter, &AbstractFilter::messageGenerated, [&rendezvous, filter](const AbstractMessage::Pointer& msg) { rendezvous(filter, msg); });
+      pipeline->pushBack(calculator);
+    }
+
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE_EQUAL(arrivedFilters.size(), static_cast<size_t>(2))
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM A", "Doubled")))
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DC", "AM B", "Doubled")))
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(std::thread::hardware_concurrency() > 1)
+    {
+      DREAM3D_REQUIRE(overlapped)
+    }
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestProfiling()
+  {
+    FilterPipeline::Pointer pipeline = CreateReleasePipeline();
+    pipeline->setProfilingEnabled(true);
+    std::vector<PipelineProfileMessage::Pointer> profiles;
+    QObject::connect(pipeline.get(), &FilterPipeline::messageGenerated, [&profiles](const AbstractMessage::Pointer& msg) {
+      PipelineProfileMessage::Pointer profile = std::dynamic_pointer_cast<PipelineProfileMessage>(msg);
+      if(nullptr != profile)
+      {
+        profiles.push_back(profile);
+      }
+    });
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE_EQUAL(profiles.size(), static_cast<size_t>(pipeline->size()))
+
+    quint64 previousEnd = 0;
+    for(size_t i = 0; i < profiles.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(profiles[i]->getPipelineIndex(), static_cast<int>(i))
+      DREAM3D_REQUIRE(profiles[i]->getStartTime() >= previousEnd)
+      previousEnd = profiles[i]->getStartTime() + profiles[i]->getWallTime();
+      DREAM3D_REQUIRE_EQUAL(profiles[i]->toTraceEvent()["ph"].toString(), QString("X"))
+    }
+
+    // The last three filters each allocate an array of 10 values
+    for(size_t i = 3; i < profiles.size(); i++)
+    {
+      DREAM3D_REQUIRE(profiles[i]->getResourceUsage().bytesAllocated >= 10)
+    }
+
+    // Concurrently executing filters only report the CPU time of their own thread
+    profiles.clear();
+    pipeline = CreateReleasePipeline();
+    pipeline->setProfilingEnabled(true);
+    pipeline->setExecuteConcurrently(true);
+    pipeline->setMaxConcurrentFilters(2);
+    QObject::connect(pipeline.get(), &FilterPipeline::messageGenerated, [&profiles](const AbstractMessage::Pointer& msg) {
+      PipelineProfileMessage::Pointer profile = std::dynamic_pointer_cast<PipelineProfileMessage>(msg);
+      if(nullptr != profile)
+      {
+        profiles.push_back(profile);
+      }
+    });
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE_EQUAL(profiles.size(), static_cast<size_t>(pipeline->size()))
+    for(const PipelineProfileMessage::Pointer& profile : profiles)
+    {
+      DREAM3D_REQUIRE(profile->getExecutedConcurrently())
+      DREAM3D_REQUIRE_EQUAL(profile->getResourceUsage().bytesAllocated, 0)
+      DREAM3D_REQUIRE(profile->toJson().contains("CpuTime"))
+      DREAM3D_REQUIRE(!profile->toJson().contains("BytesAllocated"))
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -165,6 +572,13 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflight());
+    DREAM3D_REGISTER_TEST(TestPreflightCacheInputFile());
+    DREAM3D_REGISTER_TEST(TestPreflightCacheWizardInputFile());
+    DREAM3D_REGISTER_TEST(TestReleaseUnusedArrays());
+    DREAM3D_REGISTER_TEST(TestReleaseUnusedArraysWithWriter());
+    DREAM3D_REGISTER_TEST(TestConcurrentExecution());
+    DREAM3D_REGISTER_TEST(TestProfiling());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -0,0 +1,404 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ThresholdProgram.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/ComparisonInputs.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+#include "SIMPLib/Filtering/ComparisonSet.h"
+#include "SIMPLib/Filtering/ComparisonValue.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+using CompareFunction = void (*)(const void* data, double value, size_t start, size_t count, uint8_t* result);
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Comparator>
+void CompareValues(const void* data, double value, size_t start, size_t count, uint8_t* result)
+{
+  // The comparison value is converted to the type of the array, just like ThresholdFilterHelper does
+  const T* values = static_cast<const T*>(data) + start;
+  const T v = static_cast<T>(value);
+  Comparator comparator;
+  for(size_t i = 0; i < count; i++)
+  {
+    result[i] = comparator(values[i], v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void CompareNone(const void* /*data*/, double /*value*/, size_t /*start*/, size_t count, uint8_t* result)
+{
+  std::fill_n(result, count, 0);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+CompareFunction GetCompareFunction(const IDataArray::Pointer& array, int compOperator)
+{
+  if(nullptr == std::dynamic_pointer_cast<DataArray<T>>(array))
+  {
+    return nullptr;
+  }
+
+  switch(compOperator)
+  {
+  case SIMPL::Comparison::Operator_LessThan:
+    return CompareValues<T, std::less<T>>;
+  case SIMPL::Comparison::Operator_GreaterThan:
+    return CompareValues<T, std::greater<T>>;
+  case SIMPL::Comparison::Operator_Equal:
+    return CompareValues<T, std::equal_to<T>>;
+  case SIMPL::Comparison::Operator_NotEqual:
+    return CompareValues<T, std::not_equal_to<T>>;
+  default:
+    return CompareNone;
+  }
+}
+
+// -----------------------------------------------------------------------------
+CompareFunction GetCompareFunction(const IDataArray::Pointer& array, int compOperator)
+{
+  std::array<CompareFunction, 11> functions = {GetCompareFunction<float>(array, compOperator),    GetCompareFunction<double>(array, compOperator),
+                                               GetCompareFunction<int8_t>(array, compOperator),   GetCompareFunction<uint8_t>(array, compOperator),
+                                               GetCompareFunction<int16_t>(array, compOperator),  GetCompareFunction<uint16_t>(array, compOperator),
+                                               GetCompareFunction<int32_t>(array, compOperator),  GetCompareFunction<uint32_t>(array, compOperator),
+                                               GetCompareFunction<int64_t>(array, compOperator),  GetCompareFunction<uint64_t>(array, compOperator),
+                                               GetCompareFunction<bool>(array, compOperator)};
+  for(const auto& function : functions)
+  {
+    if(nullptr != function)
+    {
+      return function;
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdProgram::ThresholdProgram() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdProgram::~ThresholdProgram() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdProgram::Pointer ThresholdProgram::Compile(ComparisonInputsAdvanced& inputs, const AttributeMatrixShPtrType& attributeMatrix, QString& invalidArrayName)
+{
+  if(nullptr == attributeMatrix)
+  {
+    return NullPointer();
+  }
+
+  Pointer program = Pointer(new ThresholdProgram());
+  program->m_NumberOfTuples = attributeMatrix->getNumberOfTuples();
+  program->m_Root.isSet = true;
+  program->m_Root.invert = inputs.shouldInvert();
+
+  size_t maxDepth = 0;
+  for(const auto& comparison : inputs.getInputs())
+  {
+    if(!AddComparison(program->m_Root, comparison, attributeMatrix, 0, maxDepth, invalidArrayName))
+    {
+      return NullPointer();
+    }
+  }
+  // Every set needs its own buffer plus one for the results of its children
+  program->m_Depth = maxDepth + 2;
+
+  return program;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdProgram::Pointer ThresholdProgram::Compile(ComparisonInputs& inputs, const AttributeMatrixShPtrType& attributeMatrix, QString& invalidArrayName)
+{
+  if(nullptr == attributeMatrix)
+  {
+    return NullPointer();
+  }
+
+  Pointer program = Pointer(new ThresholdProgram());
+  program->m_NumberOfTuples = attributeMatrix->getNumberOfTuples();
+  program->m_Root.isSet = true;
+
+  for(int i = 0; i < inputs.size(); i++)
+  {
+    const ComparisonInput_t& comp = inputs[i];
+    if(!AddValue(program->m_Root, SIMPL::Union::Operator_And, comp.attributeArrayName, comp.compOperator, comp.compValue, attributeMatrix, invalidArrayName))
+    {
+      return NullPointer();
+    }
+  }
+  program->m_Depth = 2;
+
+  return program;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdProgram::AddComparison(Node& parent, const AbstractComparison::Pointer& comparison, const AttributeMatrixShPtrType& attributeMatrix, size_t depth, size_t& maxDepth,
+                                     QString& invalidArrayName)
+{
+  ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison);
+  if(nullptr != comparisonSet)
+  {
+    Node node;
+    node.isSet = true;
+    node.invert = comparisonSet->getInvertComparison();
+    node.unionOperator = comparisonSet->getUnionOperator();
+    maxDepth = std::max(maxDepth, depth + 1);
+    for(const auto& child : comparisonSet->getComparisons())
+    {
+      if(!AddComparison(node, child, attributeMatrix, depth + 1, maxDepth, invalidArrayName))
+      {
+        return false;
+      }
+    }
+    parent.children.push_back(node);
+    return true;
+  }
+
+  ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison);
+  if(nullptr != comparisonValue)
+  {
+    return AddValue(parent, comparisonValue->getUnionOperator(), comparisonValue->getAttributeArrayName(), comparisonValue->getCompOperator(), comparisonValue->getCompValue(), attributeMatrix,
+                    invalidArrayName);
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdProgram::AddValue(Node& parent, int unionOperator, const QString& arrayName, int compOperator, double compValue, const AttributeMatrixShPtrType& attributeMatrix,
+                                QString& invalidArrayName)
+{
+  Node node;
+  node.unionOperator = unionOperator;
+  node.value = compValue;
+  node.array = attributeMatrix->getAttributeArray(arrayName);
+  if(nullptr != node.array)
+  {
+    node.data = node.array->getVoidPointer(0);
+    node.compare = GetCompareFunction(node.array, compOperator);
+  }
+
+  size_t numTuples = attributeMatrix->getNumberOfTuples();
+  if(nullptr == node.compare || node.array->getNumberOfTuples() < numTuples || (numTuples > 0 && nullptr == node.data))
+  {
+    invalidArrayName = arrayName;
+    return false;
+  }
+
+  parent.children.push_back(node);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdProgram::evaluateSet(const Node& node, size_t start, size_t count, uint8_t* buffers, size_t depth) const
+{
+  uint8_t* result = buffers + depth * k_TileSize;
+  uint8_t* childResult = buffers + (depth + 1) * k_TileSize;
+
+  // A set without any comparisons does not select anything
+  std::fill_n(result, count, 0);
+
+  bool first = true;
+  for(const auto& child : node.children)
+  {
+    if(child.isSet)
+    {
+      evaluateSet(child, start, count, buffers, depth + 1);
+      if(child.invert)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          childResult[i] = !childResult[i];
+        }
+      }
+    }
+    else
+    {
+      child.compare(child.data, child.value, start, count, childResult);
+    }
+
+    // The union operator of the first comparison in a set is ignored
+    if(first)
+    {
+      std::copy_n(childResult, count, result);
+      first = false;
+    }
+    else if(SIMPL::Union::Operator_Or == child.unionOperator)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = result[i] | childResult[i];
+      }
+    }
+    else
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = result[i] & childResult[i];
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void ThresholdProgram::writeResult(const IDataArray::Pointer& destination) const
+{
+  T* dest = std::dynamic_pointer_cast<DataArray<T>>(destination)->getPointer(0);
+  size_t numTuples = m_NumberOfTuples;
+  size_t numTiles = (numTuples + k_TileSize - 1) / k_TileSize;
+  const uint8_t invert = m_Root.invert ? 1 : 0;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTiles);
+  dataAlg.execute([this, dest, numTuples, invert](const SIMPLRange& range) {
+    std::vector<uint8_t> buffers(m_Depth * k_TileSize);
+    for(size_t tile = range.min(); tile < range.max(); tile++)
+    {
+      size_t start = tile * k_TileSize;
+      size_t count = numTuples - start;
+      if(count > k_TileSize)
+      {
+        count = k_TileSize;
+      }
+
+      evaluateSet(m_Root, start, count, buffers.data(), 0);
+      const uint8_t* result = buffers.data();
+      for(size_t i = 0; i < count; i++)
+      {
+        dest[start + i] = (result[i] ^ invert) != 0 ? static_cast<T>(1) : static_cast<T>(0);
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ThresholdProgram::evaluate(const IDataArray::Pointer& destination) const
+{
+  if(nullptr == destination || destination->getNumberOfTuples() < m_NumberOfTuples)
+  {
+    return -1;
+  }
+  if(m_NumberOfTuples == 0)
+  {
+    return 0;
+  }
+
+  if(std::dynamic_pointer_cast<BoolArrayType>(destination))
+  {
+    writeResult<bool>(destination);
+  }
+  else if(std::dynamic_pointer_cast<Int8ArrayType>(destination))
+  {
+    writeResult<int8_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<UInt8ArrayType>(destination))
+  {
+    writeResult<uint8_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<Int16ArrayType>(destination))
+  {
+    writeResult<int16_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<UInt16ArrayType>(destination))
+  {
+    writeResult<uint16_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<Int32ArrayType>(destination))
+  {
+    writeResult<int32_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<UInt32ArrayType>(destination))
+  {
+    writeResult<uint32_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<Int64ArrayType>(destination))
+  {
+    writeResult<int64_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<UInt64ArrayType>(destination))
+  {
+    writeResult<uint64_t>(destination);
+  }
+  else if(std::dynamic_pointer_cast<FloatArrayType>(destination))
+  {
+    writeResult<float>(destination);
+  }
+  else if(std::dynamic_pointer_cast<DoubleArrayType>(destination))
+  {
+    writeResult<double>(destination);
+  }
+  else if(std::dynamic_pointer_cast<SizeTArrayType>(destination))
+  {
+    writeResult<size_t>(destination);
+  }
+  else
+  {
+    return -1;
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+ThresholdProgram::Pointer ThresholdProgram::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
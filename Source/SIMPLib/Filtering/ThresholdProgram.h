@@ -0,0 +1,148 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/Filtering/AbstractComparison.h"
+
+class AttributeMatrix;
+using AttributeMatrixShPtrType = std::shared_ptr<AttributeMatrix>;
+class ComparisonInputs;
+class ComparisonInputsAdvanced;
+
+/**
+ * @brief The ThresholdProgram class compiles a tree of ComparisonSets and ComparisonValues into a
+ * single predicate and evaluates it in one pass over the compared arrays. The tuples are processed
+ * in tiles that are distributed across threads; within a tile each comparison runs as a tight loop
+ * over the native type of its array and the results are merged with AND / OR without allocating
+ * any full size temporary arrays. The mask is written straight into the destination array.
+ */
+class SIMPLib_EXPORT ThresholdProgram
+{
+public:
+  using Self = ThresholdProgram;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Number of tuples evaluated at once by each thread
+   */
+  static const size_t k_TileSize = 4096;
+
+  /**
+   * @brief Compiles the comparisons of a MultiThresholdObjects2 filter. Comparison values and sets are
+   * merged using their union operator and sets are inverted when requested, the same way the filter
+   * has always combined them.
+   * @param inputs
+   * @param attributeMatrix AttributeMatrix that holds the compared arrays
+   * @param invalidArrayName Set to the name of the array that could not be compiled
+   * @return The program or a null pointer if an array is missing or of an unsupported type
+   */
+  static Pointer Compile(ComparisonInputsAdvanced& inputs, const AttributeMatrixShPtrType& attributeMatrix, QString& invalidArrayName);
+
+  /**
+   * @brief Compiles the comparisons of a MultiThresholdObjects filter. A tuple passes when all of the
+   * comparisons are true.
+   * @param inputs
+   * @param attributeMatrix AttributeMatrix that holds the compared arrays
+   * @param invalidArrayName Set to the name of the array that could not be compiled
+   * @return The program or a null pointer if an array is missing or of an unsupported type
+   */
+  static Pointer Compile(ComparisonInputs& inputs, const AttributeMatrixShPtrType& attributeMatrix, QString& invalidArrayName);
+
+  virtual ~ThresholdProgram();
+
+  /**
+   * @brief Evaluates the program for every tuple of the AttributeMatrix and writes true / false into
+   * a bool destination array and 1 / 0 into any other numeric destination array.
+   * @param destination
+   * @return 0 on success or -1 if the destination array is too small or of an unsupported type
+   */
+  int evaluate(const IDataArray::Pointer& destination) const;
+
+protected:
+  ThresholdProgram();
+
+private:
+  using CompareFunction = void (*)(const void* data, double value, size_t start, size_t count, uint8_t* result);
+
+  struct Node
+  {
+    bool isSet = false;
+    bool invert = false;
+    int unionOperator = 0;
+    IDataArray::Pointer array;
+    const void* data = nullptr;
+    CompareFunction compare = nullptr;
+    double value = 0.0;
+    std::vector<Node> children;
+  };
+
+  Node m_Root;
+  size_t m_NumberOfTuples = 0;
+  size_t m_Depth = 0;
+
+  /**
+   * @brief Adds the comparison to the parent node
+   * @return false if the comparison's array could not be found or has an unsupported type
+   */
+  static bool AddComparison(Node& parent, const AbstractComparison::Pointer& comparison, const AttributeMatrixShPtrType& attributeMatrix, size_t depth, size_t& maxDepth, QString& invalidArrayName);
+
+  /**
+   * @brief Adds a single comparison against the named array to the parent node
+   * @return false if the array could not be found or has an unsupported type
+   */
+  static bool AddValue(Node& parent, int unionOperator, const QString& arrayName, int compOperator, double compValue, const AttributeMatrixShPtrType& attributeMatrix, QString& invalidArrayName);
+
+  /**
+   * @brief Evaluates a set node for the tuples [start, start + count) into buffers[depth]
+   */
+  void evaluateSet(const Node& node, size_t start, size_t count, uint8_t* buffers, size_t depth) const;
+
+  template <typename T>
+  void writeResult(const IDataArray::Pointer& destination) const;
+
+public:
+  ThresholdProgram(const ThresholdProgram&) = delete;            // Copy Constructor Not Implemented
+  ThresholdProgram(ThresholdProgram&&) = delete;                 // Move Constructor Not Implemented
+  ThresholdProgram& operator=(const ThresholdProgram&) = delete; // Copy Assignment Not Implemented
+  ThresholdProgram& operator=(ThresholdProgram&&) = delete;      // Move Assignment Not Implemented
+};
@@ -31,10 +31,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -49,6 +53,11 @@ using namespace H5Support;
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_sort.h>
+#endif
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
@@ -156,13 +165,18 @@ public:
     }
     else
     {
+      // The whole dataset comes in with one read and is then unpacked into the contiguous storage of the list
       std::vector<uint8_t> buffer;
       err = QH5Lite::readVectorDataset(parentId, dynamicListName, buffer);
       if(err < 0)
       {
         return dynamicList = DynamicListArray<T, K>::NullPointer();
       }
-      dynamicList->deserializeLinks(buffer, numElems);
+      if(!dynamicList->deserializeLinks(buffer, numElems))
+      {
+        err = -3;
+        return dynamicList = DynamicListArray<T, K>::NullPointer();
+      }
     }
 
     return dynamicList;
@@ -184,34 +198,19 @@ public:
     {
       return err;
     }
-    int32_t rank = 0;
-    hsize_t dims[2] = {0, 2ULL};
-    size_t total = 0;
-    for(size_t v = 0; v < numElems; ++v)
-    {
-      total += dynamicList->getNumberOfElements(v);
-    }
-
-    size_t totalBytes = numElems * sizeof(T) + total * sizeof(K);
-
-    // Allocate a flat array to copy the data into
-    QVector<uint8_t> buffer(totalBytes, 0);
-    uint8_t* bufPtr = &(buffer.front());
-    size_t offset = 0;
-
-    for(size_t v = 0; v < numElems; ++v)
+    if(numElems > dynamicList->size())
     {
-      T nelems = dynamicList->getNumberOfElements(v);
-      K* elems = dynamicList->getElementListPointer(v);
-      ::memcpy(bufPtr + offset, &nelems, sizeof(T));
-      offset += sizeof(T);
-      ::memcpy(bufPtr + offset, elems, nelems * sizeof(K));
-      offset += nelems * sizeof(K);
+      return -1;
     }
 
-    rank = 1;
-    dims[0] = totalBytes;
+    // Pack the lists into a flat buffer and write it with a single call
+    size_t totalBytes = dynamicList->getSerializedSize(numElems);
+    std::vector<uint8_t> buffer(totalBytes);
+    uint8_t* bufPtr = buffer.data();
+    dynamicList->serializeLinks(bufPtr, numElems);
 
+    int32_t rank = 1;
+    hsize_t dims[1] = {totalBytes};
     err = QH5Lite::writePointerDataset(parentId, name, rank, dims, bufPtr);
     return err;
   }
@@ -237,39 +236,62 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const K* elems = elemList->getPointer(0);
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
-
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, std::string("_INTERNAL_USE_ONLY_Vertices"), true);
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
+    std::unique_ptr<std::atomic<size_t>[]> linkLoc(new std::atomic<size_t>[numVerts]);
+    ParallelDataAlgorithm vertAlg;
+    vertAlg.setRange(0, numVerts);
+    vertAlg.execute([&](const SIMPLRange& range) {
+      for(size_t v = range.min(); v < range.max(); v++)
+      {
+        linkLoc[v].store(0, std::memory_order_relaxed);
+      }
+    });
 
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
     // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
-    {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    ParallelDataAlgorithm elemAlg;
+    elemAlg.setRange(0, numElems);
+    elemAlg.execute([&](const SIMPLRange& range) {
+      for(size_t elemId = range.min(); elemId < range.max(); elemId++)
       {
-        linkCount[verts[j]]++;
+        const K* verts = elems + elemId * numVertsPerElem;
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          linkLoc[verts[j]].fetch_add(1, std::memory_order_relaxed);
+        }
       }
-    }
+    });
+
+    std::vector<T> linkCount(numVerts, 0);
+    vertAlg.execute([&](const SIMPLRange& range) {
+      for(size_t v = range.min(); v < range.max(); v++)
+      {
+        linkCount[v] = static_cast<T>(linkLoc[v].exchange(0, std::memory_order_relaxed));
+      }
+    });
 
     // Now allocate storage for the links
     dynamicList->allocateLists(linkCount);
 
-    for(elemId = 0; elemId < numElems; elemId++)
-    {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    elemAlg.execute([&](const SIMPLRange& range) {
+      for(size_t elemId = range.min(); elemId < range.max(); elemId++)
       {
-        dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
+        const K* verts = elems + elemId * numVertsPerElem;
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          dynamicList->insertCellReference(verts[j], linkLoc[verts[j]].fetch_add(1, std::memory_order_relaxed), elemId);
+        }
       }
-    }
+    });
+
+    // Threads fill the lists in any order, sorting puts the elements back in increasing order like a serial traversal
+    vertAlg.execute([&](const SIMPLRange& range) {
+      for(size_t v = range.min(); v < range.max(); v++)
+      {
+        K* cells = dynamicList->getElementListPointer(v);
+        std::sort(cells, cells + dynamicList->getNumberOfElements(v));
+      }
+    });
   }
 
   /**
@@ -287,7 +309,7 @@ public:
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numSharedVerts = 0;
-    QVector<T> linkCount(numElems, 0);
+    std::vector<T> linkCount(numElems, 0);
     int err = 0;
 
     switch(geometryType)
@@ -327,24 +349,15 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, std::string("_INTERNAL_USE_ONLY_Visited"), true);
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+    const K* elems = elemList->getPointer(0);
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
-
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
-    {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
+    // Collects the neighbors of element t in the order they are found by walking the elements that use each
+    // of its vertices. An element is a neighbor if it shares numSharedVerts vertices with t.
+    auto findNeighbors = [&](size_t t, std::vector<K>& neighbors) {
+      neighbors.clear();
+      const K* seedElem = elems + t * numVertsPerElem;
       for(size_t v = 0; v < numVertsPerElem; ++v)
       {
-        //   qDebug() << " vert " << v << "\n";
         T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
         K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
 
@@ -354,16 +367,13 @@ public:
           {
             continue;
           } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
+          if(std::find(neighbors.begin(), neighbors.end(), vertIdxs[vt]) != neighbors.end())
           {
             continue;
           } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
+          const K* vertCell = elems + vertIdxs[vt] * numVertsPerElem;
           size_t vCount = 0;
           // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
           for(size_t i = 0; i < numVertsPerElem; i++)
           {
             for(size_t j = 0; j < numVertsPerElem; j++)
@@ -375,31 +385,39 @@ public:
             }
           }
 
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
           if(vCount == numSharedVerts)
           {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
+            neighbors.push_back(vertIdxs[vt]);
           }
         }
       }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
+    };
+
+    // The neighbors are searched twice, once to size each list and once to fill it, so that every list
+    // can be written straight into the contiguous storage of the dynamic list from any thread.
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      std::vector<K> neighbors;
+      neighbors.reserve(32);
+      for(size_t t = range.min(); t < range.max(); ++t)
       {
-        visited[loop_neighbors[k]] = false;
+        findNeighbors(t, neighbors);
+        linkCount[t] = static_cast<T>(neighbors.size());
       }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
-    }
+    });
+
+    dynamicList->allocateLists(linkCount);
+
+    dataAlg.execute([&](const SIMPLRange& range) {
+      std::vector<K> neighbors;
+      neighbors.reserve(32);
+      for(size_t t = range.min(); t < range.max(); ++t)
+      {
+        findNeighbors(t, neighbors);
+        std::copy(neighbors.begin(), neighbors.begin() + linkCount[t], dynamicList->getElementListPointer(t));
+      }
+    });
 
     return err;
   }
@@ -412,62 +430,9 @@ public:
   template <typename T>
   static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resizeTuples(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    std::vector<std::array<T, 2>> edges = SortedElementKeys<T, 2>(elemList, PolygonEdges(elemList->getNumberOfComponents()));
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    WriteKeys<T, 2>(edges, edgeList);
   }
 
   /**
@@ -478,42 +443,9 @@ public:
   template <typename T>
   static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resizeTuples(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    std::vector<std::array<T, 2>> edges = SortedElementKeys<T, 2>(tetList, TetEdges());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    WriteKeys<T, 2>(edges, edgeList);
   }
 
   /**
@@ -524,51 +456,9 @@ public:
   template <typename T>
   static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edge_List)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edge_List->resizeTuples(edgeSet.size());
-    T* uEdges = edge_List->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    std::vector<std::array<T, 2>> edges = SortedElementKeys<T, 2>(hexList, HexEdges());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    WriteKeys<T, 2>(edges, edge_List);
   }
 
   /**
@@ -579,41 +469,9 @@ public:
   template <typename T>
   static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resizeTuples(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    std::vector<std::array<T, 3>> faces = SortedElementKeys<T, 3>(tetList, TetFaces());
+    faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+    WriteKeys<T, 3>(faces, faceList);
   }
 
   /**
@@ -624,45 +482,9 @@ public:
   template <typename T>
   static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resizeTuples(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    std::vector<std::array<T, 4>> faces = SortedElementKeys<T, 4>(hexList, HexFaces());
+    faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+    WriteKeys<T, 4>(faces, faceList);
   }
 
   /**
@@ -673,75 +495,9 @@ public:
   template <typename T>
   static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resizeTuples(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    std::vector<std::array<T, 2>> edges = SortedElementKeys<T, 2>(elemList, PolygonEdges(elemList->getNumberOfComponents()));
+    KeepUnsharedKeys(edges);
+    WriteKeys<T, 2>(edges, edgeList);
   }
 
   /**
@@ -752,55 +508,9 @@ public:
   template <typename T>
   static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resizeTuples(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    std::vector<std::array<T, 2>> edges = SortedElementKeys<T, 2>(tetList, TetEdges());
+    KeepUnsharedKeys(edges);
+    WriteKeys<T, 2>(edges, edgeList);
   }
 
   /**
@@ -811,64 +521,9 @@ public:
   template <typename T>
   static void FindUnsharedHexEdges(typename DataArray<T>::Pointer& hexList, typename DataArray<T>::Pointer& edge_List)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edge_List->resizeTuples(edgeMap.size());
-    T* bEdges = edge_List->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    std::vector<std::array<T, 2>> edges = SortedElementKeys<T, 2>(hexList, HexEdges());
+    KeepUnsharedKeys(edges);
+    WriteKeys<T, 2>(edges, edge_List);
   }
 
   /**
@@ -879,54 +534,9 @@ public:
   template <typename T>
   static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resizeTuples(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
-    }
+    std::vector<std::array<T, 3>> faces = SortedElementKeys<T, 3>(tetList, TetFaces());
+    KeepUnsharedKeys(faces);
+    WriteKeys<T, 3>(faces, faceList);
   }
 
   /**
@@ -937,57 +547,142 @@ public:
   template <typename T>
   static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
+    std::vector<std::array<T, 4>> faces = SortedElementKeys<T, 4>(hexList, HexFaces());
+    KeepUnsharedKeys(faces);
+    WriteKeys<T, 4>(faces, faceList);
+  }
 
-    for(size_t i = 0; i < numElems; i++)
+private:
+  /**
+   * @brief Local vertex indices of the edges of a polygon with numVerts vertices
+   */
+  static std::vector<std::array<size_t, 2>> PolygonEdges(size_t numVerts)
+  {
+    std::vector<std::array<size_t, 2>> edges(numVerts);
+    for(size_t j = 0; j < numVerts; j++)
     {
-      T* verts = hexList->getTuplePointer(i);
+      edges[j] = {j, (j + 1) % numVerts};
+    }
+    return edges;
+  }
 
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
+  /**
+   * @brief Local vertex indices of the edges of a tetrahedron
+   */
+  static std::vector<std::array<size_t, 2>> TetEdges()
+  {
+    return {{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}};
+  }
 
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
+  /**
+   * @brief Local vertex indices of the edges of a hexahedron
+   */
+  static std::vector<std::array<size_t, 2>> HexEdges()
+  {
+    return {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 5}, {5, 6}, {6, 7}, {7, 4}};
+  }
 
-      for(auto&& quad : quadList)
+  /**
+   * @brief Local vertex indices of the faces of a tetrahedron
+   */
+  static std::vector<std::array<size_t, 3>> TetFaces()
+  {
+    return {{0, 1, 2}, {1, 2, 3}, {0, 2, 3}, {0, 1, 3}};
+  }
+
+  /**
+   * @brief Local vertex indices of the faces of a hexahedron
+   */
+  static std::vector<std::array<size_t, 4>> HexFaces()
+  {
+    return {{0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}, {0, 1, 2, 3}, {4, 5, 6, 7}};
+  }
+
+  /**
+   * @brief Builds one key per entry of pattern for every element, each holding the sorted vertex ids at
+   * those local indices, and returns all the keys sorted lexicographically. Duplicates are adjacent
+   * afterwards and the keys come out in the order a std::set of them would iterate in.
+   * @param elemList
+   * @param pattern
+   * @return
+   */
+  template <typename T, size_t N>
+  static std::vector<std::array<T, N>> SortedElementKeys(const typename DataArray<T>::Pointer& elemList, const std::vector<std::array<size_t, N>>& pattern)
+  {
+    size_t numElems = elemList->getNumberOfTuples();
+    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    size_t keysPerElem = pattern.size();
+    const T* elems = elemList->getPointer(0);
+    std::vector<std::array<T, N>> keys(numElems * keysPerElem);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
+        const T* verts = elems + i * numVertsPerElem;
+        for(size_t k = 0; k < keysPerElem; k++)
+        {
+          std::array<T, N>& key = keys[i * keysPerElem + k];
+          for(size_t n = 0; n < N; n++)
+          {
+            key[n] = verts[pattern[k][n]];
+          }
+          std::sort(key.begin(), key.end());
+        }
       }
-    }
-
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
+    });
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_sort(keys.begin(), keys.end());
+#else
+    std::sort(keys.begin(), keys.end());
+#endif
+    return keys;
+  }
 
-    while(mapIter != faceMap.end())
+  /**
+   * @brief Removes every key that appears more than once from the sorted keys
+   * @param keys
+   */
+  template <typename KeyType>
+  static void KeepUnsharedKeys(std::vector<KeyType>& keys)
+  {
+    size_t numUnshared = 0;
+    size_t i = 0;
+    while(i < keys.size())
     {
-      if((*mapIter).second > 1)
+      size_t j = i + 1;
+      while(j < keys.size() && keys[j] == keys[i])
       {
-        faceMap.erase(mapIter++);
+        j++;
       }
-      else
+      if(j - i == 1)
       {
-        ++mapIter;
+        keys[numUnshared++] = keys[i];
       }
+      i = j;
     }
+    keys.resize(numUnshared);
+  }
 
-    faceList->resizeTuples(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
+  /**
+   * @brief Copies the keys into list, one key per tuple
+   * @param keys
+   * @param list
+   */
+  template <typename T, size_t N>
+  static void WriteKeys(const std::vector<std::array<T, N>>& keys, typename DataArray<T>::Pointer& list)
+  {
+    list->resizeTuples(keys.size());
+    if(keys.empty())
+    {
+      return;
+    }
+    T* dst = list->getPointer(0);
+    for(size_t i = 0; i < keys.size(); i++)
     {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
+      std::copy(keys[i].begin(), keys[i].end(), dst + i * N);
     }
   }
 };
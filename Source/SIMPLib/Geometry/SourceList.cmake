@@ -25,8 +25,10 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexSpatialIndex.h
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
@@ -51,8 +53,10 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexSpatialIndex.cpp
 )
 
 if(SIMPL_USE_EIGEN)
@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <array>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+
+  virtual ~GeometryHelpersTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  SizeTArrayType::Pointer CreateList(const std::vector<size_t>& values, size_t numComps)
+  {
+    std::vector<size_t> cDims = {numComps};
+    SizeTArrayType::Pointer list = SizeTArrayType::CreateArray(values.size() / numComps, cDims, "List", true);
+    std::copy(values.begin(), values.end(), list->begin());
+    return list;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireList(const SizeTArrayType::Pointer& list, const std::vector<size_t>& expected)
+  {
+    DREAM3D_REQUIRE_EQUAL(list->getSize(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(list->getValue(i), expected[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireDynamicList(const ElementDynamicList::Pointer& list, const std::vector<std::vector<size_t>>& expected)
+  {
+    DREAM3D_REQUIRE_EQUAL(list->size(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(list->getNumberOfElements(i), expected[i].size())
+      size_t* elems = list->getElementListPointer(i);
+      for(size_t j = 0; j < expected[i].size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(elems[j], expected[i][j])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Serial reference for the edge and face finders: every key of every element, vertex sorted, in the
+  // order a std::map of them iterates in, optionally keeping only the keys used by a single element
+  // -----------------------------------------------------------------------------
+  template <size_t N>
+  std::vector<size_t> ReferenceKeys(const std::vector<size_t>& elems, size_t numVertsPerElem, const std::vector<std::array<size_t, N>>& pattern, bool unsharedOnly)
+  {
+    std::map<std::array<size_t, N>, size_t> counts;
+    for(size_t e = 0; e < elems.size() / numVertsPerElem; e++)
+    {
+      for(const std::array<size_t, N>& local : pattern)
+      {
+        std::array<size_t, N> key;
+        for(size_t n = 0; n < N; n++)
+        {
+          key[n] = elems[e * numVertsPerElem + local[n]];
+        }
+        std::sort(key.begin(), key.end());
+        counts[key]++;
+      }
+    }
+
+    std::vector<size_t> keys;
+    for(const auto& entry : counts)
+    {
+      if(!unsharedOnly || entry.second == 1)
+      {
+        keys.insert(keys.end(), entry.first.begin(), entry.first.end());
+      }
+    }
+    return keys;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Serial reference for FindElementsContainingVert: element ids in increasing order for each vertex
+  // -----------------------------------------------------------------------------
+  std::vector<std::vector<size_t>> ReferenceElementsContainingVert(const std::vector<size_t>& elems, size_t numVertsPerElem, size_t numVerts)
+  {
+    std::vector<std::vector<size_t>> lists(numVerts);
+    for(size_t e = 0; e < elems.size() / numVertsPerElem; e++)
+    {
+      for(size_t j = 0; j < numVertsPerElem; j++)
+      {
+        lists[elems[e * numVertsPerElem + j]].push_back(e);
+      }
+    }
+    return lists;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Serial reference for FindElementNeighbors: walks the elements using each vertex of the seed element
+  // and keeps those sharing exactly numSharedVerts vertices, in the order they are first found
+  // -----------------------------------------------------------------------------
+  std::vector<std::vector<size_t>> ReferenceElementNeighbors(const std::vector<size_t>& elems, size_t numVertsPerElem, const std::vector<std::vector<size_t>>& elemsContainingVert,
+                                                             size_t numSharedVerts)
+  {
+    size_t numElems = elems.size() / numVertsPerElem;
+    std::vector<std::vector<size_t>> neighbors(numElems);
+    for(size_t t = 0; t < numElems; t++)
+    {
+      for(size_t v = 0; v < numVertsPerElem; v++)
+      {
+        for(size_t other : elemsContainingVert[elems[t * numVertsPerElem + v]])
+        {
+          if(other == t || std::find(neighbors[t].begin(), neighbors[t].end(), other) != neighbors[t].end())
+          {
+            continue;
+          }
+          size_t shared = 0;
+          for(size_t i = 0; i < numVertsPerElem; i++)
+          {
+            shared += std::count(elems.begin() + other * numVertsPerElem, elems.begin() + (other + 1) * numVertsPerElem, elems[t * numVertsPerElem + i]);
+          }
+          if(shared == numSharedVerts)
+          {
+            neighbors[t].push_back(other);
+          }
+        }
+      }
+    }
+    return neighbors;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetConnectivity()
+  {
+    // Two tetrahedra sharing the face {1, 2, 3}
+    SizeTArrayType::Pointer tets = CreateList({0, 1, 2, 3, 3, 2, 1, 4}, 4);
+
+    SizeTArrayType::Pointer edges = CreateList({}, 2);
+    GeometryHelpers::Connectivity::FindTetEdges<size_t>(tets, edges);
+    RequireList(edges, {0, 1, 0, 2, 0, 3, 1, 2, 1, 3, 1, 4, 2, 3, 2, 4, 3, 4});
+
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges<size_t>(tets, edges);
+    RequireList(edges, {0, 1, 0, 2, 0, 3, 1, 4, 2, 4, 3, 4});
+
+    SizeTArrayType::Pointer faces = CreateList({}, 3);
+    GeometryHelpers::Connectivity::FindTetFaces<size_t>(tets, faces);
+    RequireList(faces, {0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3, 1, 2, 4, 1, 3, 4, 2, 3, 4});
+
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces<size_t>(tets, faces);
+    RequireList(faces, {0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 4, 1, 3, 4, 2, 3, 4});
+
+    ElementDynamicList::Pointer tetsContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, size_t>(tets, tetsContainingVert, 5);
+    DREAM3D_REQUIRE_EQUAL(tetsContainingVert->size(), 5)
+    DREAM3D_REQUIRE_EQUAL(tetsContainingVert->getNumberOfElements(0), 1)
+    DREAM3D_REQUIRE_EQUAL(tetsContainingVert->getNumberOfElements(4), 1)
+    DREAM3D_REQUIRE_EQUAL(tetsContainingVert->getElementListPointer(4)[0], 1)
+    for(size_t v = 1; v < 4; v++)
+    {
+      DREAM3D_REQUIRE_EQUAL(tetsContainingVert->getNumberOfElements(v), 2)
+      DREAM3D_REQUIRE_EQUAL(tetsContainingVert->getElementListPointer(v)[0], 0)
+      DREAM3D_REQUIRE_EQUAL(tetsContainingVert->getElementListPointer(v)[1], 1)
+    }
+
+    ElementDynamicList::Pointer tetNeighbors = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, size_t>(tets, tetsContainingVert, tetNeighbors, IGeometry::Type::Tetrahedral);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(tetNeighbors->getNumberOfElements(0), 1)
+    DREAM3D_REQUIRE_EQUAL(tetNeighbors->getElementListPointer(0)[0], 1)
+    DREAM3D_REQUIRE_EQUAL(tetNeighbors->getNumberOfElements(1), 1)
+    DREAM3D_REQUIRE_EQUAL(tetNeighbors->getElementListPointer(1)[0], 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleConnectivity()
+  {
+    // Two triangles sharing the edge {1, 2}
+    SizeTArrayType::Pointer tris = CreateList({0, 1, 2, 2, 1, 3}, 3);
+
+    SizeTArrayType::Pointer edges = CreateList({}, 2);
+    GeometryHelpers::Connectivity::Find2DElementEdges<size_t>(tris, edges);
+    RequireList(edges, {0, 1, 0, 2, 1, 2, 1, 3, 2, 3});
+
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<size_t>(tris, edges);
+    RequireList(edges, {0, 1, 0, 2, 1, 3, 2, 3});
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestQuadConnectivity()
+  {
+    // Two quadrilaterals sharing the edge {1, 2}
+    SizeTArrayType::Pointer quads = CreateList({0, 1, 2, 3, 1, 4, 5, 2}, 4);
+
+    SizeTArrayType::Pointer edges = CreateList({}, 2);
+    GeometryHelpers::Connectivity::Find2DElementEdges<size_t>(quads, edges);
+    RequireList(edges, {0, 1, 0, 3, 1, 2, 1, 4, 2, 3, 2, 5, 4, 5});
+
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<size_t>(quads, edges);
+    RequireList(edges, {0, 1, 0, 3, 1, 4, 2, 3, 2, 5, 4, 5});
+
+    ElementDynamicList::Pointer quadsContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, size_t>(quads, quadsContainingVert, 6);
+    RequireDynamicList(quadsContainingVert, {{0}, {0, 1}, {0, 1}, {0}, {1}, {1}});
+
+    ElementDynamicList::Pointer quadNeighbors = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, size_t>(quads, quadsContainingVert, quadNeighbors, IGeometry::Type::Quad);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    RequireDynamicList(quadNeighbors, {{1}, {0}});
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexConnectivity()
+  {
+    // Two hexahedra sharing the face {4, 5, 6, 7}, the top of the first one and the bottom of the second
+    SizeTArrayType::Pointer hexes = CreateList({0, 1, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 8, 9, 10, 11}, 8);
+
+    SizeTArrayType::Pointer edges = CreateList({}, 2);
+    GeometryHelpers::Connectivity::FindHexEdges<size_t>(hexes, edges);
+    RequireList(edges, {0, 1, 0, 3, 0, 4, 1, 2, 1, 5, 2, 3, 2, 6, 3, 7, 4, 5, 4, 7, 4, 8, 5, 6, 5, 9, 6, 7, 6, 10, 7, 11, 8, 9, 8, 11, 9, 10, 10, 11});
+
+    GeometryHelpers::Connectivity::FindUnsharedHexEdges<size_t>(hexes, edges);
+    RequireList(edges, {0, 1, 0, 3, 0, 4, 1, 2, 1, 5, 2, 3, 2, 6, 3, 7, 4, 8, 5, 9, 6, 10, 7, 11, 8, 9, 8, 11, 9, 10, 10, 11});
+
+    SizeTArrayType::Pointer faces = CreateList({}, 4);
+    GeometryHelpers::Connectivity::FindHexFaces<size_t>(hexes, faces);
+    RequireList(faces, {0, 1, 2, 3, 0, 1, 4, 5, 0, 3, 4, 7, 1, 2, 5, 6, 2, 3, 6, 7, 4, 5, 6, 7, 4, 5, 8, 9, 4, 7, 8, 11, 5, 6, 9, 10, 6, 7, 10, 11, 8, 9, 10, 11});
+
+    GeometryHelpers::Connectivity::FindUnsharedHexFaces<size_t>(hexes, faces);
+    RequireList(faces, {0, 1, 2, 3, 0, 1, 4, 5, 0, 3, 4, 7, 1, 2, 5, 6, 2, 3, 6, 7, 4, 5, 8, 9, 4, 7, 8, 11, 5, 6, 9, 10, 6, 7, 10, 11, 8, 9, 10, 11});
+
+    ElementDynamicList::Pointer hexesContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, size_t>(hexes, hexesContainingVert, 12);
+    RequireDynamicList(hexesContainingVert, {{0}, {0}, {0}, {0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {1}, {1}, {1}, {1}});
+
+    ElementDynamicList::Pointer hexNeighbors = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, size_t>(hexes, hexesContainingVert, hexNeighbors, IGeometry::Type::Hexahedral);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    RequireDynamicList(hexNeighbors, {{1}, {0}});
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRandomTetConnectivity()
+  {
+    // Few vertices and many tetrahedra so that edges and faces are shared by many elements, and enough
+    // elements that the parallel passes split the work across threads
+    const size_t numVerts = 60;
+    const size_t numTets = 5000;
+    std::mt19937_64 generator(5489u);
+    std::uniform_int_distribution<size_t> distribution(0, numVerts - 1);
+    std::vector<size_t> tetValues;
+    tetValues.reserve(numTets * 4);
+    for(size_t t = 0; t < numTets; t++)
+    {
+      std::vector<size_t> verts;
+      while(verts.size() < 4)
+      {
+        size_t v = distribution(generator);
+        if(std::find(verts.begin(), verts.end(), v) == verts.end())
+        {
+          verts.push_back(v);
+        }
+      }
+      tetValues.insert(tetValues.end(), verts.begin(), verts.end());
+    }
+    SizeTArrayType::Pointer tets = CreateList(tetValues, 4);
+
+    const std::vector<std::array<size_t, 2>> tetEdges = {{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}};
+    const std::vector<std::array<size_t, 3>> tetFaces = {{0, 1, 2}, {1, 2, 3}, {0, 2, 3}, {0, 1, 3}};
+
+    SizeTArrayType::Pointer edges = CreateList({}, 2);
+    GeometryHelpers::Connectivity::FindTetEdges<size_t>(tets, edges);
+    RequireList(edges, ReferenceKeys<2>(tetValues, 4, tetEdges, false));
+
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges<size_t>(tets, edges);
+    RequireList(edges, ReferenceKeys<2>(tetValues, 4, tetEdges, true));
+
+    SizeTArrayType::Pointer faces = CreateList({}, 3);
+    GeometryHelpers::Connectivity::FindTetFaces<size_t>(tets, faces);
+    RequireList(faces, ReferenceKeys<3>(tetValues, 4, tetFaces, false));
+
+    std::vector<size_t> unsharedFaces = ReferenceKeys<3>(tetValues, 4, tetFaces, true);
+    DREAM3D_REQUIRE(!unsharedFaces.empty())
+    DREAM3D_REQUIRE(unsharedFaces.size() < faces->getSize())
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces<size_t>(tets, faces);
+    RequireList(faces, unsharedFaces);
+
+    std::vector<std::vector<size_t>> referenceContaining = ReferenceElementsContainingVert(tetValues, 4, numVerts);
+    ElementDynamicList::Pointer tetsContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, size_t>(tets, tetsContainingVert, numVerts);
+    RequireDynamicList(tetsContainingVert, referenceContaining);
+
+    ElementDynamicList::Pointer tetNeighbors = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, size_t>(tets, tetsContainingVert, tetNeighbors, IGeometry::Type::Tetrahedral);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    RequireDynamicList(tetNeighbors, ReferenceElementNeighbors(tetValues, 4, referenceContaining, 3));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTetConnectivity());
+    DREAM3D_REGISTER_TEST(TestTriangleConnectivity());
+    DREAM3D_REGISTER_TEST(TestQuadConnectivity());
+    DREAM3D_REGISTER_TEST(TestHexConnectivity());
+    DREAM3D_REGISTER_TEST(TestRandomTetConnectivity());
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;      // Move assignment Not Implemented
+};
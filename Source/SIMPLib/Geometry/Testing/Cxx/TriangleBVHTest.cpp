@@ -0,0 +1,298 @@
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Geometry/TriangleBVH.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TriangleBVHTest
+{
+public:
+  TriangleBVHTest() = default;
+
+  virtual ~TriangleBVHTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void AddSphere(std::vector<float>& vertices, std::vector<size_t>& triangles, const float center[3], float radius, size_t numRings, size_t numSegments)
+  {
+    const size_t first = vertices.size() / 3;
+    const float pi = SIMPLib::Constants::k_PiF;
+    vertices.insert(vertices.end(), {center[0], center[1], center[2] + radius});
+    for(size_t ring = 1; ring < numRings; ring++)
+    {
+      const float theta = pi * static_cast<float>(ring) / static_cast<float>(numRings);
+      for(size_t segment = 0; segment < numSegments; segment++)
+      {
+        const float phi = 2.0f * pi * static_cast<float>(segment) / static_cast<float>(numSegments);
+        vertices.insert(vertices.end(), {center[0] + radius * std::sin(theta) * std::cos(phi), center[1] + radius * std::sin(theta) * std::sin(phi), center[2] + radius * std::cos(theta)});
+      }
+    }
+    vertices.insert(vertices.end(), {center[0], center[1], center[2] - radius});
+    const size_t last = vertices.size() / 3 - 1;
+
+    auto ringVertex = [&](size_t ring, size_t segment) { return first + 1 + (ring - 1) * numSegments + segment % numSegments; };
+    for(size_t segment = 0; segment < numSegments; segment++)
+    {
+      triangles.insert(triangles.end(), {first, ringVertex(1, segment), ringVertex(1, segment + 1)});
+      for(size_t ring = 1; ring + 1 < numRings; ring++)
+      {
+        triangles.insert(triangles.end(), {ringVertex(ring, segment), ringVertex(ring + 1, segment), ringVertex(ring + 1, segment + 1)});
+        triangles.insert(triangles.end(), {ringVertex(ring, segment), ringVertex(ring + 1, segment + 1), ringVertex(ring, segment + 1)});
+      }
+      triangles.insert(triangles.end(), {ringVertex(numRings - 1, segment), last, ringVertex(numRings - 1, segment + 1)});
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // A unit sphere at the origin followed by a sphere of radius 0.5 at (3, 0, 0)
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateSpheres(size_t& numFirstFaces)
+  {
+    std::vector<float> coords;
+    std::vector<size_t> indices;
+    const float center0[3] = {0.0f, 0.0f, 0.0f};
+    const float center1[3] = {3.0f, 0.0f, 0.0f};
+    AddSphere(coords, indices, center0, 1.0f, 24, 48);
+    numFirstFaces = indices.size() / 3;
+    AddSphere(coords, indices, center1, 0.5f, 16, 32);
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(coords.size() / 3);
+    std::copy(coords.begin(), coords.end(), vertices->getPointer(0));
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(indices.size() / 3, vertices, SIMPL::Geometry::TriangleGeometry);
+    std::copy(indices.begin(), indices.end(), triangles->getTriPointer(0));
+    return triangles;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<float> CreatePoints(size_t numPoints)
+  {
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> xDistribution(-1.5f, 4.0f);
+    std::uniform_real_distribution<float> distribution(-1.5f, 1.5f);
+    std::vector<float> points;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      points.insert(points.end(), {xDistribution(generator), distribution(generator), distribution(generator)});
+    }
+    return points;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPointInPolyhedron()
+  {
+    size_t numFirstFaces = 0;
+    TriangleGeom::Pointer triangles = CreateSpheres(numFirstFaces);
+    const size_t numFaces = triangles->getNumberOfTris();
+
+    // Inputs of the linear scan: the face boxes and the face list of each sphere
+    VertexGeom::Pointer faceBBs = VertexGeom::CreateGeometry(2 * numFaces, "FaceBBs");
+    for(size_t i = 0; i < numFaces; i++)
+    {
+      GeometryMath::FindBoundingBoxOfFace(triangles.get(), static_cast<int>(i), faceBBs->getVertexPointer(2 * i), faceBBs->getVertexPointer(2 * i + 1));
+    }
+    std::vector<int32_t> firstIds(numFirstFaces);
+    std::iota(firstIds.begin(), firstIds.end(), 0);
+    std::vector<int32_t> secondIds(numFaces - numFirstFaces);
+    std::iota(secondIds.begin(), secondIds.end(), static_cast<int32_t>(numFirstFaces));
+
+    TriangleBVH::Pointer first = TriangleBVH::Create(*triangles, firstIds.data(), firstIds.size());
+    TriangleBVH::Pointer second = TriangleBVH::Create(*triangles, secondIds.data(), secondIds.size());
+    DREAM3D_REQUIRE_VALID_POINTER(first.get())
+    DREAM3D_REQUIRE_VALID_POINTER(second.get())
+    DREAM3D_REQUIRE_EQUAL(first->getNumberOfFaces(), numFirstFaces)
+    DREAM3D_REQUIRE(first->getNumberOfNodes() > 1)
+
+    const std::vector<float> points = CreatePoints(1000);
+    const size_t numPoints = points.size() / 3;
+    const float radius = 10.0f;
+    std::vector<char> firstCodes = first->pointInPolyhedron(points.data(), numPoints, radius);
+    std::vector<char> secondCodes = second->pointInPolyhedron(points.data(), numPoints, radius);
+
+    std::vector<TriangleBVH::Pointer> bvhs = {first, second};
+    std::vector<std::vector<int32_t>*> faceIds = {&firstIds, &secondIds};
+    std::vector<std::vector<char>*> batchCodes = {&firstCodes, &secondCodes};
+    size_t numInside = 0;
+    for(size_t s = 0; s < 2; s++)
+    {
+      Int32Int32DynamicListArray::ElementList faceList = {static_cast<int32_t>(faceIds[s]->size()), faceIds[s]->data()};
+      float ll[3] = {0.0f, 0.0f, 0.0f};
+      float ur[3] = {0.0f, 0.0f, 0.0f};
+      bvhs[s]->getBounds(ll, ur);
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        const float* point = points.data() + 3 * i;
+        const char expected = GeometryMath::PointInPolyhedron(triangles.get(), faceList, faceBBs.get(), point, ll, ur, radius);
+        DREAM3D_REQUIRE_EQUAL(bvhs[s]->pointInPolyhedron(point, radius), expected)
+        DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvhs[s], point, radius), expected)
+        DREAM3D_REQUIRE_EQUAL((*batchCodes[s])[i], expected)
+        numInside += (expected == 'i') ? 1 : 0;
+      }
+    }
+    DREAM3D_REQUIRE(numInside > 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestClosestPoint()
+  {
+    size_t numFirstFaces = 0;
+    TriangleGeom::Pointer triangles = CreateSpheres(numFirstFaces);
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(*triangles);
+    DREAM3D_REQUIRE_VALID_POINTER(bvh.get())
+
+    const std::vector<float> points = CreatePoints(500);
+    const size_t numPoints = points.size() / 3;
+    std::vector<TriangleBVH::ClosestPoint> batch = bvh->findClosestPoint(points.data(), numPoints);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* point = points.data() + 3 * i;
+      TriangleBVH::ClosestPoint closest = bvh->findClosestPoint(point);
+      DREAM3D_REQUIRE(closest.faceId < triangles->getNumberOfTris())
+      DREAM3D_REQUIRE_EQUAL(closest.faceId, batch[i].faceId)
+
+      // The point must lie on its face and no vertex may be closer
+      float a[3], b[3], c[3];
+      triangles->getVertCoordsAtTri(closest.faceId, a, b, c);
+      float ll[3], ur[3];
+      GeometryMath::FindBoundingBoxOfFace(triangles.get(), static_cast<int>(closest.faceId), ll, ur);
+      for(size_t d = 0; d < 3; d++)
+      {
+        DREAM3D_REQUIRE(closest.point[d] >= ll[d] - 1.0e-5f && closest.point[d] <= ur[d] + 1.0e-5f)
+      }
+      float distance = 0.0f;
+      GeometryMath::FindDistanceBetweenPoints(point, closest.point.data(), distance);
+      DREAM3D_REQUIRE(std::fabs(distance - closest.distance) < 1.0e-5f)
+      for(size_t v = 0; v < triangles->getNumberOfVertices(); v++)
+      {
+        float vertexDistance = 0.0f;
+        GeometryMath::FindDistanceBetweenPoints(point, triangles->getVertexPointer(v), vertexDistance);
+        DREAM3D_REQUIRE(closest.distance <= vertexDistance + 1.0e-5f)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCastRay()
+  {
+    size_t numFirstFaces = 0;
+    TriangleGeom::Pointer triangles = CreateSpheres(numFirstFaces);
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(*triangles);
+    DREAM3D_REQUIRE_VALID_POINTER(bvh.get())
+
+    std::vector<float> segments;
+    const std::vector<float> starts = CreatePoints(300);
+    const std::vector<float> ends = CreatePoints(600);
+    for(size_t i = 0; i < starts.size() / 3; i++)
+    {
+      segments.insert(segments.end(), starts.begin() + 3 * i, starts.begin() + 3 * (i + 1));
+      segments.insert(segments.end(), ends.end() - 3 * (i + 1), ends.end() - 3 * i);
+    }
+    const size_t numSegments = segments.size() / 6;
+    std::vector<TriangleBVH::RayHit> batch = bvh->castRay(segments.data(), numSegments);
+
+    size_t numHits = 0;
+    for(size_t i = 0; i < numSegments; i++)
+    {
+      const float* q = segments.data() + 6 * i;
+      const float* r = q + 3;
+
+      // First face along the segment by scanning every face
+      size_t expected = TriangleBVH::k_InvalidId;
+      float expectedDistance = std::numeric_limits<float>::infinity();
+      float a[3], b[3], c[3], p[3];
+      for(size_t f = 0; f < triangles->getNumberOfTris(); f++)
+      {
+        triangles->getVertCoordsAtTri(f, a, b, c);
+        const char code = GeometryMath::RayIntersectsTriangle(a, b, c, q, r, p);
+        if(code == '0' || code == 'p' || code == '?')
+        {
+          continue;
+        }
+        float distance = 0.0f;
+        GeometryMath::FindDistanceBetweenPoints(q, p, distance);
+        if(distance < expectedDistance)
+        {
+          expectedDistance = distance;
+          expected = f;
+        }
+      }
+
+      TriangleBVH::RayHit hit = bvh->castRay(q, r);
+      DREAM3D_REQUIRE_EQUAL(hit.faceId, batch[i].faceId)
+      DREAM3D_REQUIRE_EQUAL(hit.faceId == TriangleBVH::k_InvalidId, expected == TriangleBVH::k_InvalidId)
+      if(expected != TriangleBVH::k_InvalidId)
+      {
+        DREAM3D_REQUIRE(std::fabs(hit.distance - expectedDistance) < 1.0e-5f)
+        numHits++;
+      }
+    }
+    DREAM3D_REQUIRE(numHits > 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleGeomCache()
+  {
+    size_t numFirstFaces = 0;
+    TriangleGeom::Pointer triangles = CreateSpheres(numFirstFaces);
+    DREAM3D_REQUIRE_NULL_POINTER(triangles->getBoundingVolumeHierarchy().get())
+    DREAM3D_REQUIRE_EQUAL(triangles->findBoundingVolumeHierarchy(), 1)
+    DREAM3D_REQUIRE_VALID_POINTER(triangles->getBoundingVolumeHierarchy().get())
+    DREAM3D_REQUIRE_EQUAL(triangles->getBoundingVolumeHierarchy()->getNumberOfFaces(), triangles->getNumberOfTris())
+
+    const float center[3] = {0.0f, 0.0f, 0.0f};
+    DREAM3D_REQUIRE_EQUAL(triangles->getBoundingVolumeHierarchy()->pointInPolyhedron(center, 10.0f), 'i')
+
+    triangles->resizeTriList(numFirstFaces);
+    DREAM3D_REQUIRE_NULL_POINTER(triangles->getBoundingVolumeHierarchy().get())
+    DREAM3D_REQUIRE_EQUAL(triangles->findBoundingVolumeHierarchy(), 1)
+    DREAM3D_REQUIRE_EQUAL(triangles->getBoundingVolumeHierarchy()->getNumberOfFaces(), numFirstFaces)
+    triangles->deleteBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE_NULL_POINTER(triangles->getBoundingVolumeHierarchy().get())
+
+    const int32_t badId = -1;
+    DREAM3D_REQUIRE_NULL_POINTER(TriangleBVH::Create(*triangles, &badId, 1).get())
+
+    TriangleGeom::Pointer empty = TriangleGeom::CreateGeometry(0, TriangleGeom::CreateSharedVertexList(0), SIMPL::Geometry::TriangleGeometry);
+    DREAM3D_REQUIRE_EQUAL(empty->findBoundingVolumeHierarchy(), 1)
+    TriangleBVH::Pointer emptyBvh = empty->getBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE_EQUAL(emptyBvh->pointInPolyhedron(center, 10.0f), 'o')
+    DREAM3D_REQUIRE_EQUAL(emptyBvh->findClosestPoint(center).faceId, TriangleBVH::k_InvalidId)
+    const float end[3] = {1.0f, 1.0f, 1.0f};
+    DREAM3D_REQUIRE_EQUAL(emptyBvh->castRay(center, end).faceId, TriangleBVH::k_InvalidId)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### TriangleBVHTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestPointInPolyhedron());
+    DREAM3D_REGISTER_TEST(TestClosestPoint());
+    DREAM3D_REGISTER_TEST(TestCastRay());
+    DREAM3D_REGISTER_TEST(TestTriangleGeomCache());
+  }
+
+private:
+  TriangleBVHTest(const TriangleBVHTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const TriangleBVHTest&) = delete;  // Move assignment Not Implemented
+};
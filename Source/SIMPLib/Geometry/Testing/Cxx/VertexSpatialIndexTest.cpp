@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class VertexSpatialIndexTest
+{
+public:
+  VertexSpatialIndexTest() = default;
+
+  virtual ~VertexSpatialIndexTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  SharedVertexList::Pointer CreateVertices(size_t numVertices, float zExtent)
+  {
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    SharedVertexList::Pointer vertices = VertexGeom::CreateSharedVertexList(numVertices);
+    for(size_t i = 0; i < numVertices; i++)
+    {
+      float* coords = vertices->getTuplePointer(i);
+      coords[0] = distribution(generator);
+      coords[1] = distribution(generator);
+      coords[2] = distribution(generator) * zExtent;
+      // Exact duplicates exercise the tie breaking by id
+      if(i % 97 == 1)
+      {
+        std::copy(coords - 3, coords, coords);
+      }
+    }
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  double SquaredDistance(const float* a, const float* b)
+  {
+    double sum = 0.0;
+    for(size_t d = 0; d < 3; d++)
+    {
+      const double delta = static_cast<double>(a[d]) - b[d];
+      sum += delta * delta;
+    }
+    return sum;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<size_t> BruteForceNearest(const SharedVertexList::Pointer& vertices, const float* point, size_t k)
+  {
+    std::vector<std::pair<double, size_t>> candidates;
+    for(size_t i = 0; i < vertices->getNumberOfTuples(); i++)
+    {
+      candidates.emplace_back(SquaredDistance(vertices->getTuplePointer(i), point), i);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<size_t> ids;
+    for(size_t i = 0; i < std::min(k, candidates.size()); i++)
+    {
+      ids.push_back(candidates[i].second);
+    }
+    return ids;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<size_t> BruteForceRadius(const SharedVertexList::Pointer& vertices, const float* point, float radius)
+  {
+    std::vector<size_t> ids;
+    for(size_t i = 0; i < vertices->getNumberOfTuples(); i++)
+    {
+      if(SquaredDistance(vertices->getTuplePointer(i), point) <= static_cast<double>(radius) * radius)
+      {
+        ids.push_back(i);
+      }
+    }
+    return ids;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<size_t> BruteForceBox(const SharedVertexList::Pointer& vertices, const float* minCoords, const float* maxCoords)
+  {
+    std::vector<size_t> ids;
+    for(size_t i = 0; i < vertices->getNumberOfTuples(); i++)
+    {
+      const float* coords = vertices->getTuplePointer(i);
+      bool inside = true;
+      for(size_t d = 0; d < 3; d++)
+      {
+        inside = inside && coords[d] >= minCoords[d] && coords[d] <= maxCoords[d];
+      }
+      if(inside)
+      {
+        ids.push_back(i);
+      }
+    }
+    return ids;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireIds(const std::vector<size_t>& ids, const std::vector<size_t>& expected)
+  {
+    DREAM3D_REQUIRE_EQUAL(ids.size(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ids[i], expected[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckQueries(float zExtent)
+  {
+    const size_t k = 7;
+    const float radius = 1.5f;
+    SharedVertexList::Pointer vertices = CreateVertices(20000, zExtent);
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::Create(vertices);
+    DREAM3D_REQUIRE_VALID_POINTER(index.get())
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfVertices(), 20000)
+
+    // Query points inside, on and well outside the cloud
+    std::vector<float> points = {0.0f, 0.0f, 0.0f, 9.5f, -9.5f, 0.0f, 25.0f, 3.0f, -40.0f, -10.0f, 10.0f, 10.0f};
+    std::copy(vertices->getTuplePointer(1), vertices->getTuplePointer(1) + 3, std::back_inserter(points));
+    const size_t numPoints = points.size() / 3;
+
+    std::vector<size_t> batchIds;
+    std::vector<float> batchDistances;
+    index->findNearestNeighbors(points.data(), numPoints, k, batchIds, batchDistances);
+    VertexSpatialIndex::QueryResults radiusResults = index->findPointsInRadius(points.data(), numPoints, radius);
+    DREAM3D_REQUIRE_EQUAL(radiusResults.offsets.size(), numPoints + 1)
+
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* point = points.data() + 3 * i;
+      std::vector<size_t> expected = BruteForceNearest(vertices, point, k);
+      std::vector<size_t> ids(k);
+      std::vector<float> distances(k);
+      DREAM3D_REQUIRE_EQUAL(index->findNearestNeighbors(point, k, ids.data(), distances.data()), k)
+      RequireIds(ids, expected);
+      RequireIds(std::vector<size_t>(batchIds.begin() + i * k, batchIds.begin() + (i + 1) * k), expected);
+      for(size_t j = 0; j < k; j++)
+      {
+        DREAM3D_COMPARE_FLOATS(&distances[j], &batchDistances[i * k + j], 4)
+      }
+
+      expected = BruteForceRadius(vertices, point, radius);
+      RequireIds(index->findPointsInRadius(point, radius), expected);
+      RequireIds(std::vector<size_t>(radiusResults.ids.begin() + radiusResults.offsets[i], radiusResults.ids.begin() + radiusResults.offsets[i + 1]), expected);
+    }
+
+    // A small box is gathered from the grid, a large one is scanned
+    std::vector<float> boxes = {-1.0f, -2.0f, -1.0f, 0.5f, 0.0f, 1.0f, -8.0f, -8.0f, -8.0f, 8.0f, 8.0f, 8.0f, 5.0f, 5.0f, 5.0f, 4.0f, 6.0f, 6.0f};
+    VertexSpatialIndex::QueryResults boxResults = index->findPointsInBox(boxes.data(), 3);
+    for(size_t i = 0; i < 3; i++)
+    {
+      const float* minCoords = boxes.data() + 6 * i;
+      const float* maxCoords = minCoords + 3;
+      std::vector<size_t> expected = BruteForceBox(vertices, minCoords, maxCoords);
+      RequireIds(index->findPointsInBox(minCoords, maxCoords), expected);
+      RequireIds(VertexSpatialIndex::FindPointsInBox(*vertices, minCoords, maxCoords), expected);
+      RequireIds(std::vector<size_t>(boxResults.ids.begin() + boxResults.offsets[i], boxResults.ids.begin() + boxResults.offsets[i + 1]), expected);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestQueries()
+  {
+    CheckQueries(1.0f);
+    // Planar cloud, which gets a single layer of cells along z
+    CheckQueries(0.0f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestVertexGeomCache()
+  {
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(CreateVertices(10, 1.0f), SIMPL::Geometry::VertexGeometry);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getSpatialIndex().get())
+    DREAM3D_REQUIRE_EQUAL(geom->findSpatialIndex(), 1)
+    DREAM3D_REQUIRE_VALID_POINTER(geom->getSpatialIndex().get())
+
+    // Asking for more neighbors than vertices leaves the remaining slots invalid
+    const float point[3] = {0.0f, 0.0f, 0.0f};
+    std::vector<size_t> ids(12);
+    DREAM3D_REQUIRE_EQUAL(geom->getSpatialIndex()->findNearestNeighbors(point, ids.size(), ids.data(), nullptr), 10)
+    DREAM3D_REQUIRE_EQUAL(ids[10], VertexSpatialIndex::k_InvalidId)
+    DREAM3D_REQUIRE_EQUAL(ids[11], VertexSpatialIndex::k_InvalidId)
+
+    VertexSpatialIndex::Pointer index = geom->getSpatialIndex();
+    geom->resizeVertexList(5);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getSpatialIndex().get())
+    DREAM3D_REQUIRE_EQUAL(index->findPointsInRadius(point, 100.0f).size(), 0)
+
+    DREAM3D_REQUIRE_EQUAL(geom->findSpatialIndex(), 1)
+    DREAM3D_REQUIRE_EQUAL(geom->getSpatialIndex()->findPointsInRadius(point, 100.0f).size(), 5)
+    geom->deleteSpatialIndex();
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getSpatialIndex().get())
+
+    // The index does not keep its vertex list alive and finds nothing once the list is deleted
+    VertexSpatialIndex::Pointer orphan = VertexSpatialIndex::Create(CreateVertices(10, 1.0f));
+    DREAM3D_REQUIRE_VALID_POINTER(orphan.get())
+    DREAM3D_REQUIRE_EQUAL(orphan->findPointsInRadius(point, 100.0f).size(), 0)
+
+    VertexGeom::Pointer empty = VertexGeom::CreateGeometry(0, SIMPL::Geometry::VertexGeometry);
+    DREAM3D_REQUIRE_EQUAL(empty->findSpatialIndex(), 1)
+    DREAM3D_REQUIRE_EQUAL(empty->getSpatialIndex()->findNearestNeighbors(point, ids.size(), ids.data(), nullptr), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### VertexSpatialIndexTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestQueries());
+    DREAM3D_REGISTER_TEST(TestVertexGeomCache());
+  }
+
+private:
+  VertexSpatialIndexTest(const VertexSpatialIndexTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VertexSpatialIndexTest&) = delete;         // Move assignment Not Implemented
+};
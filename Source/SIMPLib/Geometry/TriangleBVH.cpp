@@ -0,0 +1,1080 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "TriangleBVH.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <thread>
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Ranges of at most this many faces always become a leaf
+ */
+const uint32_t k_MaxLeafSize = 4;
+
+/**
+ * @brief Ranges of at most this many faces become a leaf when no split is cheaper than testing them all
+ */
+const uint32_t k_MaxSahLeafSize = 16;
+
+/**
+ * @brief Number of centroid bins the split candidates are evaluated on
+ */
+const size_t k_NumBins = 16;
+
+/**
+ * @brief Smallest number of faces worth a chunk of its own when binning or copying
+ */
+const size_t k_MinFacesPerChunk = 16384;
+
+/**
+ * @brief The top of the tree is split until its ranges are this small (or a fraction of the faces
+ * per thread), then the subtrees below are built concurrently
+ */
+const size_t k_MinSubtreeSize = 4096;
+const size_t k_SubtreesPerThread = 4;
+
+/**
+ * @brief Relative amount the node boxes are grown by so that rounding in the segment/box test never
+ * skips a face the exact per face test would reach
+ */
+const float k_BoxPadding = 1.0e-5f;
+
+/**
+ * @brief Base seed of the random rays of the batched point in polyhedron query
+ */
+const uint64_t k_RaySeed = 5489u;
+
+// -----------------------------------------------------------------------------
+size_t ChunkCount(size_t numItems, size_t minItemsPerChunk)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  size_t numChunks = std::max(std::thread::hardware_concurrency(), 1U);
+  numChunks = std::min(numChunks, numItems / minItemsPerChunk);
+  return std::max(numChunks, size_t(1));
+#else
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+size_t ChunkBegin(size_t numItems, size_t chunk, size_t numChunks)
+{
+  return numItems * chunk / numChunks;
+}
+
+/**
+ * @brief Axis aligned box that starts out empty
+ */
+struct Bounds
+{
+  std::array<float, 3> lower = {{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()}};
+  std::array<float, 3> upper = {{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()}};
+
+  void grow(const float* minCoords, const float* maxCoords)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      lower[a] = std::min(lower[a], minCoords[a]);
+      upper[a] = std::max(upper[a], maxCoords[a]);
+    }
+  }
+
+  void grow(const Bounds& other)
+  {
+    grow(other.lower.data(), other.upper.data());
+  }
+
+  float halfArea() const
+  {
+    if(lower[0] > upper[0])
+    {
+      return 0.0f;
+    }
+    const float dx = upper[0] - lower[0];
+    const float dy = upper[1] - lower[1];
+    const float dz = upper[2] - lower[2];
+    return dx * dy + dy * dz + dz * dx;
+  }
+};
+
+// -----------------------------------------------------------------------------
+void FaceBounds(const float* coords, float* ll, float* ur)
+{
+  for(size_t a = 0; a < 3; a++)
+  {
+    ll[a] = std::min(std::min(coords[a], coords[3 + a]), coords[6 + a]);
+    ur[a] = std::max(std::max(coords[a], coords[3 + a]), coords[6 + a]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Same distribution as GeometryMath::GenerateRandomRay, drawn from the caller's generator
+void GenerateRandomRay(std::mt19937_64& generator, float length, float* ray)
+{
+  std::uniform_real_distribution<> distribution(0.0, 1.0);
+
+  float rand1 = distribution(generator);
+  float rand2 = distribution(generator);
+
+  ray[2] = (2.0f * rand1) - 1.0f;
+  float t = SIMPLib::Constants::k_2PiF * rand2;
+  float w = std::sqrt(1.0f - (ray[2] * ray[2]));
+  ray[0] = w * std::cos(t) * length;
+  ray[1] = w * std::sin(t) * length;
+  ray[2] *= length;
+}
+
+// -----------------------------------------------------------------------------
+bool IsDegenerateCode(char code)
+{
+  return code == 'p' || code == 'v' || code == 'e' || code == '?';
+}
+
+// -----------------------------------------------------------------------------
+// Clips the segment origin + t * direction, t in [0, 1], against the box
+bool SegmentHitsBox(const std::array<float, 3>& lower, const std::array<float, 3>& upper, const double origin[3], const double direction[3], double& tEntry)
+{
+  double tMin = 0.0;
+  double tMax = 1.0;
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(direction[a] == 0.0)
+    {
+      if(origin[a] < lower[a] || origin[a] > upper[a])
+      {
+        return false;
+      }
+      continue;
+    }
+    double t0 = (lower[a] - origin[a]) / direction[a];
+    double t1 = (upper[a] - origin[a]) / direction[a];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return false;
+    }
+  }
+  tEntry = tMin;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+double SquaredDistanceToBox(const std::array<float, 3>& lower, const std::array<float, 3>& upper, const float* point)
+{
+  double sum = 0.0;
+  for(size_t a = 0; a < 3; a++)
+  {
+    double delta = 0.0;
+    if(point[a] < lower[a])
+    {
+      delta = static_cast<double>(lower[a]) - point[a];
+    }
+    else if(point[a] > upper[a])
+    {
+      delta = static_cast<double>(point[a]) - upper[a];
+    }
+    sum += delta * delta;
+  }
+  return sum;
+}
+
+// -----------------------------------------------------------------------------
+double Dot(const double* a, const double* b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// -----------------------------------------------------------------------------
+double SafeRatio(double numerator, double denominator)
+{
+  return denominator != 0.0 ? numerator / denominator : 0.0;
+}
+
+// -----------------------------------------------------------------------------
+// Closest point on the triangle abc to p by Voronoi region of the triangle features
+void ClosestPointOnTriangle(const float* a, const float* b, const float* c, const float* p, double* closest)
+{
+  double ab[3], ac[3], ap[3], bp[3], cp[3];
+  for(size_t i = 0; i < 3; i++)
+  {
+    ab[i] = static_cast<double>(b[i]) - a[i];
+    ac[i] = static_cast<double>(c[i]) - a[i];
+    ap[i] = static_cast<double>(p[i]) - a[i];
+    bp[i] = static_cast<double>(p[i]) - b[i];
+    cp[i] = static_cast<double>(p[i]) - c[i];
+  }
+  auto assign = [&](const float* origin, const double* edge, double s) {
+    for(size_t i = 0; i < 3; i++)
+    {
+      closest[i] = origin[i] + s * edge[i];
+    }
+  };
+
+  const double d1 = Dot(ab, ap);
+  const double d2 = Dot(ac, ap);
+  if(d1 <= 0.0 && d2 <= 0.0)
+  {
+    assign(a, ab, 0.0);
+    return;
+  }
+  const double d3 = Dot(ab, bp);
+  const double d4 = Dot(ac, bp);
+  if(d3 >= 0.0 && d4 <= d3)
+  {
+    assign(b, ab, 0.0);
+    return;
+  }
+  const double vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+  {
+    assign(a, ab, SafeRatio(d1, d1 - d3));
+    return;
+  }
+  const double d5 = Dot(ab, cp);
+  const double d6 = Dot(ac, cp);
+  if(d6 >= 0.0 && d5 <= d6)
+  {
+    assign(c, ac, 0.0);
+    return;
+  }
+  const double vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+  {
+    assign(a, ac, SafeRatio(d2, d2 - d6));
+    return;
+  }
+  const double va = d3 * d6 - d5 * d4;
+  if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+  {
+    const double bc[3] = {static_cast<double>(c[0]) - b[0], static_cast<double>(c[1]) - b[1], static_cast<double>(c[2]) - b[2]};
+    assign(b, bc, SafeRatio(d4 - d3, (d4 - d3) + (d5 - d6)));
+    return;
+  }
+  const double v = SafeRatio(vb, va + vb + vc);
+  const double w = SafeRatio(vc, va + vb + vc);
+  for(size_t i = 0; i < 3; i++)
+  {
+    closest[i] = a[i] + ab[i] * v + ac[i] * w;
+  }
+}
+} // namespace
+
+/**
+ * @brief Builds the nodes over the face boxes. Ranges are split on the centroid axis of largest
+ * extent at the cheapest of the binned surface area heuristic candidates.
+ */
+class TriangleBVH::Builder
+{
+public:
+  struct Task
+  {
+    uint32_t node;
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  Builder(const float* coords, size_t numFaces)
+  : m_NumFaces(numFaces)
+  , m_Lower(3 * numFaces)
+  , m_Upper(3 * numFaces)
+  , m_Centroids(3 * numFaces)
+  , m_Order(numFaces)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numFaces);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        FaceBounds(coords + 9 * i, m_Lower.data() + 3 * i, m_Upper.data() + 3 * i);
+        for(size_t a = 0; a < 3; a++)
+        {
+          m_Centroids[3 * i + a] = 0.5f * (m_Lower[3 * i + a] + m_Upper[3 * i + a]);
+        }
+        m_Order[i] = static_cast<uint32_t>(i);
+      }
+    });
+  }
+
+  std::vector<Node> build()
+  {
+    std::vector<Node> nodes(1);
+    std::vector<Task> tasks = {{0, 0, static_cast<uint32_t>(m_NumFaces)}};
+    std::vector<Task> deferred;
+    const size_t numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    const size_t deferSize = std::max(k_MinSubtreeSize, m_NumFaces / (k_SubtreesPerThread * numThreads));
+    split(nodes, tasks, &deferred, deferSize, true);
+
+    // The subtrees cover disjoint ranges of the face order, so they are built concurrently into
+    // their own node lists and appended afterwards
+    std::vector<std::vector<Node>> subtrees(deferred.size());
+    ParallelDataAlgorithm subtreeAlg;
+    subtreeAlg.setRange(0, deferred.size());
+    subtreeAlg.execute([&](const SIMPLRange& range) {
+      for(size_t s = range.min(); s < range.max(); s++)
+      {
+        subtrees[s].resize(1);
+        std::vector<Task> subtreeTasks = {{0, deferred[s].begin, deferred[s].end}};
+        split(subtrees[s], subtreeTasks, nullptr, 0, false);
+      }
+    });
+
+    for(size_t s = 0; s < deferred.size(); s++)
+    {
+      const std::vector<Node>& local = subtrees[s];
+      // Local node j > 0 lands at base + j
+      const uint32_t base = static_cast<uint32_t>(nodes.size() - 1);
+      auto relocate = [base](Node node) {
+        if(node.count == 0)
+        {
+          node.offset += base;
+        }
+        return node;
+      };
+      nodes[deferred[s].node] = relocate(local[0]);
+      for(size_t j = 1; j < local.size(); j++)
+      {
+        nodes.push_back(relocate(local[j]));
+      }
+    }
+    return nodes;
+  }
+
+  const std::vector<uint32_t>& getOrder() const
+  {
+    return m_Order;
+  }
+
+private:
+  size_t m_NumFaces = 0;
+  std::vector<float> m_Lower;
+  std::vector<float> m_Upper;
+  std::vector<float> m_Centroids;
+  std::vector<uint32_t> m_Order;
+
+  void split(std::vector<Node>& nodes, std::vector<Task>& tasks, std::vector<Task>* deferred, size_t deferSize, bool parallel)
+  {
+    while(!tasks.empty())
+    {
+      const Task task = tasks.back();
+      tasks.pop_back();
+      const uint32_t count = task.end - task.begin;
+      if(deferred != nullptr && count <= deferSize)
+      {
+        deferred->push_back(task);
+        continue;
+      }
+
+      Bounds bounds;
+      const uint32_t mid = partition(task.begin, task.end, parallel && count >= 2 * k_MinFacesPerChunk, bounds);
+      Node& node = nodes[task.node];
+      node.lower = bounds.lower;
+      node.upper = bounds.upper;
+      if(mid == task.begin)
+      {
+        node.offset = task.begin;
+        node.count = count;
+        continue;
+      }
+      const uint32_t left = static_cast<uint32_t>(nodes.size());
+      node.offset = left;
+      node.count = 0;
+      nodes.resize(nodes.size() + 2);
+      // Left is popped first so its nodes come first
+      tasks.push_back({left + 1, mid, task.end});
+      tasks.push_back({left, task.begin, mid});
+    }
+  }
+
+  /**
+   * @brief Partitions the range and returns the first face of the right half, or begin if the
+   * range should stay a leaf
+   */
+  uint32_t partition(uint32_t begin, uint32_t end, bool parallel, Bounds& bounds)
+  {
+    const size_t count = end - begin;
+    const size_t numChunks = parallel ? ChunkCount(count, k_MinFacesPerChunk) : 1;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(numChunks > 1);
+    dataAlg.setRange(0, numChunks);
+
+    std::vector<Bounds> chunkBounds(numChunks);
+    std::vector<Bounds> chunkCentroids(numChunks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        const size_t last = begin + ChunkBegin(count, chunk + 1, numChunks);
+        for(size_t i = begin + ChunkBegin(count, chunk, numChunks); i < last; i++)
+        {
+          const uint32_t face = m_Order[i];
+          chunkBounds[chunk].grow(m_Lower.data() + 3 * face, m_Upper.data() + 3 * face);
+          chunkCentroids[chunk].grow(m_Centroids.data() + 3 * face, m_Centroids.data() + 3 * face);
+        }
+      }
+    });
+    Bounds centroidBounds;
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      bounds.grow(chunkBounds[chunk]);
+      centroidBounds.grow(chunkCentroids[chunk]);
+    }
+    if(count <= k_MaxLeafSize)
+    {
+      return begin;
+    }
+
+    size_t axis = 0;
+    for(size_t a = 1; a < 3; a++)
+    {
+      if(centroidBounds.upper[a] - centroidBounds.lower[a] > centroidBounds.upper[axis] - centroidBounds.lower[axis])
+      {
+        axis = a;
+      }
+    }
+    const float extent = centroidBounds.upper[axis] - centroidBounds.lower[axis];
+    if(!(extent > 0.0f))
+    {
+      // All centroids coincide, so no split separates the faces; halve large ranges anyway
+      return count <= k_MaxSahLeafSize ? begin : begin + static_cast<uint32_t>(count / 2);
+    }
+
+    const float origin = centroidBounds.lower[axis];
+    const float scale = static_cast<float>(k_NumBins) / extent;
+    auto findBin = [&](uint32_t face) { return std::min(static_cast<size_t>((m_Centroids[3 * face + axis] - origin) * scale), k_NumBins - 1); };
+
+    std::vector<std::array<size_t, k_NumBins>> chunkCounts(numChunks);
+    std::vector<std::array<Bounds, k_NumBins>> chunkBins(numChunks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        chunkCounts[chunk].fill(0);
+        const size_t last = begin + ChunkBegin(count, chunk + 1, numChunks);
+        for(size_t i = begin + ChunkBegin(count, chunk, numChunks); i < last; i++)
+        {
+          const uint32_t face = m_Order[i];
+          const size_t bin = findBin(face);
+          chunkCounts[chunk][bin]++;
+          chunkBins[chunk][bin].grow(m_Lower.data() + 3 * face, m_Upper.data() + 3 * face);
+        }
+      }
+    });
+    std::array<size_t, k_NumBins> binCounts = chunkCounts[0];
+    std::array<Bounds, k_NumBins> binBounds = chunkBins[0];
+    for(size_t chunk = 1; chunk < numChunks; chunk++)
+    {
+      for(size_t b = 0; b < k_NumBins; b++)
+      {
+        binCounts[b] += chunkCounts[chunk][b];
+        binBounds[b].grow(chunkBins[chunk][b]);
+      }
+    }
+
+    // Sweep from the right for the right side areas, then from the left for the split costs
+    std::array<float, k_NumBins> rightAreas;
+    Bounds right;
+    for(size_t b = k_NumBins - 1; b > 0; b--)
+    {
+      right.grow(binBounds[b]);
+      rightAreas[b] = right.halfArea();
+    }
+    Bounds left;
+    size_t leftCount = 0;
+    size_t bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::infinity();
+    for(size_t b = 1; b < k_NumBins; b++)
+    {
+      left.grow(binBounds[b - 1]);
+      leftCount += binCounts[b - 1];
+      const size_t rightCount = count - leftCount;
+      if(leftCount == 0 || rightCount == 0)
+      {
+        continue;
+      }
+      const float cost = left.halfArea() * static_cast<float>(leftCount) + rightAreas[b] * static_cast<float>(rightCount);
+      if(cost < bestCost)
+      {
+        bestCost = cost;
+        bestSplit = b;
+      }
+    }
+
+    if(bestSplit == 0)
+    {
+      const uint32_t mid = begin + static_cast<uint32_t>(count / 2);
+      std::nth_element(m_Order.begin() + begin, m_Order.begin() + mid, m_Order.begin() + end,
+                       [&](uint32_t lhs, uint32_t rhs) { return m_Centroids[3 * lhs + axis] < m_Centroids[3 * rhs + axis]; });
+      return mid;
+    }
+
+    // Cost of visiting the node plus testing each half, against testing every face here
+    const float area = bounds.halfArea();
+    const float splitCost = area > 0.0f ? 1.0f + bestCost / area : 0.0f;
+    if(count <= k_MaxSahLeafSize && splitCost >= static_cast<float>(count))
+    {
+      return begin;
+    }
+    auto middle = std::partition(m_Order.begin() + begin, m_Order.begin() + end, [&](uint32_t face) { return findBin(face) < bestSplit; });
+    return static_cast<uint32_t>(middle - m_Order.begin());
+  }
+};
+
+const size_t TriangleBVH::k_InvalidId = std::numeric_limits<size_t>::max();
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::Create(const TriangleGeom& triangles)
+{
+  if(triangles.getTriangles().get() == nullptr)
+  {
+    return NullPointer();
+  }
+  std::vector<size_t> faceIds(triangles.getNumberOfTris());
+  std::iota(faceIds.begin(), faceIds.end(), size_t(0));
+  return CreateFromFaces(triangles, std::move(faceIds));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::Create(const TriangleGeom& triangles, const int32_t* faceIds, size_t numFaces)
+{
+  if(triangles.getTriangles().get() == nullptr || (faceIds == nullptr && numFaces > 0))
+  {
+    return NullPointer();
+  }
+  const size_t numTris = triangles.getNumberOfTris();
+  std::vector<size_t> ids(numFaces);
+  for(size_t i = 0; i < numFaces; i++)
+  {
+    if(faceIds[i] < 0 || static_cast<size_t>(faceIds[i]) >= numTris)
+    {
+      return NullPointer();
+    }
+    ids[i] = static_cast<size_t>(faceIds[i]);
+  }
+  return CreateFromFaces(triangles, std::move(ids));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::CreateFromFaces(const TriangleGeom& triangles, std::vector<size_t> faceIds)
+{
+  SharedVertexList::Pointer vertices = triangles.getVertices();
+  SharedTriList::Pointer tris = triangles.getTriangles();
+  // Node offsets are 32 bit and a tree has fewer than twice as many nodes as faces
+  if(vertices.get() == nullptr || tris.get() == nullptr || faceIds.size() >= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+  {
+    return NullPointer();
+  }
+
+  Pointer bvh(new TriangleBVH());
+  bvh->m_Vertices = vertices;
+  bvh->m_Triangles = tris;
+  bvh->m_NumVertices = vertices->getNumberOfTuples();
+  bvh->m_NumTriangles = tris->getNumberOfTuples();
+  bvh->m_FaceIds = std::move(faceIds);
+  bvh->m_Coords.resize(9 * bvh->m_FaceIds.size());
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, bvh->m_FaceIds.size());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      triangles.getVertCoordsAtTri(bvh->m_FaceIds[i], &bvh->m_Coords[9 * i], &bvh->m_Coords[9 * i + 3], &bvh->m_Coords[9 * i + 6]);
+    }
+  });
+
+  bvh->build();
+  return bvh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::build()
+{
+  m_Nodes.clear();
+  const size_t numFaces = m_FaceIds.size();
+  m_Positions.resize(numFaces);
+  if(numFaces == 0)
+  {
+    return;
+  }
+
+  Builder builder(m_Coords.data(), numFaces);
+  m_Nodes = builder.build();
+  const std::vector<uint32_t>& order = builder.getOrder();
+  m_Lower = m_Nodes[0].lower;
+  m_Upper = m_Nodes[0].upper;
+
+  std::vector<float> coords(m_Coords.size());
+  std::vector<size_t> faceIds(numFaces);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numFaces);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      std::copy(m_Coords.begin() + 9 * order[i], m_Coords.begin() + 9 * (order[i] + 1), coords.begin() + 9 * i);
+      faceIds[i] = m_FaceIds[order[i]];
+      m_Positions[i] = order[i];
+    }
+  });
+  m_Coords.swap(coords);
+  m_FaceIds.swap(faceIds);
+
+  ParallelDataAlgorithm nodeAlg;
+  nodeAlg.setRange(0, m_Nodes.size());
+  nodeAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      Node& node = m_Nodes[i];
+      for(size_t a = 0; a < 3; a++)
+      {
+        const float padding = k_BoxPadding * (std::fabs(node.lower[a]) + std::fabs(node.upper[a])) + std::numeric_limits<float>::min();
+        node.lower[a] -= padding;
+        node.upper[a] += padding;
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleBVH::isValidFor(const SharedVertexList::Pointer& vertices, const SharedTriList::Pointer& triangles) const
+{
+  return vertices.get() != nullptr && triangles.get() != nullptr && vertices == m_Vertices && triangles == m_Triangles && vertices->getNumberOfTuples() == m_NumVertices &&
+         triangles->getNumberOfTuples() == m_NumTriangles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfFaces() const
+{
+  return m_FaceIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfNodes() const
+{
+  return m_Nodes.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  std::copy(m_Lower.begin(), m_Lower.end(), lowerLeft);
+  std::copy(m_Upper.begin(), m_Upper.end(), upperRight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const float* TriangleBVH::getFaceCoords(size_t index) const
+{
+  return m_Coords.data() + 9 * index;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::pointInPolyhedron(const float point[3], float radius) const
+{
+  std::mt19937_64 generator(static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count()));
+  std::vector<uint32_t> stack;
+  std::vector<uint32_t> candidates;
+  return classifyPoint(point, radius, generator, stack, candidates);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<char> TriangleBVH::pointInPolyhedron(const float* points, size_t numPoints, float radius) const
+{
+  std::vector<char> codes(numPoints, 'o');
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<uint32_t> stack;
+    std::vector<uint32_t> candidates;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      std::mt19937_64 generator(k_RaySeed + i);
+      codes[i] = classifyPoint(points + 3 * i, radius, generator, stack, candidates);
+    }
+  });
+  return codes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::classifyPoint(const float point[3], float radius, std::mt19937_64& generator, std::vector<uint32_t>& stack, std::vector<uint32_t>& candidates) const
+{
+  // Follows GeometryMath::PointInPolyhedron, but only tests the faces the hierarchy finds near
+  // the ray, in the order of the face list so that the first V/E/F or degenerate face is the same
+  if(m_Nodes.empty() || !GeometryMath::PointInBox(point, m_Lower.data(), m_Upper.data()))
+  {
+    return 'o';
+  }
+
+  const size_t numFaces = m_FaceIds.size();
+  float ray[3] = {0.0f, 0.0f, 0.0f};
+  float r[3] = {0.0f, 0.0f, 0.0f};
+  float p[3] = {0.0f, 0.0f, 0.0f};
+  float ll[3] = {0.0f, 0.0f, 0.0f};
+  float ur[3] = {0.0f, 0.0f, 0.0f};
+  size_t k = 0;
+  size_t crossings = 0;
+
+  while(k++ < numFaces)
+  {
+    crossings = 0;
+    GenerateRandomRay(generator, radius, ray);
+    r[0] = point[0] + ray[0];
+    r[1] = point[1] + ray[1];
+    r[2] = point[2] + ray[2];
+
+    const double origin[3] = {point[0], point[1], point[2]};
+    const double direction[3] = {static_cast<double>(r[0]) - point[0], static_cast<double>(r[1]) - point[1], static_cast<double>(r[2]) - point[2]};
+    candidates.clear();
+    stack.assign(1, 0);
+    while(!stack.empty())
+    {
+      const Node& node = m_Nodes[stack.back()];
+      stack.pop_back();
+      double tEntry = 0.0;
+      if(!SegmentHitsBox(node.lower, node.upper, origin, direction, tEntry))
+      {
+        continue;
+      }
+      if(node.count == 0)
+      {
+        stack.push_back(node.offset + 1);
+        stack.push_back(node.offset);
+        continue;
+      }
+      for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+      {
+        FaceBounds(getFaceCoords(i), ll, ur);
+        if(GeometryMath::RayIntersectsBox(point, r, ll, ur))
+        {
+          candidates.push_back(i);
+        }
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](uint32_t lhs, uint32_t rhs) { return m_Positions[lhs] < m_Positions[rhs]; });
+
+    bool degenerate = false;
+    for(uint32_t i : candidates)
+    {
+      const float* coords = getFaceCoords(i);
+      const char code = GeometryMath::RayIntersectsTriangle(coords, coords + 3, coords + 6, point, r, p);
+      if(IsDegenerateCode(code))
+      {
+        degenerate = true;
+        break;
+      }
+      if(code == 'f')
+      {
+        crossings++;
+      }
+      else if(code == 'V' || code == 'E' || code == 'F')
+      {
+        return code;
+      }
+    }
+    if(!degenerate)
+    {
+      break;
+    }
+  }
+
+  return (crossings % 2) == 1 ? 'i' : 'o';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::ClosestPoint TriangleBVH::findClosestPoint(const float point[3]) const
+{
+  std::vector<std::pair<uint32_t, double>> stack;
+  return searchClosestPoint(point, stack);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<TriangleBVH::ClosestPoint> TriangleBVH::findClosestPoint(const float* points, size_t numPoints) const
+{
+  std::vector<ClosestPoint> results(numPoints);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<std::pair<uint32_t, double>> stack;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      results[i] = searchClosestPoint(points + 3 * i, stack);
+    }
+  });
+  return results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::ClosestPoint TriangleBVH::searchClosestPoint(const float point[3], std::vector<std::pair<uint32_t, double>>& stack) const
+{
+  ClosestPoint result;
+  result.distance = std::numeric_limits<float>::infinity();
+  if(m_Nodes.empty())
+  {
+    return result;
+  }
+
+  // Depth first with the nearer child visited first; a node is skipped once its box is farther
+  // than the best face found so far
+  double best = std::numeric_limits<double>::infinity();
+  uint32_t bestIndex = 0;
+  double bestPoint[3] = {0.0, 0.0, 0.0};
+  double closest[3] = {0.0, 0.0, 0.0};
+  stack.clear();
+  stack.emplace_back(0, SquaredDistanceToBox(m_Nodes[0].lower, m_Nodes[0].upper, point));
+  while(!stack.empty())
+  {
+    const std::pair<uint32_t, double> entry = stack.back();
+    stack.pop_back();
+    if(entry.second > best)
+    {
+      continue;
+    }
+    const Node& node = m_Nodes[entry.first];
+    if(node.count == 0)
+    {
+      const Node& left = m_Nodes[node.offset];
+      const Node& right = m_Nodes[node.offset + 1];
+      const double leftDistance = SquaredDistanceToBox(left.lower, left.upper, point);
+      const double rightDistance = SquaredDistanceToBox(right.lower, right.upper, point);
+      if(leftDistance <= rightDistance)
+      {
+        stack.emplace_back(node.offset + 1, rightDistance);
+        stack.emplace_back(node.offset, leftDistance);
+      }
+      else
+      {
+        stack.emplace_back(node.offset, leftDistance);
+        stack.emplace_back(node.offset + 1, rightDistance);
+      }
+      continue;
+    }
+    for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+    {
+      const float* coords = getFaceCoords(i);
+      ClosestPointOnTriangle(coords, coords + 3, coords + 6, point, closest);
+      double distance = 0.0;
+      for(size_t a = 0; a < 3; a++)
+      {
+        const double delta = closest[a] - point[a];
+        distance += delta * delta;
+      }
+      if(distance < best || (distance == best && m_Positions[i] < m_Positions[bestIndex]))
+      {
+        best = distance;
+        bestIndex = i;
+        std::copy(closest, closest + 3, bestPoint);
+      }
+    }
+  }
+
+  if(best < std::numeric_limits<double>::infinity())
+  {
+    result.faceId = m_FaceIds[bestIndex];
+    result.distance = static_cast<float>(std::sqrt(best));
+    for(size_t a = 0; a < 3; a++)
+    {
+      result.point[a] = static_cast<float>(bestPoint[a]);
+    }
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::RayHit TriangleBVH::castRay(const float q[3], const float r[3]) const
+{
+  std::vector<std::pair<uint32_t, double>> stack;
+  return searchRay(q, r, stack);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<TriangleBVH::RayHit> TriangleBVH::castRay(const float* segments, size_t numSegments) const
+{
+  std::vector<RayHit> results(numSegments);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSegments);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<std::pair<uint32_t, double>> stack;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      results[i] = searchRay(segments + 6 * i, segments + 6 * i + 3, stack);
+    }
+  });
+  return results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::RayHit TriangleBVH::searchRay(const float q[3], const float r[3], std::vector<std::pair<uint32_t, double>>& stack) const
+{
+  RayHit result;
+  result.distance = std::numeric_limits<float>::infinity();
+  if(m_Nodes.empty())
+  {
+    return result;
+  }
+
+  const double origin[3] = {q[0], q[1], q[2]};
+  const double direction[3] = {static_cast<double>(r[0]) - q[0], static_cast<double>(r[1]) - q[1], static_cast<double>(r[2]) - q[2]};
+  const double lengthSquared = Dot(direction, direction);
+  double bestT = std::numeric_limits<double>::infinity();
+  uint32_t bestIndex = 0;
+  float p[3] = {0.0f, 0.0f, 0.0f};
+
+  double tEntry = 0.0;
+  stack.clear();
+  if(SegmentHitsBox(m_Nodes[0].lower, m_Nodes[0].upper, origin, direction, tEntry))
+  {
+    stack.emplace_back(0, tEntry);
+  }
+  while(!stack.empty())
+  {
+    const std::pair<uint32_t, double> entry = stack.back();
+    stack.pop_back();
+    if(entry.second > bestT)
+    {
+      continue;
+    }
+    const Node& node = m_Nodes[entry.first];
+    if(node.count == 0)
+    {
+      double leftEntry = 0.0;
+      double rightEntry = 0.0;
+      const bool hitsLeft = SegmentHitsBox(m_Nodes[node.offset].lower, m_Nodes[node.offset].upper, origin, direction, leftEntry);
+      const bool hitsRight = SegmentHitsBox(m_Nodes[node.offset + 1].lower, m_Nodes[node.offset + 1].upper, origin, direction, rightEntry);
+      // Push the farther child first so the nearer one is visited first
+      if(hitsLeft && hitsRight && leftEntry > rightEntry)
+      {
+        stack.emplace_back(node.offset, leftEntry);
+        stack.emplace_back(node.offset + 1, rightEntry);
+        continue;
+      }
+      if(hitsRight)
+      {
+        stack.emplace_back(node.offset + 1, rightEntry);
+      }
+      if(hitsLeft)
+      {
+        stack.emplace_back(node.offset, leftEntry);
+      }
+      continue;
+    }
+    for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+    {
+      const float* coords = getFaceCoords(i);
+      const char code = GeometryMath::RayIntersectsTriangle(coords, coords + 3, coords + 6, q, r, p);
+      if(code == '0' || code == 'p' || code == '?')
+      {
+        continue;
+      }
+      const double offset[3] = {static_cast<double>(p[0]) - q[0], static_cast<double>(p[1]) - q[1], static_cast<double>(p[2]) - q[2]};
+      const double t = lengthSquared > 0.0 ? Dot(offset, direction) / lengthSquared : 0.0;
+      if(t < bestT || (t == bestT && m_Positions[i] < m_Positions[bestIndex]))
+      {
+        bestT = t;
+        bestIndex = i;
+        result.code = code;
+        std::copy(p, p + 3, result.point.begin());
+      }
+    }
+  }
+
+  if(bestT < std::numeric_limits<double>::infinity())
+  {
+    result.faceId = m_FaceIds[bestIndex];
+    const double offset[3] = {static_cast<double>(result.point[0]) - q[0], static_cast<double>(result.point[1]) - q[1], static_cast<double>(result.point[2]) - q[2]};
+    result.distance = static_cast<float>(std::sqrt(Dot(offset, offset)));
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
@@ -0,0 +1,251 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+class TriangleGeom;
+
+/**
+ * @brief The TriangleBVH class is a bounding volume hierarchy over the triangles of a TriangleGeom, or
+ * over a subset of them such as the faces of one feature. It is built with binned surface area
+ * heuristic splits; the top of the tree is split with parallel binning and the subtrees below it are
+ * built concurrently. The nodes are stored in a flat array with the two children of a node next to
+ * each other, and the triangle coordinates are copied in leaf order so a leaf reads contiguous memory.
+ *
+ * The queries give the same answers as GeometryMath::PointInPolyhedron and
+ * GeometryMath::RayIntersectsTriangle applied to every face, but only test the faces whose boxes the
+ * query reaches. The index copies the coordinates, so moving vertices requires building a new index.
+ * All queries are const and may be called from several threads at once; the batched queries
+ * parallelize over the query points themselves.
+ */
+class SIMPLib_EXPORT TriangleBVH
+{
+public:
+  using Self = TriangleBVH;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Face id reported when a query finds no face
+   */
+  static const size_t k_InvalidId;
+
+  /**
+   * @brief Closest point on the surface to a query point
+   */
+  struct ClosestPoint
+  {
+    size_t faceId = k_InvalidId;
+    std::array<float, 3> point = {{0.0f, 0.0f, 0.0f}};
+    float distance = 0.0f;
+  };
+
+  /**
+   * @brief First face hit by a segment. The code is the one GeometryMath::RayIntersectsTriangle
+   * returns for that face and the distance is measured from the start of the segment.
+   */
+  struct RayHit
+  {
+    size_t faceId = k_InvalidId;
+    char code = '0';
+    std::array<float, 3> point = {{0.0f, 0.0f, 0.0f}};
+    float distance = 0.0f;
+  };
+
+  /**
+   * @brief Builds the hierarchy over all the triangles of the geometry in parallel
+   * @param triangles
+   * @return
+   */
+  static Pointer Create(const TriangleGeom& triangles);
+
+  /**
+   * @brief Builds the hierarchy over the listed triangles of the geometry in parallel. The faces
+   * keep their ids in the geometry, and their position in the list decides which face is reported
+   * first when several qualify, as in GeometryMath::PointInPolyhedron.
+   * @param triangles
+   * @param faceIds
+   * @param numFaces
+   * @return
+   */
+  static Pointer Create(const TriangleGeom& triangles, const int32_t* faceIds, size_t numFaces);
+
+  ~TriangleBVH();
+
+  /**
+   * @brief Returns true if the hierarchy was built from these lists and they still have the same
+   * number of vertices and triangles
+   * @param vertices
+   * @param triangles
+   * @return
+   */
+  bool isValidFor(const SharedVertexList::Pointer& vertices, const SharedTriList::Pointer& triangles) const;
+
+  /**
+   * @brief getNumberOfFaces
+   * @return
+   */
+  size_t getNumberOfFaces() const;
+
+  /**
+   * @brief getNumberOfNodes
+   * @return
+   */
+  size_t getNumberOfNodes() const;
+
+  /**
+   * @brief Returns the bounding box of the faces
+   * @param lowerLeft
+   * @param upperRight
+   */
+  void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+  /**
+   * @brief Determines if a point is inside of the closed surface formed by the faces. Returns the
+   * same codes as GeometryMath::PointInPolyhedron: 'i' or 'o', or 'V', 'E' or 'F' if the point sits
+   * on a vertex, edge or face.
+   * @param point
+   * @param radius Length of the random rays cast from the point; must reach outside the surface
+   * @return
+   */
+  char pointInPolyhedron(const float point[3], float radius) const;
+
+  /**
+   * @brief Classifies every query point in parallel. Each point draws its random rays from a
+   * generator seeded with its index, so the results are reproducible.
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param radius
+   * @return
+   */
+  std::vector<char> pointInPolyhedron(const float* points, size_t numPoints, float radius) const;
+
+  /**
+   * @brief Finds the closest point on the faces to the query point (ties by face position)
+   * @param point
+   * @return
+   */
+  ClosestPoint findClosestPoint(const float point[3]) const;
+
+  /**
+   * @brief Finds the closest point on the faces for every query point in parallel
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @return
+   */
+  std::vector<ClosestPoint> findClosestPoint(const float* points, size_t numPoints) const;
+
+  /**
+   * @brief Finds the face the segment from q to r meets first. Faces the segment only lies in the
+   * plane of are skipped.
+   * @param q
+   * @param r
+   * @return
+   */
+  RayHit castRay(const float q[3], const float r[3]) const;
+
+  /**
+   * @brief Casts every segment in parallel
+   * @param segments numSegments x 6 values: the start point followed by the end point
+   * @param numSegments
+   * @return
+   */
+  std::vector<RayHit> castRay(const float* segments, size_t numSegments) const;
+
+protected:
+  TriangleBVH();
+
+private:
+  /**
+   * @brief A node of the hierarchy. Inner nodes have a count of zero and their children at offset
+   * and offset + 1; leaves hold the faces offset up to offset + count in leaf order.
+   */
+  struct Node
+  {
+    std::array<float, 3> lower;
+    std::array<float, 3> upper;
+    uint32_t offset;
+    uint32_t count;
+  };
+
+  class Builder;
+
+  SharedVertexList::Pointer m_Vertices;
+  SharedTriList::Pointer m_Triangles;
+  size_t m_NumVertices = 0;
+  size_t m_NumTriangles = 0;
+  std::array<float, 3> m_Lower = {{0.0f, 0.0f, 0.0f}};
+  std::array<float, 3> m_Upper = {{0.0f, 0.0f, 0.0f}};
+  std::vector<Node> m_Nodes;
+  std::vector<float> m_Coords;
+  std::vector<size_t> m_FaceIds;
+  std::vector<uint32_t> m_Positions;
+
+  /**
+   * @brief Copies the coordinates of the listed faces and builds the hierarchy over them
+   * @param triangles
+   * @param faceIds
+   * @return
+   */
+  static Pointer CreateFromFaces(const TriangleGeom& triangles, std::vector<size_t> faceIds);
+
+  /**
+   * @brief Builds the nodes over the faces whose coordinates are in m_Coords in list order, then
+   * reorders the faces into leaf order
+   */
+  void build();
+
+  const float* getFaceCoords(size_t index) const;
+
+  char classifyPoint(const float point[3], float radius, std::mt19937_64& generator, std::vector<uint32_t>& stack, std::vector<uint32_t>& candidates) const;
+
+  ClosestPoint searchClosestPoint(const float point[3], std::vector<std::pair<uint32_t, double>>& stack) const;
+
+  RayHit searchRay(const float q[3], const float r[3], std::vector<std::pair<uint32_t, double>>& stack) const;
+
+public:
+  TriangleBVH(const TriangleBVH&) = delete;            // Copy Constructor Not Implemented
+  TriangleBVH(TriangleBVH&&) = delete;                 // Move Constructor Not Implemented
+  TriangleBVH& operator=(const TriangleBVH&) = delete; // Copy Assignment Not Implemented
+  TriangleBVH& operator=(TriangleBVH&&) = delete;      // Move Assignment Not Implemented
+};
@@ -132,6 +132,7 @@ TriangleGeom::TriangleGeom()
   m_TriangleNeighbors = ElementDynamicList::NullPointer();
   m_TriangleCentroids = FloatArrayType::NullPointer();
   m_TriangleSizes = FloatArrayType::NullPointer();
+  m_BoundingVolumeHierarchy = TriangleBVH::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -229,6 +230,47 @@ size_t TriangleGeom::getNumberOfElements() const
   return m_TriList->getNumberOfTuples();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::findBoundingVolumeHierarchy()
+{
+  m_BoundingVolumeHierarchy = TriangleBVH::Create(*this);
+  if(m_BoundingVolumeHierarchy.get() == nullptr)
+  {
+    return -1;
+  }
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleGeom::getBoundingVolumeHierarchy() const
+{
+  if(m_BoundingVolumeHierarchy.get() == nullptr || !m_BoundingVolumeHierarchy->isValidFor(m_VertexList, m_TriList))
+  {
+    return TriangleBVH::NullPointer();
+  }
+  return m_BoundingVolumeHierarchy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleGeom::setBoundingVolumeHierarchy(TriangleBVH::Pointer bvh)
+{
+  m_BoundingVolumeHierarchy = bvh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleGeom::deleteBoundingVolumeHierarchy()
+{
+  m_BoundingVolumeHierarchy = TriangleBVH::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
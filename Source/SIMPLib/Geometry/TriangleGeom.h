@@ -42,6 +42,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/TriangleBVH.h"
 
 /**
  * @brief The TriangleGeom class represents a collection of triangles
@@ -191,6 +192,32 @@ public:
    */
   size_t getNumberOfTris() const;
 
+  /**
+   * @brief findBoundingVolumeHierarchy Builds the bounding volume hierarchy used for point
+   * containment, closest point and ray queries on the triangles
+   * @return
+   */
+  int findBoundingVolumeHierarchy();
+
+  /**
+   * @brief getBoundingVolumeHierarchy Returns the cached hierarchy, or a null pointer if it was not
+   * built or the vertex or triangle list was replaced or resized since. Moving vertices requires
+   * calling findBoundingVolumeHierarchy again.
+   * @return
+   */
+  TriangleBVH::Pointer getBoundingVolumeHierarchy() const;
+
+  /**
+   * @brief setBoundingVolumeHierarchy
+   * @param bvh
+   */
+  void setBoundingVolumeHierarchy(TriangleBVH::Pointer bvh);
+
+  /**
+   * @brief deleteBoundingVolumeHierarchy
+   */
+  void deleteBoundingVolumeHierarchy();
+
   // -----------------------------------------------------------------------------
   // Inherited from IGeometry
   // -----------------------------------------------------------------------------
@@ -515,6 +542,7 @@ private:
   ElementDynamicList::Pointer m_TriangleNeighbors;
   FloatArrayType::Pointer m_TriangleCentroids;
   FloatArrayType::Pointer m_TriangleSizes;
+  TriangleBVH::Pointer m_BoundingVolumeHierarchy;
 
   friend class FindTriangleDerivativesImpl;
 
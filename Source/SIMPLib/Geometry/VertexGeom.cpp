@@ -59,6 +59,7 @@ VertexGeom::VertexGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = VertexGeom::CreateSharedVertexList(0);
   m_VertexSizes = FloatArrayType::NullPointer();
+  m_SpatialIndex = VertexSpatialIndex::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -270,6 +271,47 @@ void VertexGeom::deleteElementSizes()
   m_VertexSizes = FloatArrayType::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::findSpatialIndex()
+{
+  m_SpatialIndex = VertexSpatialIndex::Create(m_VertexList);
+  if(m_SpatialIndex.get() == nullptr)
+  {
+    return -1;
+  }
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexGeom::getSpatialIndex() const
+{
+  if(m_SpatialIndex.get() == nullptr || !m_SpatialIndex->isValidFor(m_VertexList))
+  {
+    return VertexSpatialIndex::NullPointer();
+  }
+  return m_SpatialIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexGeom::setSpatialIndex(VertexSpatialIndex::Pointer spatialIndex)
+{
+  m_SpatialIndex = spatialIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexGeom::deleteSpatialIndex()
+{
+  m_SpatialIndex = VertexSpatialIndex::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,6 +44,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
 
 /**
  * @brief The VertexGeom class represents a point cloud
@@ -158,6 +159,32 @@ public:
    */
   size_t getNumberOfVertices() const;
 
+  /**
+   * @brief findSpatialIndex Builds the spatial index used for nearest neighbor, radius and box
+   * queries on the vertices
+   * @return
+   */
+  int findSpatialIndex();
+
+  /**
+   * @brief getSpatialIndex Returns the cached spatial index, or a null pointer if it was not
+   * built or the vertex list was replaced or resized since. Moving vertices requires calling
+   * findSpatialIndex again.
+   * @return
+   */
+  VertexSpatialIndex::Pointer getSpatialIndex() const;
+
+  /**
+   * @brief setSpatialIndex
+   * @param spatialIndex
+   */
+  void setSpatialIndex(VertexSpatialIndex::Pointer spatialIndex);
+
+  /**
+   * @brief deleteSpatialIndex
+   */
+  void deleteSpatialIndex();
+
   // -----------------------------------------------------------------------------
   // Inherited from IGeometry
   // -----------------------------------------------------------------------------
@@ -341,6 +368,7 @@ protected:
 private:
   SharedVertexList::Pointer m_VertexList;
   FloatArrayType::Pointer m_VertexSizes;
+  VertexSpatialIndex::Pointer m_SpatialIndex;
 
 public:
   VertexGeom(const VertexGeom&) = delete;            // Copy Constructor Not Implemented
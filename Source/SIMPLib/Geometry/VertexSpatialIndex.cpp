@@ -0,0 +1,764 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VertexSpatialIndex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Average number of vertices per grid cell the grid is sized for
+ */
+const size_t k_TargetVerticesPerCell = 4;
+
+/**
+ * @brief Smallest number of vertices worth a chunk of its own when building or scanning
+ */
+const size_t k_MinVerticesPerChunk = 16384;
+
+/**
+ * @brief Smallest number of queries worth a chunk of its own in the batched queries
+ */
+const size_t k_MinQueriesPerChunk = 256;
+
+/**
+ * @brief A box query scans all vertices in parallel instead of gathering and sorting the cells
+ * once the cells it touches hold more than 1/k_ScanFraction of the vertices
+ */
+const size_t k_ScanFraction = 32;
+
+// -----------------------------------------------------------------------------
+size_t ChunkCount(size_t numItems, size_t minItemsPerChunk)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  size_t numChunks = std::max(std::thread::hardware_concurrency(), 1U);
+  numChunks = std::min(numChunks, numItems / minItemsPerChunk);
+  return std::max(numChunks, size_t(1));
+#else
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+size_t ChunkBegin(size_t numItems, size_t chunk, size_t numChunks)
+{
+  return numItems * chunk / numChunks;
+}
+
+// -----------------------------------------------------------------------------
+bool InsideBox(const float* coords, const float minCoords[3], const float maxCoords[3])
+{
+  return coords[0] >= minCoords[0] && coords[0] <= maxCoords[0] && coords[1] >= minCoords[1] && coords[1] <= maxCoords[1] && coords[2] >= minCoords[2] && coords[2] <= maxCoords[2];
+}
+
+// -----------------------------------------------------------------------------
+bool ValidBox(const float minCoords[3], const float maxCoords[3])
+{
+  return minCoords[0] <= maxCoords[0] && minCoords[1] <= maxCoords[1] && minCoords[2] <= maxCoords[2];
+}
+
+// -----------------------------------------------------------------------------
+double SquaredDistance(const float* coords, const float point[3])
+{
+  const double dx = static_cast<double>(coords[0]) - point[0];
+  const double dy = static_cast<double>(coords[1]) - point[1];
+  const double dz = static_cast<double>(coords[2]) - point[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+// -----------------------------------------------------------------------------
+std::array<size_t, 3> FindGridDimensions(const std::array<double, 3>& extents, size_t numVertices)
+{
+  std::array<size_t, 3> dims = {{1, 1, 1}};
+  std::array<bool, 3> active = {{extents[0] > 0.0, extents[1] > 0.0, extents[2] > 0.0}};
+  const double targetCells = static_cast<double>(std::max(numVertices / k_TargetVerticesPerCell, size_t(1)));
+
+  // Axes that are thinner than a cell get a single layer, which leaves the other axes more cells
+  double cellSize = 0.0;
+  bool changed = true;
+  while(changed)
+  {
+    changed = false;
+    double volume = 1.0;
+    double cellsLeft = targetCells;
+    int32_t numActive = 0;
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(active[a])
+      {
+        volume *= extents[a];
+        numActive++;
+      }
+    }
+    if(numActive == 0)
+    {
+      return dims;
+    }
+    cellSize = std::pow(volume / cellsLeft, 1.0 / numActive);
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(active[a] && extents[a] < cellSize)
+      {
+        active[a] = false;
+        changed = true;
+      }
+    }
+  }
+
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(active[a])
+    {
+      dims[a] = std::max(static_cast<size_t>(std::ceil(extents[a] / cellSize)), size_t(1));
+    }
+  }
+  return dims;
+}
+} // namespace
+
+const size_t VertexSpatialIndex::k_InvalidId = std::numeric_limits<size_t>::max();
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::VertexSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::~VertexSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexSpatialIndex::Create(const SharedVertexList::Pointer& vertices)
+{
+  if(vertices.get() == nullptr || vertices->getNumberOfComponents() != 3)
+  {
+    return NullPointer();
+  }
+  Pointer index(new VertexSpatialIndex());
+  index->m_Vertices = vertices;
+  index->m_NumVertices = vertices->getNumberOfTuples();
+  index->build();
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexSpatialIndex::FindPointsInBox(const SharedVertexList& vertices, const float minCoords[3], const float maxCoords[3])
+{
+  const size_t numVertices = vertices.getNumberOfTuples();
+  if(numVertices == 0 || vertices.getNumberOfComponents() != 3 || !ValidBox(minCoords, maxCoords))
+  {
+    return {};
+  }
+  const float* coords = vertices.getPointer(0);
+
+  const size_t numChunks = ChunkCount(numVertices, k_MinVerticesPerChunk);
+  std::vector<std::vector<size_t>> chunkIds(numChunks);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      const size_t end = ChunkBegin(numVertices, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numVertices, chunk, numChunks); i < end; i++)
+      {
+        if(InsideBox(coords + 3 * i, minCoords, maxCoords))
+        {
+          chunkIds[chunk].push_back(i);
+        }
+      }
+    }
+  });
+
+  if(numChunks == 1)
+  {
+    return std::move(chunkIds[0]);
+  }
+  std::vector<size_t> offsets(numChunks + 1, 0);
+  for(size_t chunk = 0; chunk < numChunks; chunk++)
+  {
+    offsets[chunk + 1] = offsets[chunk] + chunkIds[chunk].size();
+  }
+  std::vector<size_t> ids(offsets.back());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::copy(chunkIds[chunk].begin(), chunkIds[chunk].end(), ids.begin() + offsets[chunk]);
+    }
+  });
+  return ids;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::build()
+{
+  m_CellOffsets.assign(2, 0);
+  m_VertexIds.clear();
+  SharedVertexList::Pointer vertices = lockVertices();
+  if(vertices.get() == nullptr)
+  {
+    return;
+  }
+  const float* coords = vertices->getPointer(0);
+  const size_t numVertices = m_NumVertices;
+  const size_t numChunks = ChunkCount(numVertices, k_MinVerticesPerChunk);
+
+  // Bounds of the finite coordinates; anything else is clamped into the border cells
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<std::array<double, 6>> chunkBounds(numChunks, {{inf, inf, inf, -inf, -inf, -inf}});
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::array<double, 6>& bounds = chunkBounds[chunk];
+      const size_t end = ChunkBegin(numVertices, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numVertices, chunk, numChunks); i < end; i++)
+      {
+        for(size_t a = 0; a < 3; a++)
+        {
+          const float value = coords[3 * i + a];
+          if(std::isfinite(value))
+          {
+            bounds[a] = std::min(bounds[a], static_cast<double>(value));
+            bounds[a + 3] = std::max(bounds[a + 3], static_cast<double>(value));
+          }
+        }
+      }
+    }
+  });
+
+  std::array<double, 6> bounds = {{inf, inf, inf, -inf, -inf, -inf}};
+  for(const auto& chunk : chunkBounds)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      bounds[a] = std::min(bounds[a], chunk[a]);
+      bounds[a + 3] = std::max(bounds[a + 3], chunk[a + 3]);
+    }
+  }
+  std::array<double, 3> extents = {{0.0, 0.0, 0.0}};
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(bounds[a] > bounds[a + 3])
+    {
+      bounds[a] = 0.0;
+      bounds[a + 3] = 0.0;
+    }
+    m_Origin[a] = bounds[a];
+    extents[a] = bounds[a + 3] - bounds[a];
+  }
+
+  m_Dimensions = FindGridDimensions(extents, numVertices);
+  for(size_t a = 0; a < 3; a++)
+  {
+    m_CellSize[a] = extents[a] / static_cast<double>(m_Dimensions[a]);
+    m_InvCellSize[a] = m_CellSize[a] > 0.0 ? 1.0 / m_CellSize[a] : 0.0;
+  }
+  const size_t numCells = m_Dimensions[0] * m_Dimensions[1] * m_Dimensions[2];
+
+  auto findVertexCell = [&](size_t i) {
+    const float* vertex = coords + 3 * i;
+    return getCellIndex(findCell(vertex[0], 0), findCell(vertex[1], 1), findCell(vertex[2], 2));
+  };
+
+  // Counting sort of the vertex ids by cell: count, scan, then scatter through per cell cursors
+  std::unique_ptr<std::atomic<size_t>[]> cursors(new std::atomic<size_t>[numCells]);
+  ParallelDataAlgorithm cellAlg;
+  cellAlg.setRange(0, numCells);
+  cellAlg.execute([&](const SIMPLRange& range) {
+    for(size_t c = range.min(); c < range.max(); c++)
+    {
+      cursors[c].store(0, std::memory_order_relaxed);
+    }
+  });
+
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      const size_t end = ChunkBegin(numVertices, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numVertices, chunk, numChunks); i < end; i++)
+      {
+        cursors[findVertexCell(i)].fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  });
+
+  m_CellOffsets.resize(numCells + 1);
+  m_CellOffsets[0] = 0;
+  for(size_t c = 0; c < numCells; c++)
+  {
+    const size_t count = cursors[c].load(std::memory_order_relaxed);
+    cursors[c].store(m_CellOffsets[c], std::memory_order_relaxed);
+    m_CellOffsets[c + 1] = m_CellOffsets[c] + count;
+  }
+
+  m_VertexIds.resize(numVertices);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      const size_t end = ChunkBegin(numVertices, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numVertices, chunk, numChunks); i < end; i++)
+      {
+        m_VertexIds[cursors[findVertexCell(i)].fetch_add(1, std::memory_order_relaxed)] = i;
+      }
+    }
+  });
+  cursors.reset();
+
+  // Chunks scatter concurrently, so restore ascending ids inside each cell
+  if(numChunks > 1)
+  {
+    cellAlg.execute([&](const SIMPLRange& range) {
+      for(size_t c = range.min(); c < range.max(); c++)
+      {
+        std::sort(m_VertexIds.begin() + m_CellOffsets[c], m_VertexIds.begin() + m_CellOffsets[c + 1]);
+      }
+    });
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VertexSpatialIndex::isValidFor(const SharedVertexList::Pointer& vertices) const
+{
+  return vertices.get() != nullptr && vertices == m_Vertices.lock() && vertices->getNumberOfTuples() == m_NumVertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::getNumberOfVertices() const
+{
+  return m_NumVertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::array<size_t, 3> VertexSpatialIndex::getDimensions() const
+{
+  return m_Dimensions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SharedVertexList::Pointer VertexSpatialIndex::lockVertices() const
+{
+  SharedVertexList::Pointer vertices = m_Vertices.lock();
+  if(m_NumVertices == 0 || vertices.get() == nullptr || vertices->getNumberOfTuples() != m_NumVertices)
+  {
+    return SharedVertexList::NullPointer();
+  }
+  return vertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::findCell(double value, size_t axis) const
+{
+  const double position = (value - m_Origin[axis]) * m_InvCellSize[axis];
+  // Also catches NaN
+  if(!(position > 0.0))
+  {
+    return 0;
+  }
+  if(position >= static_cast<double>(m_Dimensions[axis]))
+  {
+    return m_Dimensions[axis] - 1;
+  }
+  return static_cast<size_t>(position);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::getCellIndex(size_t x, size_t y, size_t z) const
+{
+  return (z * m_Dimensions[1] + y) * m_Dimensions[0] + x;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func>
+void VertexSpatialIndex::forEachCellInBox(const std::array<size_t, 3>& lower, const std::array<size_t, 3>& upper, Func&& func) const
+{
+  for(size_t z = lower[2]; z <= upper[2]; z++)
+  {
+    for(size_t y = lower[1]; y <= upper[1]; y++)
+    {
+      // Cells of one row are contiguous, so visit the row as a single run of vertex ids
+      const size_t* begin = m_VertexIds.data() + m_CellOffsets[getCellIndex(lower[0], y, z)];
+      const size_t* end = m_VertexIds.data() + m_CellOffsets[getCellIndex(upper[0], y, z) + 1];
+      func(begin, end);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Query>
+VertexSpatialIndex::QueryResults VertexSpatialIndex::runBatchedQuery(size_t numQueries, Query&& query) const
+{
+  QueryResults results;
+  results.offsets.assign(numQueries + 1, 0);
+
+  // Each chunk of queries gathers into its own list, which are then concatenated in query order
+  const size_t numChunks = ChunkCount(numQueries, k_MinQueriesPerChunk);
+  std::vector<std::vector<size_t>> chunkIds(numChunks);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<size_t>& ids = chunkIds[chunk];
+      const size_t end = ChunkBegin(numQueries, chunk + 1, numChunks);
+      for(size_t i = ChunkBegin(numQueries, chunk, numChunks); i < end; i++)
+      {
+        const size_t first = ids.size();
+        query(i, ids);
+        std::sort(ids.begin() + first, ids.end());
+        results.offsets[i + 1] = ids.size() - first;
+      }
+    }
+  });
+
+  for(size_t i = 0; i < numQueries; i++)
+  {
+    results.offsets[i + 1] += results.offsets[i];
+  }
+  results.ids.resize(results.offsets.back());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::copy(chunkIds[chunk].begin(), chunkIds[chunk].end(), results.ids.begin() + results.offsets[ChunkBegin(numQueries, chunk, numChunks)]);
+    }
+  });
+  return results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findBoxCells(const float minCoords[3], const float maxCoords[3], std::array<size_t, 3>& lower, std::array<size_t, 3>& upper) const
+{
+  for(size_t a = 0; a < 3; a++)
+  {
+    lower[a] = findCell(minCoords[a], a);
+    upper[a] = findCell(maxCoords[a], a);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::findNearestNeighbors(const float point[3], size_t k, size_t* ids, float* distances) const
+{
+  std::vector<std::pair<double, size_t>> heap;
+  return searchNearest(point, k, ids, distances, heap);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findNearestNeighbors(const float* points, size_t numPoints, size_t k, std::vector<size_t>& ids, std::vector<float>& distances) const
+{
+  ids.resize(numPoints * k);
+  distances.resize(numPoints * k);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<std::pair<double, size_t>> heap;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      searchNearest(points + 3 * i, k, ids.data() + i * k, distances.data() + i * k, heap);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::searchNearest(const float point[3], size_t k, size_t* ids, float* distances, std::vector<std::pair<double, size_t>>& heap) const
+{
+  std::fill(ids, ids + k, k_InvalidId);
+  if(distances != nullptr)
+  {
+    std::fill(distances, distances + k, std::numeric_limits<float>::infinity());
+  }
+  SharedVertexList::Pointer vertices = lockVertices();
+  if(vertices.get() == nullptr || k == 0)
+  {
+    return 0;
+  }
+  const float* coords = vertices->getPointer(0);
+
+  // Max heap of the best (squared distance, id) pairs found so far
+  const size_t count = std::min(k, m_NumVertices);
+  heap.clear();
+  auto visit = [&](const size_t* begin, const size_t* end) {
+    for(const size_t* id = begin; id != end; id++)
+    {
+      const double distance = SquaredDistance(coords + 3 * (*id), point);
+      if(std::isnan(distance))
+      {
+        continue;
+      }
+      std::pair<double, size_t> candidate(distance, *id);
+      if(heap.size() < count)
+      {
+        heap.push_back(candidate);
+        std::push_heap(heap.begin(), heap.end());
+      }
+      else if(candidate < heap.front())
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate;
+        std::push_heap(heap.begin(), heap.end());
+      }
+    }
+  };
+
+  // Visit rings of cells of growing Chebyshev distance around the cell of the point until no
+  // unvisited cell can hold a closer vertex
+  const std::array<size_t, 3> center = {{findCell(point[0], 0), findCell(point[1], 1), findCell(point[2], 2)}};
+  for(size_t ring = 0;; ring++)
+  {
+    std::array<size_t, 3> lower = {{0, 0, 0}};
+    std::array<size_t, 3> upper = {{0, 0, 0}};
+    for(size_t a = 0; a < 3; a++)
+    {
+      lower[a] = center[a] >= ring ? center[a] - ring : 0;
+      upper[a] = std::min(center[a] + ring, m_Dimensions[a] - 1);
+    }
+    for(size_t z = lower[2]; z <= upper[2]; z++)
+    {
+      for(size_t y = lower[1]; y <= upper[1]; y++)
+      {
+        const bool onShell = z + ring == center[2] || z == center[2] + ring || y + ring == center[1] || y == center[1] + ring;
+        if(onShell)
+        {
+          visit(m_VertexIds.data() + m_CellOffsets[getCellIndex(lower[0], y, z)], m_VertexIds.data() + m_CellOffsets[getCellIndex(upper[0], y, z) + 1]);
+          continue;
+        }
+        if(center[0] >= ring)
+        {
+          const size_t cell = getCellIndex(center[0] - ring, y, z);
+          visit(m_VertexIds.data() + m_CellOffsets[cell], m_VertexIds.data() + m_CellOffsets[cell + 1]);
+        }
+        if(center[0] + ring < m_Dimensions[0])
+        {
+          const size_t cell = getCellIndex(center[0] + ring, y, z);
+          visit(m_VertexIds.data() + m_CellOffsets[cell], m_VertexIds.data() + m_CellOffsets[cell + 1]);
+        }
+      }
+    }
+
+    bool covered = true;
+    for(size_t a = 0; a < 3; a++)
+    {
+      covered = covered && lower[a] == 0 && upper[a] + 1 == m_Dimensions[a];
+    }
+    if(covered)
+    {
+      break;
+    }
+
+    // Distance from the point to the nearest face of the visited block that is not on the grid border
+    double bound = std::numeric_limits<double>::infinity();
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(lower[a] > 0)
+      {
+        bound = std::min(bound, point[a] - (m_Origin[a] + static_cast<double>(lower[a]) * m_CellSize[a]));
+      }
+      if(upper[a] + 1 < m_Dimensions[a])
+      {
+        bound = std::min(bound, m_Origin[a] + static_cast<double>(upper[a] + 1) * m_CellSize[a] - point[a]);
+      }
+    }
+    if(!(bound > 0.0))
+    {
+      bound = 0.0;
+    }
+    if(heap.size() == count && heap.front().first < bound * bound)
+    {
+      break;
+    }
+  }
+
+  std::sort_heap(heap.begin(), heap.end());
+  for(size_t i = 0; i < heap.size(); i++)
+  {
+    ids[i] = heap[i].second;
+    if(distances != nullptr)
+    {
+      distances[i] = static_cast<float>(std::sqrt(heap[i].first));
+    }
+  }
+  return heap.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::appendPointsInRadius(const float point[3], float radius, std::vector<size_t>& ids) const
+{
+  SharedVertexList::Pointer vertices = lockVertices();
+  if(vertices.get() == nullptr || !(radius >= 0.0f))
+  {
+    return;
+  }
+  const float* coords = vertices->getPointer(0);
+  std::array<size_t, 3> lower = {{0, 0, 0}};
+  std::array<size_t, 3> upper = {{0, 0, 0}};
+  for(size_t a = 0; a < 3; a++)
+  {
+    lower[a] = findCell(static_cast<double>(point[a]) - radius, a);
+    upper[a] = findCell(static_cast<double>(point[a]) + radius, a);
+  }
+  const double radiusSquared = static_cast<double>(radius) * radius;
+  forEachCellInBox(lower, upper, [&](const size_t* begin, const size_t* end) {
+    for(const size_t* id = begin; id != end; id++)
+    {
+      if(SquaredDistance(coords + 3 * (*id), point) <= radiusSquared)
+      {
+        ids.push_back(*id);
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexSpatialIndex::findPointsInRadius(const float point[3], float radius) const
+{
+  std::vector<size_t> ids;
+  appendPointsInRadius(point, radius, ids);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::QueryResults VertexSpatialIndex::findPointsInRadius(const float* points, size_t numPoints, float radius) const
+{
+  return runBatchedQuery(numPoints, [&](size_t i, std::vector<size_t>& ids) { appendPointsInRadius(points + 3 * i, radius, ids); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::appendPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<size_t>& ids) const
+{
+  SharedVertexList::Pointer vertices = lockVertices();
+  if(vertices.get() == nullptr || !ValidBox(minCoords, maxCoords))
+  {
+    return;
+  }
+  const float* coords = vertices->getPointer(0);
+  std::array<size_t, 3> lower = {{0, 0, 0}};
+  std::array<size_t, 3> upper = {{0, 0, 0}};
+  findBoxCells(minCoords, maxCoords, lower, upper);
+  forEachCellInBox(lower, upper, [&](const size_t* begin, const size_t* end) {
+    for(const size_t* id = begin; id != end; id++)
+    {
+      if(InsideBox(coords + 3 * (*id), minCoords, maxCoords))
+      {
+        ids.push_back(*id);
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexSpatialIndex::findPointsInBox(const float minCoords[3], const float maxCoords[3]) const
+{
+  std::vector<size_t> ids;
+  SharedVertexList::Pointer vertices = lockVertices();
+  if(vertices.get() == nullptr || !ValidBox(minCoords, maxCoords))
+  {
+    return ids;
+  }
+
+  std::array<size_t, 3> lower = {{0, 0, 0}};
+  std::array<size_t, 3> upper = {{0, 0, 0}};
+  findBoxCells(minCoords, maxCoords, lower, upper);
+  size_t numCandidates = 0;
+  forEachCellInBox(lower, upper, [&](const size_t* begin, const size_t* end) { numCandidates += static_cast<size_t>(end - begin); });
+  if(numCandidates * k_ScanFraction >= m_NumVertices)
+  {
+    return FindPointsInBox(*vertices, minCoords, maxCoords);
+  }
+
+  ids.reserve(numCandidates);
+  appendPointsInBox(minCoords, maxCoords, ids);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::QueryResults VertexSpatialIndex::findPointsInBox(const float* boxes, size_t numBoxes) const
+{
+  return runBatchedQuery(numBoxes, [&](size_t i, std::vector<size_t>& ids) { appendPointsInBox(boxes + 6 * i, boxes + 6 * i + 3, ids); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexSpatialIndex::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
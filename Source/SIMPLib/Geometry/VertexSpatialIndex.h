@@ -0,0 +1,219 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+/**
+ * @brief The VertexSpatialIndex class is a uniform grid over the vertices of a point cloud. The vertex
+ * ids are bucketed by grid cell (compressed row storage) so that nearest neighbor, radius and box
+ * queries only visit the cells around the query instead of every vertex. The grid is sized from the
+ * bounding box of the finite vertices so that a cell holds a handful of vertices on average.
+ *
+ * The index only stores vertex ids and keeps a weak reference to the vertex list it was built from to
+ * read the coordinates, so it neither keeps a replaced list alive nor reads a deleted one. Moving vertices
+ * requires building a new index, which the index cannot detect by itself; if the list is resized or
+ * deleted the queries find nothing. All queries are const and may be called from several threads at once; the batched
+ * queries parallelize over the query points themselves.
+ */
+class SIMPLib_EXPORT VertexSpatialIndex
+{
+public:
+  using Self = VertexSpatialIndex;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Vertex id reported for the unfilled slots of a nearest neighbor query
+   */
+  static const size_t k_InvalidId;
+
+  /**
+   * @brief Variable length results of a batched query in compressed row storage: the ids found for
+   * query i are ids[offsets[i]] up to ids[offsets[i + 1]], sorted by ascending vertex id.
+   */
+  struct QueryResults
+  {
+    std::vector<size_t> offsets;
+    std::vector<size_t> ids;
+  };
+
+  /**
+   * @brief Builds the index for the given vertex list in parallel
+   * @param vertices
+   * @return
+   */
+  static Pointer Create(const SharedVertexList::Pointer& vertices);
+
+  /**
+   * @brief Finds the vertices inside the axis aligned box (bounds inclusive) with a parallel scan over
+   * all vertices. This is cheaper than building an index for a single query.
+   * @param vertices
+   * @param minCoords
+   * @param maxCoords
+   * @return Vertex ids sorted ascending
+   */
+  static std::vector<size_t> FindPointsInBox(const SharedVertexList& vertices, const float minCoords[3], const float maxCoords[3]);
+
+  ~VertexSpatialIndex();
+
+  /**
+   * @brief Returns true if the index was built from this vertex list and the list still has the
+   * same number of vertices. Vertices moved in place since the index was built are not detected.
+   * @param vertices
+   * @return
+   */
+  bool isValidFor(const SharedVertexList::Pointer& vertices) const;
+
+  /**
+   * @brief getNumberOfVertices
+   * @return
+   */
+  size_t getNumberOfVertices() const;
+
+  /**
+   * @brief Returns the number of grid cells along each axis
+   * @return
+   */
+  std::array<size_t, 3> getDimensions() const;
+
+  /**
+   * @brief Finds the k vertices closest to the point, sorted by ascending distance (ties by
+   * ascending id). Slots past the number of vertices are set to k_InvalidId and infinity.
+   * @param point
+   * @param k
+   * @param ids Receives k vertex ids
+   * @param distances Receives k distances; may be nullptr
+   * @return Number of vertices found
+   */
+  size_t findNearestNeighbors(const float point[3], size_t k, size_t* ids, float* distances) const;
+
+  /**
+   * @brief Finds the k nearest vertices for every query point in parallel
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param k
+   * @param ids Resized to numPoints x k
+   * @param distances Resized to numPoints x k
+   */
+  void findNearestNeighbors(const float* points, size_t numPoints, size_t k, std::vector<size_t>& ids, std::vector<float>& distances) const;
+
+  /**
+   * @brief Finds the vertices within radius of the point (inclusive)
+   * @param point
+   * @param radius
+   * @return Vertex ids sorted ascending
+   */
+  std::vector<size_t> findPointsInRadius(const float point[3], float radius) const;
+
+  /**
+   * @brief Finds the vertices within radius of every query point in parallel
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param radius
+   * @return
+   */
+  QueryResults findPointsInRadius(const float* points, size_t numPoints, float radius) const;
+
+  /**
+   * @brief Finds the vertices inside the axis aligned box (bounds inclusive). Large boxes are
+   * gathered in parallel.
+   * @param minCoords
+   * @param maxCoords
+   * @return Vertex ids sorted ascending
+   */
+  std::vector<size_t> findPointsInBox(const float minCoords[3], const float maxCoords[3]) const;
+
+  /**
+   * @brief Finds the vertices inside every box in parallel
+   * @param boxes numBoxes x 6 values: xMin, yMin, zMin, xMax, yMax, zMax
+   * @param numBoxes
+   * @return
+   */
+  QueryResults findPointsInBox(const float* boxes, size_t numBoxes) const;
+
+protected:
+  VertexSpatialIndex();
+
+private:
+  std::weak_ptr<SharedVertexList> m_Vertices;
+  size_t m_NumVertices = 0;
+  std::array<size_t, 3> m_Dimensions = {{1, 1, 1}};
+  std::array<double, 3> m_Origin = {{0.0, 0.0, 0.0}};
+  std::array<double, 3> m_CellSize = {{0.0, 0.0, 0.0}};
+  std::array<double, 3> m_InvCellSize = {{0.0, 0.0, 0.0}};
+  std::vector<size_t> m_CellOffsets;
+  std::vector<size_t> m_VertexIds;
+
+  /**
+   * @brief Sizes the grid from the bounds of the vertices and buckets the vertex ids by cell
+   */
+  void build();
+
+  size_t findCell(double value, size_t axis) const;
+
+  size_t getCellIndex(size_t x, size_t y, size_t z) const;
+
+  /**
+   * @brief Returns the vertex list the index was built from, or a null pointer if it was deleted or resized
+   */
+  SharedVertexList::Pointer lockVertices() const;
+
+  template <typename Func>
+  void forEachCellInBox(const std::array<size_t, 3>& lower, const std::array<size_t, 3>& upper, Func&& func) const;
+
+  void findBoxCells(const float minCoords[3], const float maxCoords[3], std::array<size_t, 3>& lower, std::array<size_t, 3>& upper) const;
+
+  size_t searchNearest(const float point[3], size_t k, size_t* ids, float* distances, std::vector<std::pair<double, size_t>>& heap) const;
+
+  void appendPointsInRadius(const float point[3], float radius, std::vector<size_t>& ids) const;
+
+  void appendPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<size_t>& ids) const;
+
+  template <typename Query>
+  QueryResults runBatchedQuery(size_t numQueries, Query&& query) const;
+
+public:
+  VertexSpatialIndex(const VertexSpatialIndex&) = delete;            // Copy Constructor Not Implemented
+  VertexSpatialIndex(VertexSpatialIndex&&) = delete;                 // Move Constructor Not Implemented
+  VertexSpatialIndex& operator=(const VertexSpatialIndex&) = delete; // Copy Assignment Not Implemented
+  VertexSpatialIndex& operator=(VertexSpatialIndex&&) = delete;      // Move Assignment Not Implemented
+};
@@ -177,14 +177,7 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   // Strings are stored as variable length arrays so trying to match the component
   // dimensions does not make sense.
   StringDataArray::Pointer strTemp = StringDataArray::CreateArray(dims[0], name, true);
-
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), strings);
-  // Copy the data into
-  for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
-  {
-    strTemp->setValue(i, QString::fromStdString(strings[i]));
-  }
+  err = strTemp->readH5Data(gid);
   if(err < 0)
   {
     err = H5Tclose(typeId);
@@ -0,0 +1,72 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The H5DataArrayWriteOptions struct describes how the datasets of an array are laid out
+ * in the HDF5 file. The default values write contiguous, uncompressed datasets.
+ */
+struct H5DataArrayWriteOptions
+{
+  /**
+   * @brief Chunk shape in tuple space using the same XYZ order as the tuple dimensions. The
+   * component dimensions are never split across chunks and a zero keeps a dimension whole. An empty
+   * vector, or one whose size does not match the tuple rank of an array, lets the writer pick a
+   * chunk shape of roughly ChunkTargetBytes.
+   */
+  std::vector<size_t> chunkDims;
+
+  /**
+   * @brief Deflate (gzip) level from 1 to 9. Zero disables compression.
+   */
+  int compressionLevel = 0;
+
+  /**
+   * @brief Applies the HDF5 byte shuffle filter before deflating, which helps integer label arrays
+   */
+  bool shuffle = false;
+
+  /**
+   * @brief Approximate size of the chunks the writer picks on its own
+   */
+  static constexpr size_t ChunkTargetBytes = 1024 * 1024;
+
+  /**
+   * @brief Returns true if the datasets need to be chunked, i.e. the defaults are not in use
+   */
+  bool isChunked() const
+  {
+    return !chunkDims.empty() || compressionLevel > 0 || shuffle;
+  }
+};
@@ -35,6 +35,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include <hdf5.h>
 
 #include <QtCore/QString>
@@ -45,6 +49,7 @@ using namespace H5Support;
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/HDF5/H5DataArrayWriteOptions.h"
 //#include "SIMPLib/DataArrays/DataArray.hpp"
 
 /**
@@ -123,6 +128,20 @@ public:
    */
   template <class T>
   static int writeDataArray(hid_t gid, const T* dataArray, const std::vector<size_t>& tDims)
+  {
+    return writeDataArray<T>(gid, dataArray, tDims, H5DataArrayWriteOptions());
+  }
+
+  /**
+   * @brief writeDataArray
+   * @param gid
+   * @param dataArray
+   * @param tDims
+   * @param options Chunking and compression settings for the dataset
+   * @return
+   */
+  template <class T>
+  static int writeDataArray(hid_t gid, const T* dataArray, const std::vector<size_t>& tDims, const H5DataArrayWriteOptions& options)
   {
     int err = 0;
 
@@ -169,7 +188,16 @@ public:
       h5Dims[i + tDims.size()] = cDims[i];
     }
 #endif
-    if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
+    if(options.isChunked() && dataArray->getSize() > 0)
+    {
+      std::vector<hsize_t> chunkDims = createChunkDims(h5Dims, tDims.size(), sizeof(*dataArray->getPointer(0)), options);
+      err = writeChunkedPointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), chunkDims.data(), dataArray->getPointer(0), options);
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+    else if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
     {
       err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
       if(err < 0)
@@ -191,6 +219,112 @@ public:
     return err;
   }
 
+  /**
+   * @brief Computes the chunk shape of a dataset. The dimensions are in HDF5 order (slowest to fastest)
+   * with the tuple dimensions first, followed by the component dimensions which are always kept whole.
+   * @param h5Dims Dimensions of the dataset
+   * @param tupleRank Number of leading dimensions that are tuple dimensions
+   * @param elementSize Size in bytes of a single element
+   * @param options
+   * @return
+   */
+  static std::vector<hsize_t> createChunkDims(const QVector<hsize_t>& h5Dims, size_t tupleRank, size_t elementSize, const H5DataArrayWriteOptions& options)
+  {
+    std::vector<hsize_t> chunkDims(h5Dims.begin(), h5Dims.end());
+    if(options.chunkDims.size() == tupleRank)
+    {
+      // The user supplied chunk shape is in XYZ order so it has to be reversed like the tuple dimensions
+      for(size_t i = 0; i < tupleRank; i++)
+      {
+        hsize_t dim = static_cast<hsize_t>(options.chunkDims[i]);
+        if(dim > 0)
+        {
+          chunkDims[tupleRank - 1 - i] = std::min(dim, chunkDims[tupleRank - 1 - i]);
+        }
+      }
+    }
+    else
+    {
+      // Shrink the slowest tuple dimensions first until the chunk is about the target size
+      hsize_t bytes = elementSize;
+      for(const hsize_t& dim : chunkDims)
+      {
+        bytes *= dim;
+      }
+      for(size_t i = 0; i < tupleRank && bytes > H5DataArrayWriteOptions::ChunkTargetBytes; i++)
+      {
+        hsize_t sliceBytes = bytes / chunkDims[i];
+        hsize_t count = std::max(static_cast<hsize_t>(1), static_cast<hsize_t>(H5DataArrayWriteOptions::ChunkTargetBytes) / sliceBytes);
+        chunkDims[i] = std::min(count, chunkDims[i]);
+        bytes = sliceBytes * chunkDims[i];
+      }
+    }
+    return chunkDims;
+  }
+
+  /**
+   * @brief Writes a chunked dataset, replacing any dataset with the same name, and applies the
+   * shuffle and deflate filters requested by the options. Deflate is skipped if the HDF5 library
+   * was built without it.
+   * @param gid
+   * @param name
+   * @param rank
+   * @param dims
+   * @param chunkDims
+   * @param data
+   * @param options
+   * @return
+   */
+  template <typename T>
+  static herr_t writeChunkedPointerDataset(hid_t gid, const QString& name, int32_t rank, const hsize_t* dims, const hsize_t* chunkDims, const T* data, const H5DataArrayWriteOptions& options)
+  {
+    hid_t dataType = H5Lite::HDFTypeForPrimitive(data[0]);
+    if(dataType == -1)
+    {
+      return -1;
+    }
+    std::string datasetName = name.toStdString();
+    if(QH5Lite::datasetExists(gid, name))
+    {
+      if(H5Ldelete(gid, datasetName.c_str(), H5P_DEFAULT) < 0)
+      {
+        return -1;
+      }
+    }
+
+    hid_t dataspaceId = H5Screate_simple(rank, dims, nullptr);
+    if(dataspaceId < 0)
+    {
+      return -1;
+    }
+    hid_t propertiesId = H5Pcreate(H5P_DATASET_CREATE);
+    herr_t err = H5Pset_chunk(propertiesId, rank, chunkDims);
+    if(err >= 0 && options.shuffle)
+    {
+      err = H5Pset_shuffle(propertiesId);
+    }
+    if(err >= 0 && options.compressionLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+    {
+      err = H5Pset_deflate(propertiesId, static_cast<unsigned>(std::min(options.compressionLevel, 9)));
+    }
+    if(err >= 0)
+    {
+      hid_t datasetId = H5Dcreate2(gid, datasetName.c_str(), dataType, dataspaceId, H5P_DEFAULT, propertiesId, H5P_DEFAULT);
+      if(datasetId < 0)
+      {
+        err = -1;
+      }
+      else
+      {
+        err = H5Dwrite(datasetId, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        H5Dclose(datasetId);
+      }
+    }
+    H5Pclose(propertiesId);
+    H5Sclose(dataspaceId);
+    return err;
+  }
+
   /**
    * @brief writeDataArray
    * @param gid
@@ -203,13 +337,37 @@ public:
   {
     int err = 0;
 
-    std::vector<std::string> data(dataArray->getNumberOfTuples());
-    for(int i = 0; i < data.size(); i++)
+    // The UTF-8 values are null terminated in place so the whole array is written as variable length strings in one call
+    std::vector<const char*> data(dataArray->getNumberOfTuples());
+    for(size_t i = 0; i < data.size(); i++)
     {
-      data[i] = dataArray->getValue(i).toStdString();
+      data[i] = dataArray->getValueUtf8(i).data();
     }
 
-    err = H5Lite::writeVectorOfStringsDataset(gid, dataArray->getName().toStdString(), data);
+    std::string datasetName = dataArray->getName().toStdString();
+    hsize_t dims[1] = {static_cast<hsize_t>(data.size())};
+    hid_t typeId = H5Tcopy(H5T_C_S1);
+    H5Tset_size(typeId, H5T_VARIABLE);
+    hid_t dataspaceId = H5Screate_simple(1, dims, nullptr);
+    hid_t datasetId = H5Dcreate2(gid, datasetName.c_str(), typeId, dataspaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if(datasetId < 0)
+    {
+      err = -1;
+    }
+    else
+    {
+      if(!data.empty())
+      {
+        err = H5Dwrite(datasetId, typeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+      }
+      H5Dclose(datasetId);
+    }
+    H5Sclose(dataspaceId);
+    H5Tclose(typeId);
+    if(err < 0)
+    {
+      return err;
+    }
     std::vector<size_t> tDims(1, dataArray->getNumberOfTuples());
     std::vector<size_t> cDims(1, 1);
     err = writeDataArrayAttributes<T>(gid, dataArray, tDims, cDims);
@@ -0,0 +1,64 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <mutex>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The H5GlobalLock class holds the one lock that every HDF5 call made by SIMPLib is serialized
+ * behind. The HDF5 library is not re-entrant unless it was built thread safe, and filters that execute
+ * concurrently, lazily loaded arrays, the reader tasks of SIMPLH5DataReader and widgets that browse HDF5
+ * files while the pipeline view preflights on a worker thread may all reach it at the same time. Filters
+ * from plugins that call HDF5 directly should take it as well; FilterPipeline does not run them next to
+ * other filters unless HDF5 was built thread safe. The mutex is recursive so a filter may hold it while
+ * calling helpers that take it again; it must not be held while waiting for other threads that use HDF5.
+ */
+class SIMPLib_EXPORT H5GlobalLock
+{
+public:
+  using MutexType = std::recursive_mutex;
+  using Guard = std::lock_guard<MutexType>;
+
+  /**
+   * @brief Returns the process wide HDF5 mutex
+   * @return
+   */
+  static MutexType& Mutex();
+
+public:
+  H5GlobalLock() = delete;
+  H5GlobalLock(const H5GlobalLock&) = delete;            // Copy Constructor Not Implemented
+  H5GlobalLock(H5GlobalLock&&) = delete;                 // Move Constructor Not Implemented
+  H5GlobalLock& operator=(const H5GlobalLock&) = delete; // Copy Assignment Not Implemented
+  H5GlobalLock& operator=(H5GlobalLock&&) = delete;      // Move Assignment Not Implemented
+};
@@ -1125,6 +1125,14 @@ char GeometryMath::PointInPolyhedron(TriangleGeom* faces, const Int32Int32Dynami
   return 'o';
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char GeometryMath::PointInPolyhedron(const TriangleBVH& faces, const float* point, float radius)
+{
+  return faces.pointInPolyhedron(point, radius);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
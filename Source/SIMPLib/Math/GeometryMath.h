@@ -42,6 +42,7 @@
 
 class VertexGeom;
 class TriangleGeom;
+class TriangleBVH;
 
 /*
  * @class GeometryMath GeometryMath.h DREAM3DLib/Common/GeometryMath.h
@@ -200,6 +201,16 @@ SIMPLib_EXPORT char PointInPolyhedron(TriangleGeom* faces, const Int32Int32Dynam
 SIMPLib_EXPORT char PointInPolyhedron(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds, VertexGeom* vertices, const float* point, const float* lowerLeft,
                                       const float* upperRight, float radius, float& distToBoundary);
 
+/**
+ * @brief Determines if a point is inside of a polyhedron defined by the faces of a bounding volume hierarchy.
+ * Gives the same codes as the linear scan over all faces but only tests the faces near each ray.
+ * @param faces
+ * @param point
+ * @param radius
+ * @return
+ */
+SIMPLib_EXPORT char PointInPolyhedron(const TriangleBVH& faces, const float* point, float radius);
+
 /**
  * @brief Determines if a point is inside of a triangle defined by 3 points
  * @param a
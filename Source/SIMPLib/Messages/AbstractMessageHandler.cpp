@@ -95,6 +95,15 @@ void AbstractMessageHandler::processMessage(const PipelineErrorMessage* msg) con
    * should reimplement this method if they care about processing pipeline error messages. */
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractMessageHandler::processMessage(const PipelineProfileMessage* msg) const
+{
+  /* This is a default method that can be reimplemented in a subclass.  Subclassed message handlers
+   * should reimplement this method if they care about processing pipeline profile messages. */
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -43,6 +43,7 @@ class GenericProgressMessage;
 class GenericStatusMessage;
 class GenericWarningMessage;
 class PipelineErrorMessage;
+class PipelineProfileMessage;
 class PipelineProgressMessage;
 class PipelineStatusMessage;
 class PipelineWarningMessage;
@@ -65,6 +66,7 @@ public:
   virtual void processMessage(const GenericWarningMessage* msg) const;
 
   virtual void processMessage(const PipelineErrorMessage* msg) const;
+  virtual void processMessage(const PipelineProfileMessage* msg) const;
   virtual void processMessage(const PipelineProgressMessage* msg) const;
   virtual void processMessage(const PipelineStatusMessage* msg) const;
   virtual void processMessage(const PipelineWarningMessage* msg) const;
@@ -0,0 +1,294 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineProfileMessage.h"
+
+#include "AbstractMessageHandler.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+double ToMegabytes(quint64 numBytes)
+{
+  return static_cast<double>(numBytes) / (1024.0 * 1024.0);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::PipelineProfileMessage()
+: AbstractMessage()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::PipelineProfileMessage(const QString& pipelineName, const QString& humanLabel, int pipelineIndex)
+: AbstractMessage()
+, m_PipelineName(pipelineName)
+, m_HumanLabel(humanLabel)
+, m_PipelineIndex(pipelineIndex)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::~PipelineProfileMessage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::Pointer PipelineProfileMessage::New(const QString& pipelineName, const QString& humanLabel, int pipelineIndex)
+{
+  PipelineProfileMessage::Pointer shared_ptr(new PipelineProfileMessage(pipelineName, humanLabel, pipelineIndex));
+  return shared_ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineProfileMessage::generateMessageString() const
+{
+  if(m_ExecutedConcurrently)
+  {
+    return QString("Profile [%1] %2: %3 s wall, %4 s CPU on the executing thread")
+        .arg(m_PipelineIndex + 1)
+        .arg(m_HumanLabel)
+        .arg(static_cast<double>(m_WallTime) / 1.0E6, 0, 'f', 3)
+        .arg(static_cast<double>(m_ResourceUsage.cpuTime) / 1.0E6, 0, 'f', 3);
+  }
+  return QString("Profile [%1] %2: %3 s wall, %4 s CPU, process peak RSS +%5 MB, %6 MB allocated, %7 MB read, %8 MB written")
+      .arg(m_PipelineIndex + 1)
+      .arg(m_HumanLabel)
+      .arg(static_cast<double>(m_WallTime) / 1.0E6, 0, 'f', 3)
+      .arg(static_cast<double>(m_ResourceUsage.cpuTime) / 1.0E6, 0, 'f', 3)
+      .arg(ToMegabytes(m_ResourceUsage.peakResidentBytes), 0, 'f', 1)
+      .arg(ToMegabytes(m_ResourceUsage.bytesAllocated), 0, 'f', 1)
+      .arg(ToMegabytes(m_ResourceUsage.bytesRead), 0, 'f', 1)
+      .arg(ToMegabytes(m_ResourceUsage.bytesWritten), 0, 'f', 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfileMessage::toJson() const
+{
+  QJsonObject json;
+  json["PipelineName"] = m_PipelineName;
+  json["PipelineIndex"] = m_PipelineIndex;
+  json["HumanLabel"] = m_HumanLabel;
+  json["FilterClassName"] = m_FilterClassName;
+  json["ThreadIndex"] = m_ThreadIndex;
+  json["StartTime"] = static_cast<qint64>(m_StartTime);
+  json["WallTime"] = static_cast<qint64>(m_WallTime);
+  json["ExecutedConcurrently"] = m_ExecutedConcurrently;
+  json["CpuTime"] = static_cast<qint64>(m_ResourceUsage.cpuTime);
+  if(!m_ExecutedConcurrently)
+  {
+    json["ProcessPeakResidentIncrease"] = static_cast<qint64>(m_ResourceUsage.peakResidentBytes);
+    json["BytesAllocated"] = static_cast<qint64>(m_ResourceUsage.bytesAllocated);
+    json["BytesRead"] = static_cast<qint64>(m_ResourceUsage.bytesRead);
+    json["BytesWritten"] = static_cast<qint64>(m_ResourceUsage.bytesWritten);
+  }
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfileMessage::toTraceEvent() const
+{
+  QJsonObject args;
+  args["PipelineIndex"] = m_PipelineIndex;
+  args["CpuTime"] = static_cast<qint64>(m_ResourceUsage.cpuTime);
+  if(!m_ExecutedConcurrently)
+  {
+    args["ProcessPeakResidentIncrease"] = static_cast<qint64>(m_ResourceUsage.peakResidentBytes);
+    args["BytesAllocated"] = static_cast<qint64>(m_ResourceUsage.bytesAllocated);
+    args["BytesRead"] = static_cast<qint64>(m_ResourceUsage.bytesRead);
+    args["BytesWritten"] = static_cast<qint64>(m_ResourceUsage.bytesWritten);
+  }
+
+  // Complete events carry their own duration, in microseconds like the timestamp
+  QJsonObject event;
+  event["name"] = m_HumanLabel;
+  event["cat"] = m_FilterClassName;
+  event["ph"] = QString("X");
+  event["ts"] = static_cast<qint64>(m_StartTime);
+  event["dur"] = static_cast<qint64>(m_WallTime);
+  event["pid"] = 0;
+  event["tid"] = m_ThreadIndex;
+  event["args"] = args;
+  return event;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::visit(AbstractMessageHandler* msgHandler) const
+{
+  msgHandler->processMessage(this);
+}
+
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::Pointer PipelineProfileMessage::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+PipelineProfileMessage::Pointer PipelineProfileMessage::New()
+{
+  Pointer sharedPtr(new(PipelineProfileMessage));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfileMessage::getNameOfClass() const
+{
+  return QString("PipelineProfileMessage");
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfileMessage::ClassName()
+{
+  return QString("PipelineProfileMessage");
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setPipelineName(const QString& value)
+{
+  m_PipelineName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfileMessage::getPipelineName() const
+{
+  return m_PipelineName;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setHumanLabel(const QString& value)
+{
+  m_HumanLabel = value;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfileMessage::getHumanLabel() const
+{
+  return m_HumanLabel;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setFilterClassName(const QString& value)
+{
+  m_FilterClassName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfileMessage::getFilterClassName() const
+{
+  return m_FilterClassName;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setPipelineIndex(int value)
+{
+  m_PipelineIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+int PipelineProfileMessage::getPipelineIndex() const
+{
+  return m_PipelineIndex;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setThreadIndex(int value)
+{
+  m_ThreadIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+int PipelineProfileMessage::getThreadIndex() const
+{
+  return m_ThreadIndex;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setExecutedConcurrently(bool value)
+{
+  m_ExecutedConcurrently = value;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineProfileMessage::getExecutedConcurrently() const
+{
+  return m_ExecutedConcurrently;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setStartTime(quint64 value)
+{
+  m_StartTime = value;
+}
+
+// -----------------------------------------------------------------------------
+quint64 PipelineProfileMessage::getStartTime() const
+{
+  return m_StartTime;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setWallTime(quint64 value)
+{
+  m_WallTime = value;
+}
+
+// -----------------------------------------------------------------------------
+quint64 PipelineProfileMessage::getWallTime() const
+{
+  return m_WallTime;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfileMessage::setResourceUsage(const ProcessResourceUsage& value)
+{
+  m_ResourceUsage = value;
+}
+
+// -----------------------------------------------------------------------------
+ProcessResourceUsage PipelineProfileMessage::getResourceUsage() const
+{
+  return m_ResourceUsage;
+}
@@ -0,0 +1,214 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Messages/AbstractMessage.h"
+#include "SIMPLib/Utilities/ProcessResourceUsage.h"
+
+/**
+ * @class PipelineProfileMessage PipelineProfileMessage.h SIMPLib/Messages/PipelineProfileMessage.h
+ * @brief This class holds the time and resources a single filter used while a FilterPipeline instance
+ * executed it. The pipeline only emits these messages when profiling is enabled.
+ */
+class SIMPLib_EXPORT PipelineProfileMessage : public AbstractMessage
+{
+
+public:
+  using Self = PipelineProfileMessage;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for PipelineProfileMessage
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for PipelineProfileMessage
+   */
+  static QString ClassName();
+
+  ~PipelineProfileMessage() override;
+
+  /**
+   * @brief New
+   * @param pipelineName
+   * @param humanLabel
+   * @param pipelineIndex
+   * @return
+   */
+  static Pointer New(const QString& pipelineName, const QString& humanLabel, int pipelineIndex);
+
+  /**
+   * @brief Setter property for PipelineName
+   */
+  void setPipelineName(const QString& value);
+  /**
+   * @brief Getter property for PipelineName
+   * @return Value of PipelineName
+   */
+  QString getPipelineName() const;
+
+  /**
+   * @brief Setter property for HumanLabel
+   */
+  void setHumanLabel(const QString& value);
+  /**
+   * @brief Getter property for HumanLabel
+   * @return Value of HumanLabel
+   */
+  QString getHumanLabel() const;
+
+  /**
+   * @brief Setter property for FilterClassName
+   */
+  void setFilterClassName(const QString& value);
+  /**
+   * @brief Getter property for FilterClassName
+   * @return Value of FilterClassName
+   */
+  QString getFilterClassName() const;
+
+  /**
+   * @brief Setter property for PipelineIndex
+   */
+  void setPipelineIndex(int value);
+  /**
+   * @brief Getter property for PipelineIndex
+   * @return Value of PipelineIndex
+   */
+  int getPipelineIndex() const;
+
+  /**
+   * @brief Setter property for ThreadIndex. Filters that executed at the same time have different indices.
+   */
+  void setThreadIndex(int value);
+  /**
+   * @brief Getter property for ThreadIndex
+   * @return Value of ThreadIndex
+   */
+  int getThreadIndex() const;
+
+  /**
+   * @brief Setter property for StartTime, in microseconds since the pipeline started executing
+   */
+  void setStartTime(quint64 value);
+  /**
+   * @brief Getter property for StartTime
+   * @return Value of StartTime
+   */
+  quint64 getStartTime() const;
+
+  /**
+   * @brief Setter property for WallTime, in microseconds
+   */
+  void setWallTime(quint64 value);
+  /**
+   * @brief Getter property for WallTime
+   * @return Value of WallTime
+   */
+  quint64 getWallTime() const;
+
+  /**
+   * @brief Setter property for ExecutedConcurrently. True if the filter may have executed at the same
+   * time as other filters; the resource usage then only holds the CPU time.
+   */
+  void setExecutedConcurrently(bool value);
+  /**
+   * @brief Getter property for ExecutedConcurrently
+   * @return Value of ExecutedConcurrently
+   */
+  bool getExecutedConcurrently() const;
+
+  /**
+   * @brief Setter property for ResourceUsage. Each value is the difference between the process counters
+   * after and before the filter executed, so the peak resident size is how far the process wide peak rose
+   * while the filter executed, reported as ProcessPeakResidentIncrease.
+   * For a filter that executed concurrently the CPU time is that of the thread that ran the filter, without
+   * the worker threads it used, and the process wide counters are zero because they would also include
+   * whatever the other filters used.
+   */
+  void setResourceUsage(const ProcessResourceUsage& value);
+  /**
+   * @brief Getter property for ResourceUsage
+   * @return Value of ResourceUsage
+   */
+  ProcessResourceUsage getResourceUsage() const;
+
+  /**
+   * @brief This method creates and returns a string for pipeline profile messages
+   */
+  QString generateMessageString() const override;
+
+  /**
+   * @brief Returns the profile as a JSON object. Times are in microseconds and sizes in bytes.
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Returns the profile as a complete event of the Chrome trace event format
+   * @return
+   */
+  QJsonObject toTraceEvent() const;
+
+  /**
+   * @brief Method that allows the visitation of a message by a message handler.  This
+   * is part of the double-dispatch API that allows observers to be able to perform
+   * subclass specific operations on messages that they receive.
+   * @param msgHandler The observer's message handler
+   */
+  void visit(AbstractMessageHandler* msgHandler) const override final;
+
+protected:
+  PipelineProfileMessage();
+  PipelineProfileMessage(const QString& pipelineName, const QString& humanLabel, int pipelineIndex);
+
+private:
+  QString m_PipelineName = {};
+  QString m_HumanLabel = {};
+  QString m_FilterClassName = {};
+  int m_PipelineIndex = 0;
+  int m_ThreadIndex = 0;
+  bool m_ExecutedConcurrently = false;
+  quint64 m_StartTime = 0;
+  quint64 m_WallTime = 0;
+  ProcessResourceUsage m_ResourceUsage;
+};
+Q_DECLARE_METATYPE(PipelineProfileMessage::Pointer)
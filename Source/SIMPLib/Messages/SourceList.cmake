@@ -29,6 +29,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GenericStatusMessage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GenericWarningMessage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineErrorMessage.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProfileMessage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProgressMessage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineStatusMessage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineWarningMessage.h
@@ -51,6 +52,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GenericStatusMessage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GenericWarningMessage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineErrorMessage.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProfileMessage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProgressMessage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineStatusMessage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineWarningMessage.cpp
@@ -0,0 +1,356 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "FilterManifest.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterManifest::FilterManifest() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterManifest::~FilterManifest() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString FilterManifest::DefaultFilePath()
+{
+  QString filePath = QString::fromLocal8Bit(qgetenv("SIMPL_FILTER_MANIFEST"));
+  if(!filePath.isEmpty())
+  {
+    return filePath;
+  }
+  return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/SIMPL/FilterManifest.json";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray FilterManifest::HashFile(const QString& filePath)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return QByteArray();
+  }
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  if(!hash.addData(&file))
+  {
+    return QByteArray();
+  }
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterManifest::FilterInfo FilterManifest::CreateFilterInfo(const IFilterFactory& factory)
+{
+  FilterInfo info;
+  info.className = factory.getFilterClassName();
+  info.humanLabel = factory.getFilterHumanLabel();
+  info.groupName = factory.getFilterGroup();
+  info.subGroupName = factory.getFilterSubGroup();
+  info.brandingString = factory.getBrandingString();
+  info.compiledLibraryName = factory.getCompiledLibraryName();
+  info.version = factory.getFilterVersion();
+  info.uuid = factory.getUuid();
+  return info;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManifest::readFile(const QString& filePath)
+{
+  clear();
+
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return false;
+  }
+  return readJson(doc.object());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManifest::writeFile(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  if(!QDir().mkpath(fi.absolutePath()))
+  {
+    return false;
+  }
+
+  // Several applications may start at the same time, so the file is swapped in atomically
+  QSaveFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    return false;
+  }
+  file.write(QJsonDocument(toJson()).toJson(QJsonDocument::Compact));
+  if(!file.commit())
+  {
+    return false;
+  }
+
+  m_Modified = false;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManifest::readJson(const QJsonObject& json)
+{
+  clear();
+
+  if(json[SIMPL::JSON::ManifestVersion].toInt() != k_ManifestVersion || json[SIMPL::JSON::SIMPLibVersion].toString() != SIMPLib::Version::Complete())
+  {
+    return false;
+  }
+
+  QJsonArray pluginsArray = json[SIMPL::JSON::Plugins].toArray();
+  for(const auto& pluginValue : pluginsArray)
+  {
+    QJsonObject pluginObj = pluginValue.toObject();
+
+    PluginInfo plugin;
+    plugin.filePath = pluginObj[SIMPL::JSON::Location].toString();
+    plugin.fileSize = static_cast<qint64>(pluginObj[SIMPL::JSON::FileSize].toDouble());
+    plugin.fileHash = pluginObj[SIMPL::JSON::FileHash].toString().toLatin1();
+
+    QJsonArray filtersArray = pluginObj[SIMPL::JSON::Filters].toArray();
+    for(const auto& filterValue : filtersArray)
+    {
+      QJsonObject filterObj = filterValue.toObject();
+
+      FilterInfo filter;
+      filter.className = filterObj[SIMPL::JSON::ClassName].toString();
+      filter.humanLabel = filterObj[SIMPL::JSON::Name].toString();
+      filter.groupName = filterObj[SIMPL::JSON::GroupName].toString();
+      filter.subGroupName = filterObj[SIMPL::JSON::SubGroupName].toString();
+      filter.brandingString = filterObj[SIMPL::JSON::BrandingString].toString();
+      filter.compiledLibraryName = filterObj[SIMPL::JSON::PluginName].toString();
+      filter.version = filterObj[SIMPL::JSON::Version].toString();
+      filter.uuid = QUuid(filterObj[SIMPL::JSON::Uuid].toString());
+      plugin.filters.push_back(filter);
+    }
+
+    setPlugin(plugin);
+  }
+
+  m_Modified = false;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject FilterManifest::toJson() const
+{
+  QJsonArray pluginsArray;
+  for(const auto& plugin : m_Plugins)
+  {
+    QJsonArray filtersArray;
+    for(const auto& filter : plugin.filters)
+    {
+      QJsonObject filterObj;
+      filterObj[SIMPL::JSON::ClassName] = filter.className;
+      filterObj[SIMPL::JSON::Name] = filter.humanLabel;
+      filterObj[SIMPL::JSON::GroupName] = filter.groupName;
+      filterObj[SIMPL::JSON::SubGroupName] = filter.subGroupName;
+      filterObj[SIMPL::JSON::BrandingString] = filter.brandingString;
+      filterObj[SIMPL::JSON::PluginName] = filter.compiledLibraryName;
+      filterObj[SIMPL::JSON::Version] = filter.version;
+      filterObj[SIMPL::JSON::Uuid] = filter.uuid.toString();
+      filtersArray.append(filterObj);
+    }
+
+    QJsonObject pluginObj;
+    pluginObj[SIMPL::JSON::Location] = plugin.filePath;
+    pluginObj[SIMPL::JSON::FileSize] = static_cast<double>(plugin.fileSize);
+    pluginObj[SIMPL::JSON::FileHash] = QString::fromLatin1(plugin.fileHash);
+    pluginObj[SIMPL::JSON::Filters] = filtersArray;
+    pluginsArray.append(pluginObj);
+  }
+
+  QJsonObject json;
+  json[SIMPL::JSON::ManifestVersion] = k_ManifestVersion;
+  json[SIMPL::JSON::SIMPLibVersion] = SIMPLib::Version::Complete();
+  json[SIMPL::JSON::Plugins] = pluginsArray;
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const FilterManifest::PluginInfo* FilterManifest::findValidPlugin(const QString& filePath) const
+{
+  auto iter = m_PluginIndices.find(filePath);
+  if(iter == m_PluginIndices.end())
+  {
+    return nullptr;
+  }
+
+  const PluginInfo& plugin = m_Plugins[iter.value()];
+  // Only hash the file if the cheap check passes
+  QFileInfo fi(filePath);
+  if(!fi.exists() || fi.size() != plugin.fileSize)
+  {
+    return nullptr;
+  }
+  if(plugin.fileHash.isEmpty() || HashFile(filePath) != plugin.fileHash)
+  {
+    return nullptr;
+  }
+  return &plugin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManifest::setPlugin(const PluginInfo& plugin)
+{
+  auto iter = m_PluginIndices.find(plugin.filePath);
+  if(iter != m_PluginIndices.end())
+  {
+    m_Plugins[iter.value()] = plugin;
+  }
+  else
+  {
+    m_PluginIndices.insert(plugin.filePath, m_Plugins.size());
+    m_Plugins.push_back(plugin);
+  }
+  m_Modified = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManifest::removeMissingPlugins()
+{
+  std::vector<PluginInfo> plugins;
+  plugins.reserve(m_Plugins.size());
+  for(const auto& plugin : m_Plugins)
+  {
+    if(QFileInfo::exists(plugin.filePath))
+    {
+      plugins.push_back(plugin);
+    }
+  }
+  if(plugins.size() == m_Plugins.size())
+  {
+    return;
+  }
+
+  clear();
+  for(const auto& plugin : plugins)
+  {
+    setPlugin(plugin);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<FilterManifest::PluginInfo> FilterManifest::getPlugins() const
+{
+  return m_Plugins;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManifest::isModified() const
+{
+  return m_Modified;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManifest::clear()
+{
+  m_Plugins.clear();
+  m_PluginIndices.clear();
+  m_Modified = true;
+}
+
+// -----------------------------------------------------------------------------
+FilterManifest::Pointer FilterManifest::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+FilterManifest::Pointer FilterManifest::New()
+{
+  Pointer sharedPtr(new(FilterManifest));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString FilterManifest::getNameOfClass() const
+{
+  return QString("FilterManifest");
+}
+
+// -----------------------------------------------------------------------------
+QString FilterManifest::ClassName()
+{
+  return QString("FilterManifest");
+}
@@ -0,0 +1,198 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+
+/**
+ * @brief The FilterManifest class caches what the filters of each plugin file report about themselves.
+ * An entry stays valid as long as the size and SHA-1 hash of the plugin file are unchanged, which lets
+ * SIMPLibPluginLoader register the filters of a plugin without loading it.
+ */
+class SIMPLib_EXPORT FilterManifest
+{
+public:
+  using Self = FilterManifest;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for FilterManifest
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for FilterManifest
+   */
+  static QString ClassName();
+
+  FilterManifest();
+  virtual ~FilterManifest();
+
+  /**
+   * @brief Bumped whenever the layout of the manifest file changes
+   */
+  static constexpr int k_ManifestVersion = 1;
+
+  /**
+   * @brief What a filter factory reports about its filter
+   */
+  struct FilterInfo
+  {
+    QString className;
+    QString humanLabel;
+    QString groupName;
+    QString subGroupName;
+    QString brandingString;
+    QString compiledLibraryName;
+    QString version;
+    QUuid uuid;
+  };
+
+  /**
+   * @brief A plugin file and the filters it registers
+   */
+  struct PluginInfo
+  {
+    QString filePath;
+    qint64 fileSize = 0;
+    QByteArray fileHash;
+    std::vector<FilterInfo> filters;
+  };
+
+  /**
+   * @brief Returns the path of the manifest shared by all SIMPL applications of the user. The
+   * SIMPL_FILTER_MANIFEST environment variable overrides it, e.g. to use a manifest generated at build time.
+   * @return
+   */
+  static QString DefaultFilePath();
+
+  /**
+   * @brief Returns the SHA-1 hash of the file contents, or an empty array if the file cannot be read
+   * @param filePath
+   * @return
+   */
+  static QByteArray HashFile(const QString& filePath);
+
+  /**
+   * @brief Collects the information the factory reports without creating a filter
+   * @param factory
+   * @return
+   */
+  static FilterInfo CreateFilterInfo(const IFilterFactory& factory);
+
+  /**
+   * @brief Replaces the contents with the manifest in the file. Returns false and leaves the manifest
+   * empty if the file is missing, unreadable or was written by a different manifest or SIMPLib version.
+   * @param filePath
+   * @return
+   */
+  bool readFile(const QString& filePath);
+
+  /**
+   * @brief Atomically replaces the file with this manifest
+   * @param filePath
+   * @return
+   */
+  bool writeFile(const QString& filePath);
+
+  /**
+   * @brief Replaces the contents with the manifest in the json object. Returns false and leaves the manifest
+   * empty if it was written by a different manifest or SIMPLib version.
+   * @param json
+   * @return
+   */
+  bool readJson(const QJsonObject& json);
+
+  /**
+   * @brief Writes the manifest into a json object
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Returns the entry for the plugin file, or a null pointer if there is none or the file changed since
+   * the entry was written
+   * @param filePath
+   * @return
+   */
+  const PluginInfo* findValidPlugin(const QString& filePath) const;
+
+  /**
+   * @brief Adds the entry, replacing any previous entry for the same plugin file
+   * @param plugin
+   */
+  void setPlugin(const PluginInfo& plugin);
+
+  /**
+   * @brief Drops the entries of plugin files that no longer exist
+   */
+  void removeMissingPlugins();
+
+  /**
+   * @brief Returns every entry in the manifest
+   * @return
+   */
+  std::vector<PluginInfo> getPlugins() const;
+
+  /**
+   * @brief Returns true if entries were added or removed since the manifest was last read or written
+   * @return
+   */
+  bool isModified() const;
+
+private:
+  std::vector<PluginInfo> m_Plugins;
+  QHash<QString, size_t> m_PluginIndices;
+  bool m_Modified = false;
+
+  void clear();
+
+public:
+  FilterManifest(const FilterManifest&) = delete;            // Copy Constructor Not Implemented
+  FilterManifest(FilterManifest&&) = delete;                 // Move Constructor Not Implemented
+  FilterManifest& operator=(const FilterManifest&) = delete; // Copy Assignment Not Implemented
+  FilterManifest& operator=(FilterManifest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,174 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ManifestFilterFactory.h"
+
+#include "SIMPLib/Filtering/FilterManager.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ManifestFilterFactory::ManifestFilterFactory(FilterManager* filterManager, const FilterManifest::FilterInfo& info, const LoadPluginFunction& loadPlugin)
+: m_FilterManager(filterManager)
+, m_Info(info)
+, m_LoadPlugin(loadPlugin)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ManifestFilterFactory::~ManifestFilterFactory() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ManifestFilterFactory::Pointer ManifestFilterFactory::New(FilterManager* filterManager, const FilterManifest::FilterInfo& info, const LoadPluginFunction& loadPlugin)
+{
+  Pointer sharedPtr(new ManifestFilterFactory(filterManager, info, loadPlugin));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IFilterFactory::Pointer ManifestFilterFactory::loadFactory() const
+{
+  if(m_LoadPlugin)
+  {
+    m_LoadPlugin();
+  }
+
+  IFilterFactory::Pointer factory = m_FilterManager->getFactoryFromUuid(m_Info.uuid);
+  if(nullptr == factory || factory->isPlaceholder())
+  {
+    return IFilterFactory::NullPointer();
+  }
+  return factory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ManifestFilterFactory::create() const
+{
+  IFilterFactory::Pointer factory = loadFactory();
+  if(nullptr == factory)
+  {
+    return AbstractFilter::NullPointer();
+  }
+  return factory->create();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getFilterHtmlSummary() const
+{
+  IFilterFactory::Pointer factory = loadFactory();
+  if(nullptr == factory)
+  {
+    return QString();
+  }
+  return factory->getFilterHtmlSummary();
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getFilterClassName() const
+{
+  return m_Info.className;
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getFilterGroup() const
+{
+  return m_Info.groupName;
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getFilterSubGroup() const
+{
+  return m_Info.subGroupName;
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getFilterHumanLabel() const
+{
+  return m_Info.humanLabel;
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getBrandingString() const
+{
+  return m_Info.brandingString;
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getCompiledLibraryName() const
+{
+  return m_Info.compiledLibraryName;
+}
+
+// -----------------------------------------------------------------------------
+QUuid ManifestFilterFactory::getUuid() const
+{
+  return m_Info.uuid;
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getFilterVersion() const
+{
+  return m_Info.version;
+}
+
+// -----------------------------------------------------------------------------
+bool ManifestFilterFactory::isPlaceholder() const
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+ManifestFilterFactory::Pointer ManifestFilterFactory::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::getNameOfClass() const
+{
+  return QString("ManifestFilterFactory");
+}
+
+// -----------------------------------------------------------------------------
+QString ManifestFilterFactory::ClassName()
+{
+  return QString("ManifestFilterFactory");
+}
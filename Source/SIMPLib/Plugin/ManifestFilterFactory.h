@@ -0,0 +1,122 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+#include "SIMPLib/Plugin/FilterManifest.h"
+
+class FilterManager;
+
+/**
+ * @brief The ManifestFilterFactory class stands in for the factory of a filter whose plugin has not been
+ * loaded yet. It answers from the FilterManifest entry of the filter and only loads the plugin once a filter
+ * or its HTML summary is requested. Loading the plugin replaces this factory in the FilterManager.
+ */
+class SIMPLib_EXPORT ManifestFilterFactory : public IFilterFactory
+{
+public:
+  using Self = ManifestFilterFactory;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  using LoadPluginFunction = std::function<void()>;
+
+  /**
+   * @brief Creates the factory
+   * @param filterManager The FilterManager the plugin registers its filters with
+   * @param info The manifest entry of the filter
+   * @param loadPlugin Loads the plugin of the filter. Must be safe to call more than once.
+   * @return
+   */
+  static Pointer New(FilterManager* filterManager, const FilterManifest::FilterInfo& info, const LoadPluginFunction& loadPlugin);
+
+  /**
+   * @brief Returns the name of the class for ManifestFilterFactory
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for ManifestFilterFactory
+   */
+  static QString ClassName();
+
+  ~ManifestFilterFactory() override;
+
+  /**
+   * @brief Loads the plugin and creates the filter with the factory the plugin registered. Returns a null
+   * pointer if the plugin could not be loaded.
+   * @return
+   */
+  AbstractFilter::Pointer create() const override;
+
+  QString getFilterClassName() const override;
+  QString getFilterGroup() const override;
+  QString getFilterSubGroup() const override;
+  QString getFilterHumanLabel() const override;
+  QString getBrandingString() const override;
+  QString getCompiledLibraryName() const override;
+
+  /**
+   * @brief Loads the plugin to generate the summary
+   * @return
+   */
+  QString getFilterHtmlSummary() const override;
+
+  QUuid getUuid() const override;
+  QString getFilterVersion() const override;
+  bool isPlaceholder() const override;
+
+  /**
+   * @brief Loads the plugin and returns the factory it registered for this filter, or a null pointer if it did not
+   * @return
+   */
+  IFilterFactory::Pointer loadFactory() const;
+
+protected:
+  ManifestFilterFactory(FilterManager* filterManager, const FilterManifest::FilterInfo& info, const LoadPluginFunction& loadPlugin);
+
+private:
+  FilterManager* m_FilterManager = nullptr;
+  FilterManifest::FilterInfo m_Info;
+  LoadPluginFunction m_LoadPlugin;
+
+public:
+  ManifestFilterFactory(const ManifestFilterFactory&) = delete;            // Copy Constructor Not Implemented
+  ManifestFilterFactory(ManifestFilterFactory&&) = delete;                 // Move Constructor Not Implemented
+  ManifestFilterFactory& operator=(const ManifestFilterFactory&) = delete; // Copy Assignment Not Implemented
+  ManifestFilterFactory& operator=(ManifestFilterFactory&&) = delete;      // Move Assignment Not Implemented
+};
@@ -68,6 +68,12 @@ const QString FilterParameterHumanLabel("FilterParameterHumanLabel");
 const QString FilterParameterPropertyName("FilterParameterPropertyName");
 const QString FilterParameterReadOnly("FilterParameterReadOnly");
 const QString FilterParameters("FilterParameters");
+
+const QString ManifestVersion("ManifestVersion");
+const QString SIMPLibVersion("SIMPLibVersion");
+const QString BrandingString("BrandingString");
+const QString FileSize("FileSize");
+const QString FileHash("FileHash");
 } // namespace JSON
 
 } // namespace SIMPL
@@ -39,6 +39,9 @@
 #include <unistd.h>
 #endif
 
+#include <memory>
+#include <mutex>
+
 // Qt Includes
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
@@ -47,7 +50,9 @@
 #include <QtCore/QStringList>
 
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Plugin/FilterManifest.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/ManifestFilterFactory.h"
 #include "SIMPLib/Plugin/PluginManager.h"
 
 // -----------------------------------------------------------------------------
@@ -63,7 +68,7 @@ SIMPLibPluginLoader::~SIMPLibPluginLoader() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet, bool loadOnDemand)
 {
   QStringList pluginDirs;
   pluginDirs << qApp->applicationDirPath();
@@ -235,40 +240,99 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
 
   FilterManager::RegisterKnownFilters(filterManager);
 
-  PluginManager* pluginManager = PluginManager::Instance();
+  FilterManifest manifest;
+  QString manifestFilePath = FilterManifest::DefaultFilePath();
+  if(loadOnDemand)
+  {
+    manifest.readFile(manifestFilePath);
+  }
+
   QStringList pluginFileNames;
-  QVector<ISIMPLibPlugin*> loadedPlugins;
 
   // Now that we have a sorted list of plugins, go ahead and load them all from the
   // file system and add each to the toolbar and menu
   for(QString path : pluginFilePaths)
   {
-    if(!quiet)
-    {
-      qDebug() << "Plugin Being Loaded:" << path;
-    }
-    QPluginLoader loader(path);
     QFileInfo fi(path);
     QString fileName = fi.fileName();
-    QObject* plugin = loader.instance();
-    if(!quiet)
+    if(pluginFileNames.contains(fileName, Qt::CaseSensitive))
     {
-      qDebug() << "    Pointer: " << plugin << "\n";
+      continue;
     }
-    if((plugin != nullptr) && !pluginFileNames.contains(fileName, Qt::CaseSensitive))
+
+    const FilterManifest::PluginInfo* pluginInfo = loadOnDemand ? manifest.findValidPlugin(path) : nullptr;
+    if(nullptr != pluginInfo)
     {
-      ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
-      if(ipPlugin != nullptr)
+      if(!quiet)
+      {
+        qDebug() << "Plugin Registered From Manifest:" << path;
+      }
+      std::shared_ptr<std::once_flag> loadFlag = std::make_shared<std::once_flag>();
+      ManifestFilterFactory::LoadPluginFunction loadPlugin = [filterManager, path, quiet, loadFlag]() {
+        std::call_once(*loadFlag, [&]() { LoadPlugin(filterManager, path, quiet); });
+      };
+      for(const auto& filterInfo : pluginInfo->filters)
       {
-        loadedPlugins.push_back(ipPlugin);
-        ipPlugin->registerFilters(filterManager);
-        ipPlugin->setDidLoad(true);
-        ipPlugin->setLocation(path);
-        pluginManager->addPlugin(ipPlugin);
+        filterManager->addFilterFactory(filterInfo.className, ManifestFilterFactory::New(filterManager, filterInfo, loadPlugin));
       }
       pluginFileNames += fileName;
+      continue;
+    }
+
+    FilterManager::Collection previousFactories = filterManager->getFactories();
+    ISIMPLibPlugin* plugin = LoadPlugin(filterManager, path, quiet);
+    if(nullptr == plugin)
+    {
+      continue;
     }
-    else if(!quiet)
+    pluginFileNames += fileName;
+
+    if(loadOnDemand)
+    {
+      FilterManifest::PluginInfo loadedInfo;
+      loadedInfo.filePath = path;
+      loadedInfo.fileSize = fi.size();
+      loadedInfo.fileHash = FilterManifest::HashFile(path);
+      FilterManager::Collection factories = filterManager->getFactories();
+      for(FilterManager::Collection::iterator factory = factories.begin(); factory != factories.end(); ++factory)
+      {
+        if(!previousFactories.contains(factory.key()))
+        {
+          loadedInfo.filters.push_back(FilterManifest::CreateFilterInfo(*factory.value()));
+        }
+      }
+      manifest.setPlugin(loadedInfo);
+    }
+  }
+
+  if(loadOnDemand)
+  {
+    manifest.removeMissingPlugins();
+    if(manifest.isModified() && !manifest.writeFile(manifestFilePath) && !quiet)
+    {
+      qDebug() << "The filter manifest could not be written to" << manifestFilePath;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ISIMPLibPlugin* SIMPLibPluginLoader::LoadPlugin(FilterManager* filterManager, const QString& filePath, bool quiet)
+{
+  if(!quiet)
+  {
+    qDebug() << "Plugin Being Loaded:" << filePath;
+  }
+  QPluginLoader loader(filePath);
+  QObject* plugin = loader.instance();
+  if(!quiet)
+  {
+    qDebug() << "    Pointer: " << plugin << "\n";
+  }
+  if(plugin == nullptr)
+  {
+    if(!quiet)
     {
       QString message("The plugin did not load with the following error\n");
       message.append(loader.errorString());
@@ -276,5 +340,16 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
       message.append("Possible causes include missing libraries that plugin depends on.");
       qDebug() << message;
     }
+    return nullptr;
+  }
+
+  ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
+  if(ipPlugin != nullptr)
+  {
+    ipPlugin->registerFilters(filterManager);
+    ipPlugin->setDidLoad(true);
+    ipPlugin->setLocation(filePath);
+    PluginManager::Instance()->addPlugin(ipPlugin);
   }
+  return ipPlugin;
 }
@@ -35,9 +35,12 @@
 
 #pragma once
 
+#include <QtCore/QString>
+
 #include "SIMPLib/SIMPLib.h"
 
 class FilterManager;
+class ISIMPLibPlugin;
 
 /**
  * @brief The SIMPLibPluginLoader class loads all the plugins that can be
@@ -53,12 +56,24 @@ public:
    * @param filterManager The FilterManager object to load the filters into when
    * a plugin is loaded
    * @param quiet Dump progress to std::cout
+   * @param loadOnDemand Plugins whose entry in the FilterManifest still matches their file are not loaded.
+   * Their filters are registered from the manifest and the plugin is loaded once one of them is created.
+   * Plugins that had to be loaded are added to the manifest.
    */
-  static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false);
+  static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false, bool loadOnDemand = false);
 
 protected:
   SIMPLibPluginLoader();
 
+  /**
+   * @brief Loads the plugin file, registers its filters and adds it to the PluginManager
+   * @param filterManager
+   * @param filePath
+   * @param quiet
+   * @return The plugin or a null pointer if the file is not a plugin that could be loaded
+   */
+  static ISIMPLibPlugin* LoadPlugin(FilterManager* filterManager, const QString& filePath, bool quiet);
+
 public:
   SIMPLibPluginLoader(const SIMPLibPluginLoader&) = delete;            // Copy Constructor Not Implemented
   SIMPLibPluginLoader(SIMPLibPluginLoader&&) = delete;                 // Move Constructor Not Implemented
@@ -49,7 +49,9 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 
 set(SIMPLib_Plugin_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManifest.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ISIMPLibPlugin.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ManifestFilterFactory.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibPluginLoader.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginManager.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginProxy.h
@@ -57,6 +59,8 @@ set(SIMPLib_Plugin_HDRS
 
 )
 set(SIMPLib_Plugin_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManifest.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ManifestFilterFactory.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibPluginLoader.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginManager.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginProxy.cpp
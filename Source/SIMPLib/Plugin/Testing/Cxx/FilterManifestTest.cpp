@@ -0,0 +1,348 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Plugin/FilterManifest.h"
+#include "SIMPLib/Plugin/ManifestFilterFactory.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class FilterManifestTest
+{
+public:
+  FilterManifestTest() = default;
+
+  virtual ~FilterManifestTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString getPluginFilePath() const
+  {
+    return UnitTest::TestTempDir + QString("/FilterManifestTest.plugin");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString getManifestFilePath() const
+  {
+    return UnitTest::TestTempDir + QString("/FilterManifestTest.json");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(getPluginFilePath());
+    QFile::remove(getManifestFilePath());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool WritePluginFile(const QByteArray& contents)
+  {
+    QDir().mkpath(UnitTest::TestTempDir);
+    QFile file(getPluginFilePath());
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      return false;
+    }
+    return file.write(contents) == contents.size();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterManifest::PluginInfo CreatePluginInfo()
+  {
+    FilterManager* fm = FilterManager::Instance();
+
+    FilterManifest::PluginInfo plugin;
+    plugin.filePath = getPluginFilePath();
+    plugin.fileSize = QFileInfo(plugin.filePath).size();
+    plugin.fileHash = FilterManifest::HashFile(plugin.filePath);
+    plugin.filters.push_back(FilterManifest::CreateFilterInfo(*fm->getFactoryFromClassName("CreateDataArray")));
+    plugin.filters.push_back(FilterManifest::CreateFilterInfo(*fm->getFactoryFromClassName("CreateDataContainer")));
+    return plugin;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestJsonRoundTrip()
+  {
+    DREAM3D_REQUIRE(WritePluginFile("0123456789"))
+
+    FilterManifest manifest;
+    DREAM3D_REQUIRE_EQUAL(manifest.isModified(), false)
+    FilterManifest::PluginInfo plugin = CreatePluginInfo();
+    DREAM3D_REQUIRE_EQUAL(plugin.fileSize, 10)
+    DREAM3D_REQUIRE_EQUAL(plugin.fileHash.isEmpty(), false)
+    manifest.setPlugin(plugin);
+    DREAM3D_REQUIRE_EQUAL(manifest.isModified(), true)
+
+    QJsonObject json = manifest.toJson();
+    FilterManifest readManifest;
+    DREAM3D_REQUIRE(readManifest.readJson(json))
+    DREAM3D_REQUIRE_EQUAL(readManifest.isModified(), false)
+
+    const FilterManifest::PluginInfo* readPlugin = readManifest.findValidPlugin(plugin.filePath);
+    DREAM3D_REQUIRE_VALID_POINTER(readPlugin)
+    DREAM3D_REQUIRE_EQUAL(readPlugin->fileHash, plugin.fileHash)
+    DREAM3D_REQUIRE_EQUAL(readPlugin->filters.size(), plugin.filters.size())
+    for(size_t i = 0; i < plugin.filters.size(); i++)
+    {
+      const FilterManifest::FilterInfo& expected = plugin.filters[i];
+      const FilterManifest::FilterInfo& actual = readPlugin->filters[i];
+      DREAM3D_REQUIRE_EQUAL(actual.className, expected.className)
+      DREAM3D_REQUIRE_EQUAL(actual.humanLabel, expected.humanLabel)
+      DREAM3D_REQUIRE_EQUAL(actual.groupName, expected.groupName)
+      DREAM3D_REQUIRE_EQUAL(actual.subGroupName, expected.subGroupName)
+      DREAM3D_REQUIRE_EQUAL(actual.brandingString, expected.brandingString)
+      DREAM3D_REQUIRE_EQUAL(actual.compiledLibraryName, expected.compiledLibraryName)
+      DREAM3D_REQUIRE_EQUAL(actual.version, expected.version)
+      DREAM3D_REQUIRE(actual.uuid == expected.uuid)
+    }
+
+    // A manifest written by a different version is discarded
+    json[SIMPL::JSON::ManifestVersion] = FilterManifest::k_ManifestVersion + 1;
+    DREAM3D_REQUIRE_EQUAL(readManifest.readJson(json), false)
+    DREAM3D_REQUIRE_EQUAL(readManifest.getPlugins().size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFileRoundTrip()
+  {
+    DREAM3D_REQUIRE(WritePluginFile("0123456789"))
+
+    FilterManifest manifest;
+    manifest.setPlugin(CreatePluginInfo());
+    DREAM3D_REQUIRE(manifest.writeFile(getManifestFilePath()))
+    DREAM3D_REQUIRE_EQUAL(manifest.isModified(), false)
+
+    FilterManifest readManifest;
+    DREAM3D_REQUIRE(readManifest.readFile(getManifestFilePath()))
+    DREAM3D_REQUIRE_EQUAL(readManifest.getPlugins().size(), 1)
+    DREAM3D_REQUIRE_VALID_POINTER(readManifest.findValidPlugin(getPluginFilePath()))
+
+    DREAM3D_REQUIRE_EQUAL(readManifest.readFile(UnitTest::TestTempDir + QString("/FilterManifestTest_Missing.json")), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPluginInvalidation()
+  {
+    DREAM3D_REQUIRE(WritePluginFile("0123456789"))
+
+    FilterManifest manifest;
+    manifest.setPlugin(CreatePluginInfo());
+    DREAM3D_REQUIRE_VALID_POINTER(manifest.findValidPlugin(getPluginFilePath()))
+    DREAM3D_REQUIRE_NULL_POINTER(manifest.findValidPlugin(UnitTest::TestTempDir + QString("/Unknown.plugin")))
+
+    // Same size, different contents
+    DREAM3D_REQUIRE(WritePluginFile("9876543210"))
+    DREAM3D_REQUIRE_NULL_POINTER(manifest.findValidPlugin(getPluginFilePath()))
+
+    // Different size
+    DREAM3D_REQUIRE(WritePluginFile("01234567890123456789"))
+    DREAM3D_REQUIRE_NULL_POINTER(manifest.findValidPlugin(getPluginFilePath()))
+
+    // Entries of deleted plugin files are dropped
+    DREAM3D_REQUIRE(QFile::remove(getPluginFilePath()))
+    manifest.removeMissingPlugins();
+    DREAM3D_REQUIRE_EQUAL(manifest.getPlugins().size(), 0)
+    DREAM3D_REQUIRE_EQUAL(manifest.isModified(), true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPlaceholderFactory()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("CreateDataArray");
+    DREAM3D_REQUIRE_VALID_POINTER(factory.get())
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(factory->getFilterHumanLabel()) == factory)
+    FilterManifest::FilterInfo info = FilterManifest::CreateFilterInfo(*factory);
+
+    // Stand in for the factory the way an unloaded plugin would
+    int loadCount = 0;
+    auto loadPlugin = [&] {
+      loadCount++;
+      if(fm->getFactoryFromUuid(info.uuid)->isPlaceholder())
+      {
+        fm->addFilterFactory(info.className, factory);
+      }
+    };
+    DREAM3D_REQUIRE(fm->removeFilterFactory(info.uuid))
+    ManifestFilterFactory::Pointer placeholder = ManifestFilterFactory::New(fm, info, loadPlugin);
+    fm->addFilterFactory(info.className, placeholder);
+
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(info.uuid) == placeholder)
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(info.humanLabel) == placeholder)
+    DREAM3D_REQUIRE(placeholder->isPlaceholder())
+    DREAM3D_REQUIRE_EQUAL(placeholder->getFilterClassName(), info.className)
+    DREAM3D_REQUIRE_EQUAL(placeholder->getFilterVersion(), factory->getFilterVersion())
+
+    // Listing the filters does not load the plugin
+    bool found = false;
+    QJsonArray filterArray = fm->toJsonArray();
+    for(const auto& filterValue : filterArray)
+    {
+      QJsonObject filterObj = filterValue.toObject();
+      if(filterObj[SIMPL::JSON::Uuid].toString() == info.uuid.toString())
+      {
+        found = true;
+        DREAM3D_REQUIRE_EQUAL(filterObj[SIMPL::JSON::ClassName].toString(), info.className)
+        DREAM3D_REQUIRE_EQUAL(filterObj[SIMPL::JSON::Version].toString(), info.version)
+      }
+    }
+    DREAM3D_REQUIRE(found)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    // Creating a filter loads the plugin, which replaces the placeholder
+    AbstractFilter::Pointer filter = placeholder->create();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+    DREAM3D_REQUIRE_EQUAL(filter->getNameOfClass(), info.className)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(info.uuid) == factory)
+    DREAM3D_REQUIRE(fm->getFactoryFromClassName(info.className) == factory)
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(info.humanLabel) == factory)
+
+    // A placeholder whose plugin does not register the filter creates nothing
+    DREAM3D_REQUIRE(fm->removeFilterFactory(info.uuid))
+    placeholder = ManifestFilterFactory::New(fm, info, [] {});
+    fm->addFilterFactory(info.className, placeholder);
+    DREAM3D_REQUIRE_NULL_POINTER(placeholder->create())
+
+    DREAM3D_REQUIRE(fm->removeFilterFactory(info.uuid))
+    fm->addFilterFactory(info.className, factory);
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(info.humanLabel) == factory)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentPlaceholderLoad()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("CreateDataArray");
+    DREAM3D_REQUIRE_VALID_POINTER(factory.get())
+    FilterManifest::FilterInfo info = FilterManifest::CreateFilterInfo(*factory);
+
+    // Load the plugin once, like SIMPLibPluginLoader does, from whichever thread gets there first
+    std::once_flag loadFlag;
+    std::atomic<int> loadCount(0);
+    auto loadPlugin = [&] {
+      std::call_once(loadFlag, [&] {
+        loadCount++;
+        fm->addFilterFactory(info.className, factory);
+      });
+    };
+    DREAM3D_REQUIRE(fm->removeFilterFactory(info.uuid))
+    ManifestFilterFactory::Pointer placeholder = ManifestFilterFactory::New(fm, info, loadPlugin);
+    fm->addFilterFactory(info.className, placeholder);
+
+    // Readers walk the registered factories while the placeholders are resolved
+    std::atomic<bool> done(false);
+    std::thread reader([&] {
+      while(!done)
+      {
+        fm->toJsonArray();
+        fm->getFactoryFromHumanName(info.humanLabel);
+        fm->getGroupNames();
+      }
+    });
+
+    const size_t numThreads = 8;
+    std::vector<AbstractFilter::Pointer> filters(numThreads);
+    std::vector<std::thread> creators;
+    for(size_t i = 0; i < numThreads; i++)
+    {
+      creators.emplace_back([&, i] { filters[i] = placeholder->create(); });
+    }
+    for(auto& creator : creators)
+    {
+      creator.join();
+    }
+    done = true;
+    reader.join();
+
+    DREAM3D_REQUIRE_EQUAL(loadCount.load(), 1)
+    for(const auto& filter : filters)
+    {
+      DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+      DREAM3D_REQUIRE_EQUAL(filter->getNameOfClass(), info.className)
+    }
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(info.uuid) == factory)
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(info.humanLabel) == factory)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### FilterManifestTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestJsonRoundTrip());
+    DREAM3D_REGISTER_TEST(TestFileRoundTrip());
+    DREAM3D_REGISTER_TEST(TestPluginInvalidation());
+    DREAM3D_REGISTER_TEST(TestPlaceholderFactory());
+    DREAM3D_REGISTER_TEST(TestConcurrentPlaceholderLoad());
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  FilterManifestTest(const FilterManifestTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const FilterManifestTest&) = delete;     // Move assignment Not Implemented
+};
@@ -128,6 +128,11 @@ public:
     return m_Uuid;
   }
 
+  QString getFilterVersion() const override
+  {
+    return m_FilterVersion;
+  }
+
 protected:
   PythonFilterFactory(pybind11::object typeObject)
   : m_TypeObject(typeObject)
@@ -140,6 +145,7 @@ protected:
     m_BrandingString = filter->getBrandingString();
     m_CompiledLibraryName = filter->getCompiledLibraryName();
     m_Uuid = filter->getUuid();
+    m_FilterVersion = filter->getFilterVersion();
     m_HtmlSummary = filter->generateHtmlSummary();
   }
 
@@ -151,6 +157,7 @@ private:
   QString m_HumanName;
   QString m_BrandingString;
   QString m_CompiledLibraryName;
+  QString m_FilterVersion;
   QString m_HtmlSummary;
   QUuid m_Uuid;
 
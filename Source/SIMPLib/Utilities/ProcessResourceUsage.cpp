@@ -0,0 +1,162 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ProcessResourceUsage.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <libproc.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include <sys/resource.h>
+#include <time.h>
+
+#include <QtCore/QFile>
+#endif
+
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
+
+namespace
+{
+#if defined(_WIN32)
+// -----------------------------------------------------------------------------
+quint64 FileTimeToMicroseconds(const FILETIME& fileTime)
+{
+  ULARGE_INTEGER value;
+  value.LowPart = fileTime.dwLowDateTime;
+  value.HighPart = fileTime.dwHighDateTime;
+  return value.QuadPart / 10;
+}
+#else
+// -----------------------------------------------------------------------------
+quint64 TimeValToMicroseconds(const timeval& time)
+{
+  return static_cast<quint64>(time.tv_sec) * 1000000 + static_cast<quint64>(time.tv_usec);
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProcessResourceUsage ProcessResourceUsage::Sample()
+{
+  ProcessResourceUsage usage;
+  usage.bytesAllocated = DataArrayStorageSettings::GetTotalAllocatedBytes();
+
+#if defined(_WIN32)
+  HANDLE process = GetCurrentProcess();
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if(GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime) != 0)
+  {
+    usage.cpuTime = FileTimeToMicroseconds(kernelTime) + FileTimeToMicroseconds(userTime);
+  }
+  PROCESS_MEMORY_COUNTERS memoryCounters;
+  if(GetProcessMemoryInfo(process, &memoryCounters, sizeof(memoryCounters)) != 0)
+  {
+    usage.peakResidentBytes = memoryCounters.PeakWorkingSetSize;
+  }
+  IO_COUNTERS ioCounters;
+  if(GetProcessIoCounters(process, &ioCounters) != 0)
+  {
+    usage.bytesRead = ioCounters.ReadTransferCount;
+    usage.bytesWritten = ioCounters.WriteTransferCount;
+  }
+#else
+  rusage resourceUsage;
+  if(getrusage(RUSAGE_SELF, &resourceUsage) == 0)
+  {
+    usage.cpuTime = TimeValToMicroseconds(resourceUsage.ru_utime) + TimeValToMicroseconds(resourceUsage.ru_stime);
+#if defined(__APPLE__)
+    usage.peakResidentBytes = static_cast<quint64>(resourceUsage.ru_maxrss);
+#else
+    usage.peakResidentBytes = static_cast<quint64>(resourceUsage.ru_maxrss) * 1024;
+#endif
+  }
+#if defined(__APPLE__)
+  rusage_info_v2 info;
+  if(proc_pid_rusage(getpid(), RUSAGE_INFO_V2, reinterpret_cast<rusage_info_t*>(&info)) == 0)
+  {
+    usage.bytesRead = info.ri_diskio_bytesread;
+    usage.bytesWritten = info.ri_diskio_byteswritten;
+  }
+#else
+  // rchar and wchar count every byte passed through read() and write(), whether or not it came from the page cache
+  QFile ioFile("/proc/self/io");
+  if(ioFile.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    for(const QByteArray& line : ioFile.readAll().split('\n'))
+    {
+      if(line.startsWith("rchar:"))
+      {
+        usage.bytesRead = line.mid(6).trimmed().toULongLong();
+      }
+      else if(line.startsWith("wchar:"))
+      {
+        usage.bytesWritten = line.mid(6).trimmed().toULongLong();
+      }
+    }
+  }
+#endif
+#endif
+
+  return usage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 ProcessResourceUsage::SampleThreadCpuTime()
+{
+#if defined(_WIN32)
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if(GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime) != 0)
+  {
+    return FileTimeToMicroseconds(kernelTime) + FileTimeToMicroseconds(userTime);
+  }
+#else
+  timespec time;
+  if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0)
+  {
+    return static_cast<quint64>(time.tv_sec) * 1000000 + static_cast<quint64>(time.tv_nsec) / 1000;
+  }
+#endif
+  return 0;
+}
@@ -0,0 +1,83 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QtGlobal>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ProcessResourceUsage class is a snapshot of the resources the whole process has used so far.
+ * Every value only grows, so the difference of two snapshots is what the process used in between. Values
+ * the operating system does not report stay zero.
+ */
+class SIMPLib_EXPORT ProcessResourceUsage
+{
+public:
+  /**
+   * @brief Samples the counters of the current process
+   * @return
+   */
+  static ProcessResourceUsage Sample();
+
+  /**
+   * @brief Returns the user plus system CPU time of the calling thread in microseconds, or zero if the
+   * operating system does not report it. Work the thread hands to other threads is not included.
+   * @return
+   */
+  static quint64 SampleThreadCpuTime();
+
+  /**
+   * @brief User plus system CPU time of all threads in microseconds
+   */
+  quint64 cpuTime = 0;
+
+  /**
+   * @brief The largest resident set size the process has reached in bytes. This high-water mark never
+   * drops, so the difference of two samples is how far it rose in between, not what was allocated.
+   */
+  quint64 peakResidentBytes = 0;
+
+  /**
+   * @brief Bytes requested from files and other I/O handles
+   */
+  quint64 bytesRead = 0;
+
+  /**
+   * @brief Bytes handed to files and other I/O handles
+   */
+  quint64 bytesWritten = 0;
+
+  /**
+   * @brief Bytes allocated for DataArray elements, see DataArrayStorageSettings::GetTotalAllocatedBytes()
+   */
+  quint64 bytesAllocated = 0;
+};
@@ -32,7 +32,14 @@
 
 #include "SIMPLH5DataReader.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include <QtCore/QDebug>
 
@@ -43,13 +50,463 @@
 using namespace H5Support;
 
 #include "SIMPLib/Common/IObserver.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/DataContainerBundle.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5GlobalLock.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
 const QString Title = "HDF5 Read Error";
 
+namespace
+{
+/**
+ * @brief Counters shared by the read tasks and the thread that reports progress. Every task signals
+ * the condition when its array is complete so progress is reported per array.
+ */
+struct ReadProgress
+{
+  std::mutex mutex;
+  std::condition_variable arrayCompleted;
+  size_t arraysRead = 0;
+  size_t bytesRead = 0;
+};
+
+/*
+ * Every HDF5 call in this file is made while holding H5GlobalLock, so the read tasks take turns inside
+ * the library. Chunked datasets are read with H5Dread one layer of chunks at a time, taking the lock for
+ * each layer, so no array holds the library for its whole read and the memory used for decoding is bounded
+ * by HDF5's own chunk handling. Allocating, byte swapping and cropping happen outside of the lock and run
+ * in parallel across the arrays.
+ */
+struct ArrayReadRequest
+{
+  AttributeMatrix::Pointer attributeMatrix;
+  hid_t amGid = -1;
+  QString name;
+  QString filePath;
+  QString groupPath;
+  bool deferred = false;
+  bool cropped = false;
+  SIMPLH5DataReader::ImageCrop crop;
+  IDataArray::Pointer array;
+};
+
+/**
+ * @brief Reverses the byte order of every element in the buffer
+ */
+void ByteSwapBuffer(uint8_t* data, size_t numElements, size_t typeSize)
+{
+  for(size_t i = 0; i < numElements; i++)
+  {
+    std::reverse(data + i * typeSize, data + (i + 1) * typeSize);
+  }
+}
+
+/**
+ * @brief Returns the number of voxels in the crop
+ */
+size_t CropTupleCount(const SIMPLH5DataReader::ImageCrop& crop)
+{
+  return crop.count[0] * crop.count[1] * crop.count[2];
+}
+
+/**
+ * @brief Copies the voxels of the crop out of an array that holds the complete volume. Used for the
+ * array classes that cannot be read with a hyperslab.
+ */
+IDataArray::Pointer CropArray(const IDataArray::Pointer& source, const SIMPLH5DataReader::ImageCrop& crop)
+{
+  if(nullptr == source || source->getNumberOfTuples() != crop.sourceDims[0] * crop.sourceDims[1] * crop.sourceDims[2])
+  {
+    return source;
+  }
+  IDataArray::Pointer cropped = source->createNewArray(CropTupleCount(crop), source->getComponentDimensions(), source->getName(), true);
+  size_t destOffset = 0;
+  for(size_t z = 0; z < crop.count[2]; z++)
+  {
+    for(size_t y = 0; y < crop.count[1]; y++)
+    {
+      size_t srcOffset = ((crop.start[2] + z) * crop.sourceDims[1] + (crop.start[1] + y)) * crop.sourceDims[0] + crop.start[0];
+      cropped->copyFromArray(destOffset, source, srcOffset, crop.count[0]);
+      destOffset += crop.count[0];
+    }
+  }
+  return cropped;
+}
+
+/**
+ * @brief Reads a numeric dataset into an allocated buffer using the file's own data type so HDF5 does
+ * not run its conversion pass. When a crop is given only the voxels of the crop are selected from the
+ * file. Must be called with the HDF5 lock held.
+ * @return false if the dataset is not a plain integer or float dataset of the expected element size and shape
+ */
+bool ReadRawDataset(hid_t amGid, const QString& name, void* data, size_t typeSize, const SIMPLH5DataReader::ImageCrop* crop, bool& needsByteSwap)
+{
+  hid_t did = H5Dopen(amGid, name.toLatin1().data(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    return false;
+  }
+  hid_t fileType = H5Dget_type(did);
+  hid_t fileSpace = H5S_ALL;
+  hid_t memSpace = H5S_ALL;
+
+  bool success = false;
+  H5T_class_t typeClass = H5Tget_class(fileType);
+  if((typeClass == H5T_INTEGER || typeClass == H5T_FLOAT) && H5Tget_size(fileType) == typeSize)
+  {
+    success = true;
+    if(nullptr != crop)
+    {
+      // The dataset is stored ZYX followed by the component dimensions
+      fileSpace = H5Dget_space(did);
+      int rank = H5Sget_simple_extent_ndims(fileSpace);
+      std::vector<hsize_t> dims(rank > 0 ? rank : 0);
+      H5Sget_simple_extent_dims(fileSpace, dims.data(), nullptr);
+      success = (rank >= 3 && dims[0] == crop->sourceDims[2] && dims[1] == crop->sourceDims[1] && dims[2] == crop->sourceDims[0]);
+      if(success)
+      {
+        std::vector<hsize_t> start(rank, 0);
+        std::vector<hsize_t> count(dims);
+        for(size_t i = 0; i < 3; i++)
+        {
+          start[i] = crop->start[2 - i];
+          count[i] = crop->count[2 - i];
+        }
+        success = (H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr) >= 0);
+        memSpace = H5Screate_simple(rank, count.data(), nullptr);
+      }
+    }
+    if(success)
+    {
+      success = (H5Dread(did, fileType, memSpace, fileSpace, H5P_DEFAULT, data) >= 0);
+      needsByteSwap = (H5Tget_order(fileType) != H5Tget_order(H5T_NATIVE_INT));
+    }
+  }
+  if(memSpace != H5S_ALL)
+  {
+    H5Sclose(memSpace);
+  }
+  if(fileSpace != H5S_ALL)
+  {
+    H5Sclose(fileSpace);
+  }
+  H5Tclose(fileType);
+  H5Dclose(did);
+  return success;
+}
+
+/**
+ * @brief A chunked dataset that is read one layer of chunks at a time, along with the region of it
+ * that is read. The region is the crop, or the whole dataset if no crop is given.
+ */
+struct ChunkedDataset
+{
+  hid_t did = -1;
+  hid_t fileType = -1;
+  hid_t fileSpace = -1;
+  hid_t memSpace = -1;
+  std::vector<hsize_t> chunkDims;
+  std::vector<hsize_t> regionStart;
+  std::vector<hsize_t> regionCount;
+  bool needsByteSwap = false;
+};
+
+/**
+ * @brief Closes the handles opened by OpenChunkedDataset(). Must be called with the HDF5 lock held.
+ */
+void CloseChunkedDataset(ChunkedDataset& dataset)
+{
+  if(dataset.memSpace >= 0)
+  {
+    H5Sclose(dataset.memSpace);
+  }
+  if(dataset.fileSpace >= 0)
+  {
+    H5Sclose(dataset.fileSpace);
+  }
+  if(dataset.fileType >= 0)
+  {
+    H5Tclose(dataset.fileType);
+  }
+  if(dataset.did >= 0)
+  {
+    H5Dclose(dataset.did);
+  }
+  dataset = ChunkedDataset();
+}
+
+/**
+ * @brief Opens a chunked dataset and works out the region that is read. Must be called with the HDF5
+ * lock held.
+ * @return false if the dataset is not chunked or is not a plain integer or float dataset of the expected
+ * element size and shape. Nothing is left open and the dataset is then read with ReadRawDataset() instead.
+ */
+bool OpenChunkedDataset(hid_t amGid, const QString& name, size_t typeSize, const SIMPLH5DataReader::ImageCrop* crop, ChunkedDataset& dataset)
+{
+  dataset.did = H5Dopen(amGid, name.toLatin1().data(), H5P_DEFAULT);
+  if(dataset.did < 0)
+  {
+    return false;
+  }
+  dataset.fileType = H5Dget_type(dataset.did);
+  dataset.fileSpace = H5Dget_space(dataset.did);
+  hid_t createProps = H5Dget_create_plist(dataset.did);
+
+  bool success = false;
+  H5T_class_t typeClass = H5Tget_class(dataset.fileType);
+  int rank = H5Sget_simple_extent_ndims(dataset.fileSpace);
+  if((typeClass == H5T_INTEGER || typeClass == H5T_FLOAT) && H5Tget_size(dataset.fileType) == typeSize && rank > 0 && H5Pget_layout(createProps) == H5D_CHUNKED)
+  {
+    std::vector<hsize_t> dims(rank);
+    H5Sget_simple_extent_dims(dataset.fileSpace, dims.data(), nullptr);
+    dataset.chunkDims.resize(rank);
+    success = (H5Pget_chunk(createProps, rank, dataset.chunkDims.data()) == rank);
+
+    dataset.regionStart.assign(rank, 0);
+    dataset.regionCount = dims;
+    if(success && nullptr != crop)
+    {
+      // The dataset is stored ZYX followed by the component dimensions
+      success = (rank >= 3 && dims[0] == crop->sourceDims[2] && dims[1] == crop->sourceDims[1] && dims[2] == crop->sourceDims[0]);
+      for(size_t i = 0; success && i < 3; i++)
+      {
+        dataset.regionStart[i] = crop->start[2 - i];
+        dataset.regionCount[i] = crop->count[2 - i];
+      }
+    }
+    for(int d = 0; success && d < rank; d++)
+    {
+      success = (dataset.chunkDims[d] > 0 && dataset.regionCount[d] > 0);
+    }
+    if(success)
+    {
+      dataset.memSpace = H5Screate_simple(rank, dataset.regionCount.data(), nullptr);
+      success = (dataset.memSpace >= 0);
+    }
+    dataset.needsByteSwap = (H5Tget_order(dataset.fileType) != H5Tget_order(H5T_NATIVE_INT));
+  }
+  H5Pclose(createProps);
+  if(!success)
+  {
+    CloseChunkedDataset(dataset);
+  }
+  return success;
+}
+
+/**
+ * @brief Reads the part of the region that lies in one layer of chunks along the slowest dimension into
+ * the buffer, which holds the region in C order. The selection only touches the chunks of that layer, so
+ * every chunk is read and run through the dataset's filter pipeline once. Must be called with the HDF5
+ * lock held.
+ */
+bool ReadChunkLayer(ChunkedDataset& dataset, hsize_t layer, void* data)
+{
+  std::vector<hsize_t> fileStart(dataset.regionStart);
+  std::vector<hsize_t> memStart(dataset.regionStart.size(), 0);
+  std::vector<hsize_t> count(dataset.regionCount);
+
+  const hsize_t layerStart = std::max(layer * dataset.chunkDims[0], dataset.regionStart[0]);
+  const hsize_t layerEnd = std::min((layer + 1) * dataset.chunkDims[0], dataset.regionStart[0] + dataset.regionCount[0]);
+  fileStart[0] = layerStart;
+  memStart[0] = layerStart - dataset.regionStart[0];
+  count[0] = layerEnd - layerStart;
+
+  bool success = (H5Sselect_hyperslab(dataset.fileSpace, H5S_SELECT_SET, fileStart.data(), nullptr, count.data(), nullptr) >= 0);
+  success = success && (H5Sselect_hyperslab(dataset.memSpace, H5S_SELECT_SET, memStart.data(), nullptr, count.data(), nullptr) >= 0);
+  return success && (H5Dread(dataset.did, dataset.fileType, dataset.memSpace, dataset.fileSpace, H5P_DEFAULT, data) >= 0);
+}
+
+/**
+ * @brief Reads a numeric dataset into an allocated buffer in native byte order. Takes the HDF5 lock
+ * itself. Chunked datasets are read one layer of chunks at a time and the lock is released between the
+ * layers, so the reads of other arrays interleave with this one instead of waiting for all of it. The
+ * buffer is byte swapped without the lock. Must be called without holding the lock.
+ * @return false if the dataset could not be read this way; it must then be read with the regular reader
+ */
+bool ReadNumericDataset(hid_t gid, const QString& name, void* data, size_t numElements, size_t typeSize, const SIMPLH5DataReader::ImageCrop* crop)
+{
+  bool success = false;
+  bool needsByteSwap = false;
+  bool chunked = false;
+  ChunkedDataset dataset;
+  {
+    H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+    chunked = OpenChunkedDataset(gid, name, typeSize, crop, dataset);
+    if(!chunked)
+    {
+      success = ReadRawDataset(gid, name, data, typeSize, crop, needsByteSwap);
+    }
+  }
+  if(chunked)
+  {
+    size_t regionElements = 1;
+    for(hsize_t count : dataset.regionCount)
+    {
+      regionElements *= count;
+    }
+    success = (regionElements == numElements);
+
+    const hsize_t firstLayer = dataset.regionStart[0] / dataset.chunkDims[0];
+    const hsize_t lastLayer = (dataset.regionStart[0] + dataset.regionCount[0] - 1) / dataset.chunkDims[0];
+    for(hsize_t layer = firstLayer; success && layer <= lastLayer; layer++)
+    {
+      H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+      success = ReadChunkLayer(dataset, layer, data);
+    }
+    needsByteSwap = dataset.needsByteSwap;
+
+    H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+    CloseChunkedDataset(dataset);
+    if(!success)
+    {
+      success = ReadRawDataset(gid, name, data, typeSize, crop, needsByteSwap);
+    }
+  }
+  if(success && needsByteSwap && typeSize > 1)
+  {
+    ByteSwapBuffer(reinterpret_cast<uint8_t*>(data), numElements, typeSize);
+  }
+  return success;
+}
+
+/**
+ * @brief Creates the loader of a lazily loaded array. The loader opens the file again when the array is
+ * first touched, which may be long after the reader was closed.
+ */
+IDataArray::DeferredLoaderType CreateDeferredLoader(const ArrayReadRequest& request)
+{
+  QString filePath = request.filePath;
+  QString groupPath = request.groupPath;
+  QString name = request.name;
+  bool cropped = request.cropped;
+  SIMPLH5DataReader::ImageCrop crop = request.crop;
+
+  return [filePath, groupPath, name, cropped, crop](void* buffer, size_t numElements, size_t typeSize) -> bool {
+    hid_t fileId = -1;
+    hid_t gid = -1;
+    {
+      H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+      fileId = QH5Utilities::openFile(filePath, true);
+      if(fileId < 0)
+      {
+        return false;
+      }
+      gid = H5Gopen(fileId, groupPath.toLatin1().data(), H5P_DEFAULT);
+    }
+
+    bool success = (gid >= 0) && ReadNumericDataset(gid, name, buffer, numElements, typeSize, cropped ? &crop : nullptr);
+
+    H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+    if(gid >= 0 && !success)
+    {
+      IDataArray::Pointer array = H5DataArrayReader::ReadIDataArray(gid, name, false);
+      if(cropped)
+      {
+        array = CropArray(array, crop);
+      }
+      if(nullptr != array && array->getSize() == numElements && array->getTypeSize() == typeSize)
+      {
+        std::memcpy(buffer, array->getVoidPointer(0), numElements * typeSize);
+        success = true;
+      }
+    }
+    if(gid >= 0)
+    {
+      H5Gclose(gid);
+    }
+    QH5Utilities::closeFile(fileId);
+    return success;
+  };
+}
+
+/**
+ * @brief Reads one array of an AttributeMatrix. Numeric arrays are allocated, decoded and byte swapped
+ * outside of the HDF5 lock; every other array class is read through the regular reader while holding it.
+ */
+class ReadArrayTask
+{
+public:
+  ReadArrayTask(ArrayReadRequest* request, ReadProgress* progress)
+  : m_Request(request)
+  , m_Progress(progress)
+  {
+  }
+
+  void operator()() const
+  {
+    m_Request->array = readArray();
+    size_t bytes = 0;
+    if(nullptr != m_Request->array && !m_Request->array->hasDeferredLoader())
+    {
+      bytes = m_Request->array->getSize() * m_Request->array->getTypeSize();
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_Progress->mutex);
+      m_Progress->bytesRead += bytes;
+      m_Progress->arraysRead++;
+    }
+    m_Progress->arrayCompleted.notify_one();
+  }
+
+private:
+  ArrayReadRequest* m_Request = nullptr;
+  ReadProgress* m_Progress = nullptr;
+
+  IDataArray::Pointer readArray() const
+  {
+    hid_t amGid = m_Request->amGid;
+    const QString& name = m_Request->name;
+    const SIMPLH5DataReader::ImageCrop* crop = m_Request->cropped ? &m_Request->crop : nullptr;
+
+    IDataArray::Pointer metaData;
+    {
+      H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+      QString classType;
+      QH5Lite::readStringAttribute(amGid, name, SIMPL::HDF5::ObjectType, classType);
+      if(!classType.startsWith("DataArray"))
+      {
+        IDataArray::Pointer array = AttributeMatrix::ReadAttributeArrayFromHDF5(amGid, name, false);
+        return (nullptr != crop) ? CropArray(array, *crop) : array;
+      }
+      metaData = H5DataArrayReader::ReadIDataArray(amGid, name, true);
+    }
+    if(nullptr == metaData)
+    {
+      return metaData;
+    }
+
+    size_t numTuples = (nullptr != crop) ? CropTupleCount(*crop) : metaData->getNumberOfTuples();
+    if(m_Request->deferred)
+    {
+      IDataArray::Pointer array = metaData->createNewArray(numTuples, metaData->getComponentDimensions(), name, false);
+      if(array->getSize() > 0 && array->setDeferredLoader(CreateDeferredLoader(*m_Request)))
+      {
+        return array;
+      }
+    }
+    IDataArray::Pointer array = metaData->createNewArray(numTuples, metaData->getComponentDimensions(), name, true);
+    if(array->getSize() > 0 && !array->isAllocated())
+    {
+      return IDataArray::NullPointer();
+    }
+
+    if(array->getSize() > 0 && !ReadNumericDataset(amGid, name, array->getVoidPointer(0), array->getSize(), array->getTypeSize(), crop))
+    {
+      H5GlobalLock::Guard lock(H5GlobalLock::Mutex());
+      array = H5DataArrayReader::ReadIDataArray(amGid, name, false);
+      return (nullptr != crop) ? CropArray(array, *crop) : array;
+    }
+    return array;
+  }
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -78,6 +535,7 @@ bool SIMPLH5DataReader::openFile(const QString& filePath)
     return false;
   }
 
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   m_FileId = QH5Utilities::openFile(filePath, true); // Open the file Read Only
   if(m_FileId < 0)
   {
@@ -96,6 +554,7 @@ bool SIMPLH5DataReader::openFile(const QString& filePath)
 // -----------------------------------------------------------------------------
 bool SIMPLH5DataReader::closeFile()
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   herr_t err = QH5Utilities::closeFile(m_FileId); // Open the file Read Only
   if(err < 0)
   {
@@ -128,6 +587,9 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(DataConta
   bool check = false;
   DataContainerArray::Pointer dca = DataContainerArray::New();
 
+  // Released while the arrays are read because the read tasks take the lock themselves
+  std::unique_lock<H5GlobalLock::MutexType> h5Lock(H5GlobalLock::Mutex());
+
   // Check to see if version of .dream3d file is prior to new data container names
   err = QH5Lite::readStringAttribute(m_FileId, "/", SIMPL::HDF5::FileVersionName, m_FileVersion);
   fVersion = m_FileVersion.toFloat(&check);
@@ -161,11 +623,46 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(DataConta
     return DataContainerArray::NullPointer();
   }
 
-  err = dca->readDataContainersFromHDF5(preflight, dcaGid, proxy, this);
+  QMap<QString, ImageCrop> crops;
+  if(preflight)
+  {
+    err = dca->readDataContainersFromHDF5(preflight, dcaGid, proxy, this);
+    if(err >= 0 && m_UseImageRegionOfInterest)
+    {
+      err = applyImageRegionOfInterest(dca, crops);
+    }
+  }
+  else
+  {
+    // Build the DataContainers, Geometries and AttributeMatrices first, then read the arrays on the thread pool
+    DataContainerArrayProxy structureProxy = proxy;
+    for(auto& dcProxy : structureProxy.getDataContainers())
+    {
+      for(auto& amProxy : dcProxy.getAttributeMatricies())
+      {
+        for(auto& daProxy : amProxy.getDataArrays())
+        {
+          daProxy.setFlag(SIMPL::Unchecked);
+        }
+      }
+    }
+    err = dca->readDataContainersFromHDF5(preflight, dcaGid, structureProxy, this);
+    if(err >= 0 && m_UseImageRegionOfInterest)
+    {
+      err = applyImageRegionOfInterest(dca, crops);
+    }
+    if(err >= 0)
+    {
+      h5Lock.unlock();
+      err = readAttributeArraysInParallel(dcaGid, proxy, dca, crops);
+      h5Lock.lock();
+    }
+  }
   if(err < 0)
   {
     QString ss = QObject::tr("Error trying to read the DataContainers from the file '%1'").arg(m_CurrentFilePath);
     Q_EMIT errorGenerated(Title, ss, err);
+    H5Gclose(dcaGid);
     return DataContainerArray::NullPointer();
   }
 
@@ -183,6 +680,217 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(DataConta
   return dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLH5DataReader::readAttributeArraysInParallel(hid_t dcaGid, const DataContainerArrayProxy& proxy, const DataContainerArrayShPtrType& dca, const QMap<QString, ImageCrop>& crops)
+{
+  std::unique_lock<H5GlobalLock::MutexType> h5Lock(H5GlobalLock::Mutex());
+
+  std::vector<ArrayReadRequest> requests;
+  std::vector<hid_t> amGids;
+
+  for(const auto& dcProxy : proxy.getDataContainers())
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(dcProxy.getName());
+    if(dcProxy.getFlag() == Qt::Unchecked || nullptr == dc)
+    {
+      continue;
+    }
+    for(const auto& amProxy : dcProxy.getAttributeMatricies())
+    {
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(amProxy.getName());
+      if(amProxy.getFlag() == Qt::Unchecked || nullptr == am)
+      {
+        continue;
+      }
+      QString amPath = QString("%1/%2").arg(dcProxy.getName(), amProxy.getName());
+      hid_t amGid = H5Gopen(dcaGid, amPath.toLatin1().data(), H5P_DEFAULT);
+      if(amGid < 0)
+      {
+        for(hid_t openGid : amGids)
+        {
+          H5Gclose(openGid);
+        }
+        return -198745604;
+      }
+      amGids.push_back(amGid);
+      bool cropped = crops.contains(amPath);
+      for(const auto& daProxy : amProxy.getDataArrays())
+      {
+        if(daProxy.getFlag() == SIMPL::Unchecked)
+        {
+          continue;
+        }
+        ArrayReadRequest request;
+        request.attributeMatrix = am;
+        request.amGid = amGid;
+        request.name = daProxy.getName();
+        request.filePath = m_CurrentFilePath;
+        request.groupPath = SIMPL::StringConstants::DataContainerGroupName + "/" + amPath;
+        request.deferred = m_LoadArraysOnDemand;
+        request.cropped = cropped;
+        if(cropped)
+        {
+          request.crop = crops.value(amPath);
+        }
+        requests.push_back(request);
+      }
+    }
+  }
+
+  // The read tasks take the HDF5 lock themselves
+  h5Lock.unlock();
+  if(!requests.empty())
+  {
+    ReadProgress progress;
+    auto startTime = std::chrono::steady_clock::now();
+
+    // The tasks are queued from a separate thread so that this thread can report progress as each
+    // array completes instead of only between batches of queued tasks
+    std::thread dispatcher([&requests, &progress]() {
+      ParallelTaskAlgorithm taskAlg;
+      for(auto& request : requests)
+      {
+        taskAlg.execute(ReadArrayTask(&request, &progress));
+      }
+      taskAlg.wait();
+    });
+
+    size_t lastArraysRead = 0;
+    while(lastArraysRead < requests.size())
+    {
+      size_t completed = 0;
+      size_t bytesRead = 0;
+      {
+        std::unique_lock<std::mutex> lock(progress.mutex);
+        progress.arrayCompleted.wait(lock, [&]() { return progress.arraysRead != lastArraysRead; });
+        completed = progress.arraysRead;
+        bytesRead = progress.bytesRead;
+      }
+      lastArraysRead = completed;
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+      double mbPerSec = (seconds > 0.0) ? static_cast<double>(bytesRead) / (1024.0 * 1024.0) / seconds : 0.0;
+      int percent = static_cast<int>(completed * 100 / requests.size());
+      QString msg = QObject::tr("Reading Arrays: %1 of %2 (%3 MB/s)").arg(completed).arg(requests.size()).arg(mbPerSec, 0, 'f', 1);
+      Q_EMIT progressGenerated(percent, msg);
+    }
+    dispatcher.join();
+
+    // The AttributeMatrices are only modified here, after every task has finished
+    for(const auto& request : requests)
+    {
+      if(nullptr != request.array)
+      {
+        request.attributeMatrix->addOrReplaceAttributeArray(request.array);
+      }
+    }
+  }
+
+  h5Lock.lock();
+  for(hid_t amGid : amGids)
+  {
+    H5Gclose(amGid);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLH5DataReader::setImageRegionOfInterest(const std::array<size_t, 3>& minIndex, const std::array<size_t, 3>& maxIndex)
+{
+  m_UseImageRegionOfInterest = true;
+  m_RegionOfInterestMin = minIndex;
+  m_RegionOfInterestMax = maxIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLH5DataReader::clearImageRegionOfInterest()
+{
+  m_UseImageRegionOfInterest = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLH5DataReader::setLoadArraysOnDemand(bool value)
+{
+  m_LoadArraysOnDemand = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLH5DataReader::getLoadArraysOnDemand() const
+{
+  return m_LoadArraysOnDemand;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLH5DataReader::applyImageRegionOfInterest(const DataContainerArrayShPtrType& dca, QMap<QString, ImageCrop>& crops)
+{
+  for(const auto& dc : dca->getDataContainers())
+  {
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    if(nullptr == image)
+    {
+      continue;
+    }
+
+    SizeVec3Type dims = image->getDimensions();
+    FloatVec3Type origin = image->getOrigin();
+    FloatVec3Type spacing = image->getSpacing();
+    ImageCrop crop;
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(m_RegionOfInterestMin[i] > m_RegionOfInterestMax[i] || m_RegionOfInterestMin[i] >= dims[i])
+      {
+        QString ss = QObject::tr("The region of interest does not intersect the Image Geometry of Data Container '%1' with dimensions %2 x %3 x %4")
+                         .arg(dc->getName())
+                         .arg(dims[0])
+                         .arg(dims[1])
+                         .arg(dims[2]);
+        Q_EMIT errorGenerated(Title, ss, -252);
+        return -252;
+      }
+      crop.sourceDims[i] = dims[i];
+      crop.start[i] = m_RegionOfInterestMin[i];
+      crop.count[i] = std::min(m_RegionOfInterestMax[i], dims[i] - 1) - m_RegionOfInterestMin[i] + 1;
+      origin[i] += static_cast<float>(crop.start[i]) * spacing[i];
+    }
+    image->setDimensions(crop.count[0], crop.count[1], crop.count[2]);
+    image->setOrigin(origin);
+
+    std::vector<size_t> sourceTupleDims = {crop.sourceDims[0], crop.sourceDims[1], crop.sourceDims[2]};
+    std::vector<size_t> croppedTupleDims = {crop.count[0], crop.count[1], crop.count[2]};
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      if(am->getTupleDimensions() != sourceTupleDims)
+      {
+        continue;
+      }
+      // Remove the arrays first so setTupleDimensions() does not allocate the preflight arrays
+      std::vector<IDataArray::Pointer> arrays;
+      for(const auto& arrayName : am->getAttributeArrayNames())
+      {
+        arrays.push_back(am->removeAttributeArray(arrayName));
+      }
+      am->setTupleDimensions(croppedTupleDims);
+      for(const auto& array : arrays)
+      {
+        am->addOrReplaceAttributeArray(array->createNewArray(CropTupleCount(crop), array->getComponentDimensions(), array->getName(), array->isAllocated()));
+      }
+      crops.insert(dc->getName() + "/" + am->getName(), crop);
+    }
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -195,6 +903,8 @@ DataContainerArrayProxy SIMPLH5DataReader::readDataContainerArrayStructure(SIMPL
     return DataContainerArrayProxy();
   }
 
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
+
   // Check the DREAM3D File Version to make sure we are reading the proper version
   QString d3dVersion;
   err = QH5Lite::readStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, d3dVersion);
@@ -244,6 +954,7 @@ DataContainerArrayProxy SIMPLH5DataReader::readDataContainerArrayStructure(SIMPL
 bool SIMPLH5DataReader::readPipelineJson(QString& json)
 {
   herr_t err = 0;
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
 
   // Check to see if version of .dream3d file is prior to new data container names
   QString fileVersionString = "";
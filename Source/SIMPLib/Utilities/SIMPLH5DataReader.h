@@ -31,6 +31,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <array>
 #include <memory>
 
 #include <hdf5.h>
@@ -74,6 +75,17 @@ public:
   SIMPLH5DataReader();
   ~SIMPLH5DataReader() override;
 
+  /**
+   * @brief The ImageCrop struct describes the index space sub volume of an ImageGeom that is read
+   * instead of the whole volume.
+   */
+  struct ImageCrop
+  {
+    std::array<size_t, 3> start = {0, 0, 0};
+    std::array<size_t, 3> count = {0, 0, 0};
+    std::array<size_t, 3> sourceDims = {0, 0, 0};
+  };
+
   /**
    * @brief ReadJsonFile
    * @param filePath
@@ -95,13 +107,43 @@ public:
   DataContainerArrayProxy readDataContainerArrayStructure(SIMPLH5DataReaderRequirements* req, int& err);
 
   /**
-   * @brief readSIMPLDataUsingProxy
+   * @brief readSIMPLDataUsingProxy. The arrays are read on a thread pool that takes H5GlobalLock, so
+   * this must be called without holding that lock.
    * @param proxy
    * @param preflight
    * @return
    */
   DataContainerArrayShPtrType readSIMPLDataUsingProxy(DataContainerArrayProxy& proxy, bool preflight);
 
+  /**
+   * @brief Restricts every ImageGeom DataContainer read by readSIMPLDataUsingProxy() to the given
+   * inclusive voxel index range. The geometry is cropped to the range and the AttributeMatrices whose
+   * tuple dimensions match the geometry are read with an HDF5 hyperslab so only the requested voxels
+   * are loaded. The maximum index is clamped to the extent of each geometry.
+   * @param minIndex
+   * @param maxIndex
+   */
+  void setImageRegionOfInterest(const std::array<size_t, 3>& minIndex, const std::array<size_t, 3>& maxIndex);
+
+  /**
+   * @brief Removes the region of interest so complete volumes are read again.
+   */
+  void clearImageRegionOfInterest();
+
+  /**
+   * @brief When set, readSIMPLDataUsingProxy() only reads the structure of numeric arrays. Their values are
+   * read from the file the first time they are accessed, so the file must stay in place until then. Other
+   * array classes are always read immediately.
+   * @param value
+   */
+  void setLoadArraysOnDemand(bool value);
+
+  /**
+   * @brief Returns true if numeric arrays are loaded when they are first accessed
+   * @return
+   */
+  bool getLoadArraysOnDemand() const;
+
   /**
    * @brief readPipelineJson
    * @param json
@@ -119,9 +161,21 @@ public:
 Q_SIGNALS:
   void errorGenerated(const QString& title, const QString& msg, const int& code);
 
+  /**
+   * @brief Emitted while the arrays are read with the percentage of arrays completed and a
+   * message that includes the aggregate read rate.
+   * @param progress
+   * @param msg
+   */
+  void progressGenerated(int progress, const QString& msg);
+
 private:
   QString m_CurrentFilePath = "";
   hid_t m_FileId = -1;
+  bool m_LoadArraysOnDemand = false;
+  bool m_UseImageRegionOfInterest = false;
+  std::array<size_t, 3> m_RegionOfInterestMin = {0, 0, 0};
+  std::array<size_t, 3> m_RegionOfInterestMax = {0, 0, 0};
 
   /**
    * @brief readDataContainerBundles
@@ -131,6 +185,31 @@ private:
    */
   bool readDataContainerBundles(hid_t fileId, const DataContainerArrayShPtrType& dca);
 
+  /**
+   * @brief Reads the checked arrays of the proxy into the AttributeMatrices that already exist in
+   * the DataContainerArray. Each array is read by its own task. The HDF5 calls are serialized, but
+   * chunked datasets compressed with deflate and shuffle are read as raw chunks and decoded outside of
+   * the lock, so the decompression of one array overlaps the reads of the others. Progress is reported
+   * as each array completes.
+   * Must be called without holding H5GlobalLock.
+   * @param dcaGid
+   * @param proxy
+   * @param dca
+   * @param crops The image crop of every AttributeMatrix that is read as a sub volume
+   * @return Negative value on error
+   */
+  int readAttributeArraysInParallel(hid_t dcaGid, const DataContainerArrayProxy& proxy, const DataContainerArrayShPtrType& dca, const QMap<QString, ImageCrop>& crops);
+
+  /**
+   * @brief Crops the ImageGeom of every DataContainer to the region of interest and resizes the
+   * AttributeMatrices that hold one tuple per voxel. Arrays already present in those AttributeMatrices
+   * are replaced with unallocated arrays of the cropped size.
+   * @param dca
+   * @param crops Receives the crop for each resized AttributeMatrix keyed by "DataContainer/AttributeMatrix"
+   * @return Negative value on error
+   */
+  int applyImageRegionOfInterest(const DataContainerArrayShPtrType& dca, QMap<QString, ImageCrop>& crops);
+
 public:
   SIMPLH5DataReader(const SIMPLH5DataReader&) = delete;            // Copy Constructor Not Implemented
   SIMPLH5DataReader(SIMPLH5DataReader&&) = delete;                 // Move Constructor Not Implemented
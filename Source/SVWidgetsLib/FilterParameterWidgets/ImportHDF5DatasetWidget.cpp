@@ -56,6 +56,7 @@ using namespace H5Support;
 
 #include "SIMPLib/CoreFilters/ImportHDF5Dataset.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/HDF5/H5GlobalLock.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
 #include "SIMPLib/Utilities/FilterCompatibility.hpp"
 #include "SIMPLib/Utilities/SIMPLDataPathValidator.h"
@@ -107,6 +108,7 @@ ImportHDF5DatasetWidget::ImportHDF5DatasetWidget(FilterParameter* parameter, Abs
 // -----------------------------------------------------------------------------
 ImportHDF5DatasetWidget::~ImportHDF5DatasetWidget()
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   if(m_FileId > 0)
   {
     H5Fclose(m_FileId);
@@ -461,6 +463,7 @@ void ImportHDF5DatasetWidget::dropEvent(QDropEvent* e)
 // -----------------------------------------------------------------------------
 bool ImportHDF5DatasetWidget::initWithFile(const QString& hdf5File)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   if(hdf5File.isNull())
   {
     return false;
@@ -583,6 +586,7 @@ void ImportHDF5DatasetWidget::hdfTreeView_currentChanged(const QModelIndex& curr
 // -----------------------------------------------------------------------------
 herr_t ImportHDF5DatasetWidget::updateGeneralTable(const QString& path)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   setErrorText("");
   std::string datasetPath = path.toStdString();
   std::string objName = H5Utilities::extractObjectName(datasetPath);
@@ -742,6 +746,7 @@ void ImportHDF5DatasetWidget::addRow(QTableWidget* table, int row, const QString
 // -----------------------------------------------------------------------------
 herr_t ImportHDF5DatasetWidget::updateAttributeTable(const QString& path)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   QString objName = QH5Utilities::extractObjectName(path);
   setErrorText("");
   herr_t err = 0;
@@ -928,6 +933,7 @@ herr_t ImportHDF5DatasetWidget::updateComponentDimensions(const QString& path)
 // -----------------------------------------------------------------------------
 std::tuple<herr_t, QString> ImportHDF5DatasetWidget::bestGuessCDims(const QString& path)
 {
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   setErrorText("");
   herr_t err = 0;
   QString cDimsStr = "";
@@ -34,6 +34,8 @@
 
 #include "H5Support/H5Utilities.h"
 
+#include "SIMPLib/HDF5/H5GlobalLock.h"
+
 using namespace H5Support;
 
 ImportHDF5TreeModelItem::ImportHDF5TreeModelItem(hid_t fileId, const QString& data, ImportHDF5TreeModelItem* parent)
@@ -229,6 +231,7 @@ void ImportHDF5TreeModelItem::initializeChildCount()
 
   QString path = generateHDFPath();
 
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   hid_t obj_id = H5Utilities::openHDF5Object(m_FileId, path.toStdString());
   if(obj_id > 0)
   {
@@ -284,6 +287,7 @@ void ImportHDF5TreeModelItem::initializeChildItems()
 
   QString path = generateHDFPath();
 
+  H5GlobalLock::Guard h5Lock(H5GlobalLock::Mutex());
   // std::cout << "ImportHDF5TreeModelItem::initializeChildItems() - Generated Path as: " << path.toStdString() << std::endl;
   // Check to see if the path is a group or data set
   if(H5Utilities::isGroup(m_FileId, path.toStdString()))
@@ -42,9 +42,13 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QMimeData>
+#include <QtCore/QSignalBlocker>
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
 
+#include <QtConcurrent/QtConcurrentRun>
+
 #include <QtGui/QClipboard>
 #include <QtGui/QDrag>
 #include <QtGui/QDragEnterEvent>
@@ -99,6 +103,12 @@ class ExecutionResultInvalidException : public std::exception
   }
 };
 
+namespace
+{
+// How long the pipeline has to stay unchanged before a requested preflight starts, in milliseconds
+constexpr int k_PreflightDelay = 150;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -106,6 +116,10 @@ SVPipelineView::SVPipelineView(QWidget* parent)
 : QListView(parent)
 , m_PipelineState(PipelineViewState::Idle)
 {
+  m_PreflightTimer = new QTimer(this);
+  m_PreflightTimer->setSingleShot(true);
+  m_PreflightTimer->setInterval(k_PreflightDelay);
+
   setupGui();
 }
 
@@ -114,6 +128,7 @@ SVPipelineView::SVPipelineView(QWidget* parent)
 // -----------------------------------------------------------------------------
 SVPipelineView::~SVPipelineView()
 {
+  discardPreflight();
   delete m_WorkerThread;
   delete m_ActionEnableFilter;
 }
@@ -170,6 +185,9 @@ void SVPipelineView::connectSignalsSlots()
   connect(m_ActionPaste, &QAction::triggered, this, &SVPipelineView::listenPasteTriggered);
 
   connect(m_ActionClearPipeline, &QAction::triggered, this, &SVPipelineView::listenClearPipelineTriggered);
+
+  connect(m_PreflightTimer, &QTimer::timeout, this, &SVPipelineView::startPreflight);
+  connect(&m_PreflightWatcher, &QFutureWatcher<int>::finished, this, &SVPipelineView::finishPreflight);
 }
 
 // -----------------------------------------------------------------------------
@@ -322,6 +340,27 @@ void SVPipelineView::preflightPipeline()
   {
     return;
   }
+
+  if(!m_AsynchronousPreflight)
+  {
+    preflightPipelineNow();
+    return;
+  }
+
+  // Whatever is preflighting right now no longer matches the pipeline
+  m_PreflightRequest++;
+  if(m_PreflightWatcher.isRunning())
+  {
+    m_PreflightPipeline->cancelPreflight();
+  }
+  m_PreflightTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::preflightPipelineNow()
+{
   Q_EMIT clearIssuesTriggered();
 
   PipelineModel* model = getPipelineModel();
@@ -385,11 +424,253 @@ void SVPipelineView::preflightPipeline()
   updateFilterInputWidgetIndices();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer SVPipelineView::createPreflightCopy(const AbstractFilter::Pointer& filter)
+{
+  AbstractFilter::Pointer copy = filter->newFilterInstance(false);
+  copy->setProperty("HasRenameValues", filter->property("HasRenameValues"));
+
+  // These are emitted on the worker thread and run there. Nothing else touches m_PreflightMessages and
+  // m_PreflightRenames while a preflight runs; the finished signal of m_PreflightWatcher is the only
+  // synchronization before finishPreflight() reads them on this thread. The view is the context so the
+  // connections go away with it.
+  AbstractFilter* copyPtr = copy.get();
+  connect(
+      copyPtr, &AbstractFilter::messageGenerated, this, [this](const AbstractMessage::Pointer& msg) { m_PreflightMessages.push_back(msg); }, Qt::DirectConnection);
+  connect(
+      copyPtr, &AbstractFilter::dataArrayPathUpdated, this,
+      [this, copyPtr](const QString&, const DataArrayPath::RenameType& renamePath) {
+        auto iter = std::find_if(m_PreflightRenames.begin(), m_PreflightRenames.end(),
+                                 [copyPtr, &renamePath](const PreflightRename& rename) { return rename.copy == copyPtr && rename.renamePath == renamePath; });
+        if(iter == m_PreflightRenames.end())
+        {
+          m_PreflightRenames.push_back({copyPtr, renamePath});
+        }
+      },
+      Qt::DirectConnection);
+  return copy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::startPreflight()
+{
+  // A preflight that is still running was canceled; the next one starts when it has stopped
+  if(m_BlockPreflight || m_PreflightWatcher.isRunning())
+  {
+    return;
+  }
+
+  PipelineModel* model = getPipelineModel();
+  if(nullptr == model)
+  {
+    return;
+  }
+
+  FilterPipeline::FilterContainerType filters = getFilterPipeline()->getFilterContainer();
+
+  // Bring the copies up to date with the parameters in the widgets. Copies of unchanged filters are kept,
+  // so the preflight resumes from the structures the pipeline cached for them.
+  std::vector<PreflightCopy> preflightCopies;
+  preflightCopies.reserve(filters.size());
+  FilterPipeline::FilterContainerType copies;
+  for(const auto& filter : filters)
+  {
+    Q_EMIT filter->updateFilterParameters(filter.get());
+
+    auto iter = std::find_if(m_PreflightCopies.begin(), m_PreflightCopies.end(), [&filter](const PreflightCopy& preflightCopy) { return preflightCopy.filter == filter; });
+    PreflightCopy preflightCopy = (iter != m_PreflightCopies.end()) ? *iter : PreflightCopy{filter, createPreflightCopy(filter), QJsonObject()};
+
+    QJsonObject parameters = filter->toJson();
+    if(parameters != preflightCopy.parameters)
+    {
+      preflightCopy.copy->readFilterParameters(parameters);
+      preflightCopy.copy->setEnabled(filter->getEnabled());
+      preflightCopy.parameters = parameters;
+    }
+
+    copies.push_back(preflightCopy.copy);
+    preflightCopies.push_back(preflightCopy);
+  }
+  m_PreflightCopies = std::move(preflightCopies);
+
+  if(nullptr == m_PreflightPipeline)
+  {
+    m_PreflightPipeline = FilterPipeline::New();
+  }
+  if(m_PreflightPipeline->getFilterContainer() != copies)
+  {
+    // Removing the filters one by one keeps the preflight cache of the pipeline
+    while(!m_PreflightPipeline->getFilterContainer().isEmpty())
+    {
+      m_PreflightPipeline->popBack();
+    }
+    for(const auto& copy : copies)
+    {
+      m_PreflightPipeline->pushBack(copy);
+    }
+  }
+
+  m_PreflightMessages.clear();
+  m_PreflightRenames.clear();
+  m_PreflightStructures.clear();
+  m_PreflightStarted = m_PreflightRequest;
+
+  // Filters may open HDF5 files while they preflight on the worker, so every HDF5 call made on this thread
+  // while it runs, such as those of ImportHDF5DatasetWidget, has to hold H5GlobalLock.
+  // The structures handed to the widgets are copied on the worker as well, so the widgets never share
+  // containers with the copies and this thread does not pay for the copies. Like the messages, they are only
+  // read by finishPreflight().
+  FilterPipeline::Pointer pipeline = m_PreflightPipeline;
+  std::vector<DataContainerArray::Pointer>* structures = &m_PreflightStructures;
+  m_PreflightWatcher.setFuture(QtConcurrent::run([pipeline, structures]() {
+    int err = pipeline->preflightPipeline();
+    for(const auto& copy : pipeline->getFilterContainer())
+    {
+      DataContainerArray::Pointer dca = copy->getDataContainerArray();
+      structures->push_back((nullptr != dca) ? dca->deepCopy(true) : DataContainerArray::New());
+    }
+    return err;
+  }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::finishPreflight()
+{
+  if(0 == m_PreflightStarted)
+  {
+    // The preflight was discarded
+    return;
+  }
+  if(m_PreflightStarted != m_PreflightRequest)
+  {
+    // The pipeline changed while this preflight was running
+    if(!m_PreflightTimer->isActive())
+    {
+      startPreflight();
+    }
+    return;
+  }
+  m_PreflightStarted = 0;
+
+  PipelineModel* model = getPipelineModel();
+  if(nullptr == model)
+  {
+    return;
+  }
+
+  int err = m_PreflightWatcher.result();
+
+  Q_EMIT clearIssuesTriggered();
+
+  // Apply the renames the copies made so the widgets show the updated paths
+  for(const auto& rename : m_PreflightRenames)
+  {
+    auto iter = std::find_if(m_PreflightCopies.begin(), m_PreflightCopies.end(), [&rename](const PreflightCopy& preflightCopy) { return preflightCopy.copy.get() == rename.copy; });
+    if(iter == m_PreflightCopies.end())
+    {
+      continue;
+    }
+    FilterParameterVectorType filterParameters = iter->filter->getFilterParameters();
+    for(const auto& filterParameter : filterParameters)
+    {
+      filterParameter->dataArrayPathRenamed(iter->filter.get(), rename.renamePath);
+    }
+    iter->parameters = iter->filter->toJson();
+  }
+
+  for(const auto& msg : m_PreflightMessages)
+  {
+    for(const auto& observer : m_PipelineMessageObservers)
+    {
+      QMetaObject::invokeMethod(observer, "processPipelineMessage", Qt::DirectConnection, Q_ARG(AbstractMessage::Pointer, msg));
+    }
+  }
+
+  // Hand each filter the copy of the structure its preflight copy produced, made on the worker. The widgets see
+  // the structure coming into the filter before the preflight and the one it produced after it, just like a
+  // preflight on this thread.
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  for(size_t i = 0; i < m_PreflightCopies.size(); i++)
+  {
+    const AbstractFilter::Pointer& filter = m_PreflightCopies[i].filter;
+    const AbstractFilter::Pointer& copy = m_PreflightCopies[i].copy;
+
+    filter->setDataContainerArray(dca);
+    Q_EMIT filter->preflightAboutToExecute();
+
+    dca = (i < m_PreflightStructures.size()) ? m_PreflightStructures[i] : DataContainerArray::New();
+    filter->setDataContainerArray(dca);
+    filter->setProperty("HasRenameValues", copy->property("HasRenameValues"));
+    filter->clearErrorCode();
+    filter->clearWarningCode();
+    filter->setCancel(false);
+    {
+      // The messages have already been sent
+      QSignalBlocker blocker(filter.get());
+      if(copy->getWarningCode() != 0)
+      {
+        filter->setWarningCondition(copy->getWarningCode(), QString());
+      }
+      if(copy->getErrorCode() != 0)
+      {
+        filter->setErrorCondition(copy->getErrorCode(), QString());
+      }
+    }
+    Q_EMIT filter->preflightExecuted();
+
+    QModelIndex index = model->indexOfFilter(filter.get());
+    if(!index.isValid())
+    {
+      continue;
+    }
+    model->setData(index, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
+    if(filter->getEnabled())
+    {
+      model->setData(index, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
+    }
+    if(filter->getWarningCode() < 0)
+    {
+      model->setData(index, static_cast<int>(PipelineItem::ErrorState::Warning), PipelineModel::ErrorStateRole);
+    }
+    if(filter->getErrorCode() < 0)
+    {
+      model->setData(index, static_cast<int>(PipelineItem::ErrorState::Error), PipelineModel::ErrorStateRole);
+    }
+  }
+
+  m_PreflightStructures.clear();
+
+  Q_EMIT preflightFinished(static_cast<int32_t>(m_PreflightCopies.size()), err);
+  updateFilterInputWidgetIndices();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::discardPreflight()
+{
+  m_PreflightTimer->stop();
+  if(m_PreflightWatcher.isRunning())
+  {
+    m_PreflightPipeline->cancelPreflight();
+    m_PreflightWatcher.waitForFinished();
+  }
+  m_PreflightStarted = 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void SVPipelineView::executePipeline()
 {
+  discardPreflight();
+
   if(m_WorkerThread != nullptr)
   {
     m_WorkerThread->wait(); // Wait until the thread is complete
@@ -2263,6 +2544,22 @@ SVPipelineView::PipelineViewState SVPipelineView::getPipelineState() const
   return m_PipelineState;
 }
 
+// -----------------------------------------------------------------------------
+void SVPipelineView::setAsynchronousPreflight(bool value)
+{
+  if(!value)
+  {
+    discardPreflight();
+  }
+  m_AsynchronousPreflight = value;
+}
+
+// -----------------------------------------------------------------------------
+bool SVPipelineView::getAsynchronousPreflight() const
+{
+  return m_AsynchronousPreflight;
+}
+
 // -----------------------------------------------------------------------------
 QAction* SVPipelineView::getActionEnableFilter() const
 {
@@ -35,11 +35,15 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include <stack>
 #include <vector>
 
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QJsonObject>
+
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QListView>
 
@@ -67,6 +71,7 @@ class PipelineFilterObject;
 class DataStructureWidget;
 class PipelineModel;
 class QSignalMapper;
+class QTimer;
 
 /*
  *
@@ -125,6 +130,17 @@ public:
    */
   QAction* getActionClearPipeline() const;
 
+  /**
+   * @brief Setter property for AsynchronousPreflight. When enabled, preflightPipeline() only schedules a
+   * preflight. It starts once the pipeline has not been edited for a moment and runs on a worker thread.
+   */
+  void setAsynchronousPreflight(bool value);
+  /**
+   * @brief Getter property for AsynchronousPreflight
+   * @return Value of AsynchronousPreflight
+   */
+  bool getAsynchronousPreflight() const;
+
   SVPipelineView(QWidget* parent = nullptr);
   ~SVPipelineView() override;
 
@@ -303,8 +319,9 @@ public Q_SLOTS:
   void pasteFilters(int insertIndex = -1, bool useAnimationOnFirstRun = true);
 
   /**
-   * @brief preflightPipeline
-   * @param pipelineIndex
+   * @brief Preflights the pipeline. With AsynchronousPreflight enabled the preflight is debounced, runs on a
+   * worker thread against copies of the filters and cancels any preflight that is still running. Its results
+   * are applied to the filters and the model in one go once it completes.
    */
   void preflightPipeline();
 
@@ -447,9 +464,49 @@ private Q_SLOTS:
    */
   void finishPipeline();
 
+  /**
+   * @brief Brings the copies of the filters up to date and preflights them on a worker thread
+   */
+  void startPreflight();
+
+  /**
+   * @brief Applies the results of the preflight that just completed, unless a newer one was requested meanwhile
+   */
+  void finishPreflight();
+
 private:
+  /**
+   * @brief A filter of the pipeline and the copy of it that is preflighted on the worker thread
+   */
+  struct PreflightCopy
+  {
+    AbstractFilter::Pointer filter;
+    AbstractFilter::Pointer copy;
+    QJsonObject parameters;
+  };
+
+  /**
+   * @brief A DataArrayPath rename a copy applied to its parameters during the preflight
+   */
+  struct PreflightRename
+  {
+    AbstractFilter* copy = nullptr;
+    DataArrayPath::RenameType renamePath;
+  };
+
   SVPipelineView::PipelineViewState m_PipelineState = {};
 
+  bool m_AsynchronousPreflight = true;
+  QTimer* m_PreflightTimer = nullptr;
+  QFutureWatcher<int> m_PreflightWatcher;
+  FilterPipeline::Pointer m_PreflightPipeline;
+  std::vector<PreflightCopy> m_PreflightCopies;
+  std::vector<AbstractMessage::Pointer> m_PreflightMessages;
+  std::vector<PreflightRename> m_PreflightRenames;
+  std::vector<DataContainerArrayShPtrType> m_PreflightStructures;
+  uint64_t m_PreflightRequest = 0;
+  uint64_t m_PreflightStarted = 0;
+
   QThread* m_WorkerThread = nullptr;
   FilterPipeline::Pointer m_PipelineInFlight;
   QVector<DataContainerArrayShPtrType> m_PreflightDataContainerArrays;
@@ -508,6 +565,23 @@ private:
    */
   std::vector<AbstractFilter::Pointer> getSelectedFilters();
 
+  /**
+   * @brief Preflights the filters of the pipeline on the calling thread
+   */
+  void preflightPipelineNow();
+
+  /**
+   * @brief Stops a scheduled preflight and waits for a running one to stop. Its results are discarded.
+   */
+  void discardPreflight();
+
+  /**
+   * @brief Creates the copy of the filter that is preflighted on the worker thread and records what it reports
+   * @param filter
+   * @return
+   */
+  AbstractFilter::Pointer createPreflightCopy(const AbstractFilter::Pointer& filter);
+
   /**
    * @brief requestFilterContextMenu
    * @param pos